@@ -1,22 +1,46 @@
+import csv
+import sys
 import numpy as np
 import matplotlib.pyplot as plt
 import os
 
 def plot_quantiles(results_dict, title, filename):
-    plt.figure(figsize=(12, 6))
-
+    """results_dict maps a label to its raw times in µs."""
     percentiles = np.linspace(0, 100, 101)
-
+    curves = {}
     for label, times in results_dict.items():
         times = np.array(times)
         times = times[times > 0] 
-        quantile_vals = np.percentile(times, percentiles)
+        curves[label] = (percentiles, np.percentile(times, percentiles))
+    plot_quantile_curves(curves, title, filename)
+
+def load_latency_csv(path):
+    """Reads the tokenization_latency.csv the DPDK server writes on exit or
+    on 'latency CSV': one curve per batch size and payload size class."""
+    curves = {}
+    with open(path, newline="") as f:
+        for row in csv.DictReader(f):
+            if row["BatchSize"] == "all":
+                label = "All requests"
+            else:
+                label = f"Batch {row['BatchSize']}, {row['PayloadBytes']} B"
+            label += f" (n={row['Requests']})"
+            points = curves.setdefault(label, ([], []))
+            points[0].append(float(row["Percentile"]))
+            points[1].append(float(row["TokenizationTime_us"]))
+    return {label: (np.array(p), np.array(v)) for label, (p, v) in curves.items()}
+
+def plot_quantile_curves(curves, title, filename):
+    """curves maps a label to (percentiles, times in µs)."""
+    plt.figure(figsize=(12, 6))
+
+    for label, (percentiles, quantile_vals) in curves.items():
         plt.plot(percentiles, quantile_vals, marker='.', linestyle='-', label=label)
 
         p90_x = 90
         p99_x = 99
-        p90_y = np.percentile(times, 90)
-        p99_y = np.percentile(times, 99)
+        p90_y = np.interp(90, percentiles, quantile_vals)
+        p99_y = np.interp(99, percentiles, quantile_vals)
         plt.axvline(p90_x, color='gray', linestyle='--', linewidth=0.7)
         plt.axvline(p99_x, color='gray', linestyle='--', linewidth=0.7)
         plt.text(p90_x + 0.5, p90_y, f'{label} P90: {p90_y:.1f}µs', fontsize=7, rotation=0, va='bottom')
@@ -32,6 +56,14 @@ def plot_quantiles(results_dict, title, filename):
     print(f"Saved quantile plot: {filename}")
 
 if __name__ == "__main__":
+    if len(sys.argv) > 1:
+        # python plot_latency_quantiles.py tokenization_latency.csv [more.csv ...]
+        for path in sys.argv[1:]:
+            name = os.path.splitext(os.path.basename(path))[0]
+            plot_quantile_curves(load_latency_csv(path), f"DPDK Tokenization Time by Percentile ({name})",
+                                 f"quantile_plot_{name}.png")
+        sys.exit(0)
+
     results = {}
 
     for batch in [25, 50, 75]:
@@ -0,0 +1,75 @@
+import argparse
+import struct
+import sys
+
+# Layouts of dpdk/trace.h, host order (little endian on x86).
+FILE_HEADER = struct.Struct("<8sQII")
+RING_HEADER = struct.Struct("<IIQ")
+EVENT = struct.Struct("<QIIIHHHHHBB")
+FIELDS = ("rx_tsc", "tokenized", "sent", "text_len", "nb_ids", "words", "cache_hits", "cache_misses",
+          "rx_queue", "tenant", "flags")
+FLAGS = ((1, "frag"), (2, "proto"), (4, "txdrop"))
+REASONS = ("on request", "slow request")
+
+
+def load_trace(path):
+    """Reads a flight recorder dump: returns (header dict, list of events),
+    each event a dict with its lcore and the trigger TSC of its ring."""
+    with open(path, "rb") as f:
+        data = f.read()
+    magic, hz, nb_rings, reason = FILE_HEADER.unpack_from(data, 0)
+    if magic != b"NTTRACE1":
+        raise ValueError(f"{path}: not a trace dump")
+    off = FILE_HEADER.size
+    events = []
+    for _ in range(nb_rings):
+        lcore, nb_events, trigger = RING_HEADER.unpack_from(data, off)
+        off += RING_HEADER.size
+        for _ in range(nb_events):
+            ev = dict(zip(FIELDS, EVENT.unpack_from(data, off)))
+            off += EVENT.size
+            ev["lcore"] = lcore
+            ev["trigger_tsc"] = trigger
+            events.append(ev)
+    header = {"hz": hz, "rings": nb_rings, "reason": REASONS[reason] if reason < len(REASONS) else str(reason)}
+    return header, sorted(events, key=lambda ev: ev["rx_tsc"])
+
+
+def flag_names(flags):
+    return ",".join(name for bit, name in FLAGS if flags & bit) or "-"
+
+
+def print_timeline(path, header, events, slower_than=0.0, last=0, out=sys.stdout):
+    """One line per request, times in µs. RX time is relative to the slow
+    request that froze the ring, or to the dump for one taken on request."""
+    us = 1e6 / header["hz"]
+    print(f"# {path}: {header['rings']} lcore(s), dumped {header['reason']}, {len(events)} requests", file=out)
+    if not events:
+        return
+    ref = max(ev["trigger_tsc"] for ev in events) if header["reason"] == "slow request" else events[-1]["rx_tsc"]
+    if last:
+        events = [ev for ev in events if ev["rx_tsc"] <= ref][-last:]
+    print(f"{'rx_us':>12} {'lcore':>5} {'queue':>5} {'tenant':>6} {'bytes':>6} {'words':>5} {'ids':>5} "
+          f"{'hits':>5} {'miss':>5} {'tok_us':>9} {'tx_us':>9}  flags", file=out)
+    for ev in events:
+        sent_us = ev["sent"] * us
+        if sent_us < slower_than:
+            continue
+        mark = " <" if ev["rx_tsc"] == ev["trigger_tsc"] else ""
+        print(f"{(ev['rx_tsc'] - ref) * us:12.1f} {ev['lcore']:5} {ev['rx_queue']:5} {ev['tenant']:6} "
+              f"{ev['text_len']:6} {ev['words']:5} {ev['nb_ids']:5} {ev['cache_hits']:5} {ev['cache_misses']:5} "
+              f"{ev['tokenized'] * us:9.1f} {sent_us:9.1f}  {flag_names(ev['flags'])}{mark}", file=out)
+
+
+if __name__ == "__main__":
+    # python trace_timeline.py nettok_trace.PID.N.bin [more.bin ...]
+    parser = argparse.ArgumentParser(description="Prints the requests of flight recorder dumps as a timeline")
+    parser.add_argument("dumps", nargs="+")
+    parser.add_argument("--slower-than", type=float, default=0.0, metavar="US",
+                        help="only requests that took at least US from RX to TX")
+    parser.add_argument("--last", type=int, default=0, metavar="N",
+                        help="only the N requests received up to the one that froze the ring")
+    args = parser.parse_args()
+    for path in args.dumps:
+        header, events = load_trace(path)
+        print_timeline(path, header, events, args.slower_than, args.last)
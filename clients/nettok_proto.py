@@ -0,0 +1,113 @@
+"""Request/response helpers for the DPDK tokenizer's binary response formats.
+
+A request payload may start with a 4-byte header selecting the response
+format; without it the server answers in the legacy "%d " ASCII format that
+the other clients here parse. Prompts larger than a frame are split by
+build_fragments. Layouts match dpdk/proto.h.
+"""
+import struct
+
+MAGIC = 0xFE
+VERSION = 1
+
+FMT_ASCII = 0
+FMT_U16 = 1
+FMT_U32 = 2
+FMT_VARINT = 3
+FMT_AUTO = 0xFF
+
+F_TRUNCATED = 0x1
+F_FRAGMENT = 0x2
+REQ_F_FRAGMENT = 0x1
+
+FORMATS = {"ascii": FMT_ASCII, "u16": FMT_U16, "u32": FMT_U32, "varint": FMT_VARINT, "auto": FMT_AUTO}
+
+REQ_HDR = struct.Struct("<BBBB")
+FRAG_HDR = struct.Struct("<IHH")
+RESP_HDR = struct.Struct("<BBBBHH")
+MAX_PAYLOAD = 8192 - 14 - 8 - 4     # jumbo frame less Ethernet, UDP and CRC
+
+
+def build_request(text, fmt=FMT_AUTO):
+    """UDP payload for text; FMT_ASCII sends plain text with no header."""
+    data = text.encode() if isinstance(text, str) else text
+    if fmt == FMT_ASCII:
+        return data
+    return REQ_HDR.pack(MAGIC, VERSION, fmt, 0) + data
+
+
+def build_fragments(text, req_id, fmt=FMT_AUTO, max_payload=MAX_PAYLOAD):
+    """UDP payloads carrying text as one request of several frames.
+
+    req_id must be unique among the sender's requests in flight. Text is cut
+    at byte boundaries; the server tokenizes across the cuts.
+    """
+    data = text.encode() if isinstance(text, str) else text
+    room = max_payload - REQ_HDR.size - FRAG_HDR.size
+    chunks = [data[i:i + room] for i in range(0, len(data), room)] or [b""]
+    if len(chunks) == 1:
+        return [build_request(data, fmt)]
+    return [REQ_HDR.pack(MAGIC, VERSION, fmt, REQ_F_FRAGMENT) + FRAG_HDR.pack(req_id, k, len(chunks)) + c
+            for k, c in enumerate(chunks)]
+
+
+def _varints(buf, count):
+    ids, v, shift = [], 0, 0
+    for b in buf:
+        v |= (b & 0x7F) << shift
+        if b & 0x80:
+            shift += 7
+            continue
+        ids.append(v)
+        v, shift = 0, 0
+        if len(ids) == count:
+            break
+    return ids
+
+
+def _ascii(buf):
+    text = buf.decode("ascii", errors="ignore").strip("\x00 ")
+    return [int(t) for t in text.split()]
+
+
+def parse_part(payload):
+    """Returns (ids, flags, part) for one response frame. part is
+    (req_id, index, count) when the response was split over several frames
+    (flags & F_FRAGMENT), otherwise None."""
+    if not payload or payload[0] != MAGIC:
+        return _ascii(payload), 0, None
+    magic, version, fmt, flags, count, _ = RESP_HDR.unpack_from(payload)
+    body = payload[RESP_HDR.size:]
+    part = None
+    if flags & F_FRAGMENT:
+        part = FRAG_HDR.unpack_from(body)
+        body = body[FRAG_HDR.size:]
+    if fmt == FMT_ASCII:
+        ids = _ascii(body)
+    elif fmt == FMT_U16:
+        ids = list(struct.unpack_from(f"<{count}H", body))
+    elif fmt == FMT_U32:
+        ids = list(struct.unpack_from(f"<{count}I", body))
+    elif fmt == FMT_VARINT:
+        ids = _varints(body, count)
+    else:
+        raise ValueError(f"unknown response format {fmt}")
+    return ids, flags, part
+
+
+def parse_response(payload):
+    """Returns (ids, flags) for a single-frame UDP response payload."""
+    ids, flags, _ = parse_part(payload)
+    return ids, flags
+
+
+def join_parts(payloads):
+    """Returns (ids, flags) for all frames of one split response, in any order."""
+    parts = sorted((parse_part(p) for p in payloads), key=lambda r: r[2][1])
+    if not parts or len(parts) != parts[0][2][2]:
+        raise ValueError("incomplete response")
+    ids, flags = [], 0
+    for part_ids, part_flags, _ in parts:
+        ids += part_ids
+        flags |= part_flags & ~F_FRAGMENT
+    return ids, flags
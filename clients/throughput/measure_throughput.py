@@ -7,6 +7,10 @@ import string
 import argparse
 import csv
 import os
+import sys
+
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), ".."))
+import nettok_proto
 
 IFACE          = "enp2s0f1np1"
 ETH_TYPE       = 0x88B5
@@ -69,7 +73,14 @@ def main():
         default=25,
         help="Tokens per request (default: 25)"
     )
+    p.add_argument(
+        "-f", "--format",
+        choices=list(nettok_proto.FORMATS),
+        default="ascii",
+        help="Response format requested from the DPDK server (default: ascii)"
+    )
     args = p.parse_args()
+    fmt = nettok_proto.FORMATS[args.format]
 
     src_mac = mac_to_bytes(SRC_MAC)
     dst_mac = mac_to_bytes(DST_MAC)
@@ -88,7 +99,7 @@ def main():
           f"duration={args.duration}s, batch={args.batch}…")
 
     while time.perf_counter() < t_end:
-        payload = random_tokens(args.batch)
+        payload = nettok_proto.build_request(random_tokens(args.batch), fmt)
         udp     = build_udp_packet(SRC_PORT, DST_PORT, payload)
         frame   = build_eth_frame(src_mac, dst_mac, ETH_TYPE, udp)
 
@@ -0,0 +1,66 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <rte_cycles.h>
+
+#include "../itoa.h"
+
+// Compares the response formatting loop in lcore_main
+// (offset += sprintf(resp_buf + offset, "%d ", ids[j])) with the batch
+// formatters in itoa.c, for sequence lengths 1..512.
+//
+// Usage: bench_itoa [max id] [iterations]
+
+#define MAX_IDS 512
+#define BUF_SIZE 8192
+
+typedef int (*format_fn)(const int *ids, int nb_ids, char *out, int room);
+
+static int format_sprintf(const int *ids, int nb_ids, char *out, int room) {
+    (void)room;
+    int offset = 0;
+    for (int j = 0; j < nb_ids; j++) offset += sprintf(out + offset, "%d ", ids[j]);
+    return offset;
+}
+
+static double cycles_per_id(format_fn fn, const int *ids, int n, int iterations, char *out) {
+    volatile int sink = 0;
+    uint64_t start = rte_rdtsc();
+    for (int it = 0; it < iterations; it++) sink += fn(ids, n, out, BUF_SIZE);
+    (void)sink;
+    return (double)(rte_rdtsc() - start) / iterations / n;
+}
+
+int main(int argc, char **argv) {
+    int max_id = argc > 1 ? atoi(argv[1]) : 50257;
+    int iterations = argc > 2 ? atoi(argv[2]) : 20000;
+    static int ids[MAX_IDS];
+    static char ref[BUF_SIZE], out[BUF_SIZE];
+
+    srand(1);
+    for (int i = 0; i < MAX_IDS; i++) ids[i] = rand() % max_id;
+
+    int ref_len = format_sprintf(ids, MAX_IDS, ref, BUF_SIZE);
+    if (itoa_format_ids_scalar(ids, MAX_IDS, out, BUF_SIZE) != ref_len || memcmp(ref, out, ref_len))
+        printf("Error: scalar output differs from sprintf\n");
+#ifdef __AVX2__
+    if (itoa_format_ids_avx2(ids, MAX_IDS, out, BUF_SIZE) != ref_len || memcmp(ref, out, ref_len))
+        printf("Error: AVX2 output differs from sprintf\n");
+#endif
+
+    printf("Ids uniform in [0, %d), cycles per id\n", max_id);
+    printf("%6s %10s %10s %10s\n", "n", "sprintf", "scalar", "avx2");
+    for (int n = 1; n <= MAX_IDS; n *= 2) {
+        printf("%6d %10.1f %10.1f", n,
+               cycles_per_id(format_sprintf, ids, n, iterations, out),
+               cycles_per_id(itoa_format_ids_scalar, ids, n, iterations, out));
+#ifdef __AVX2__
+        printf(" %10.1f\n", cycles_per_id(itoa_format_ids_avx2, ids, n, iterations, out));
+#else
+        printf(" %10s\n", "-");
+#endif
+    }
+    return 0;
+}
+
+// Build with: make bench
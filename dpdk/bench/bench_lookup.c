@@ -0,0 +1,125 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <rte_eal.h>
+#include <rte_cycles.h>
+#include <rte_hash.h>
+#include <rte_jhash.h>
+#include <cjson/cJSON.h>
+
+#include "../trie.h"
+#include "../vocab.h"
+
+// Compares the original char-mode lookup (one rte_hash probe with a zero-padded
+// 32-byte key per input byte) against longest-match over the double-array trie.
+//
+// Usage: bench_lookup [EAL args] -- <vocab.json> <text file> [iterations]
+
+#define KEY_LEN 32
+
+static struct rte_hash *build_hash(cJSON *json, int count) {
+    struct rte_hash_parameters params = {
+        .name = "bench_hash",
+        .entries = count * 2 > 1024 ? count * 2 : 1024,
+        .key_len = KEY_LEN,
+        .hash_func = rte_jhash,
+        .hash_func_init_val = 0,
+    };
+    struct rte_hash *h = rte_hash_create(&params);
+    if (!h) return NULL;
+    cJSON *item;
+    cJSON_ArrayForEach(item, json) {
+        char key[KEY_LEN] = {0};
+        size_t len = strlen(item->string);
+        memcpy(key, item->string, len > KEY_LEN ? KEY_LEN : len);
+        rte_hash_add_key_data(h, key, (void *)(uintptr_t)item->valueint);
+    }
+    return h;
+}
+
+static uint64_t run_hash(const struct rte_hash *h, const uint8_t *text, size_t len, long *found) {
+    uint64_t start = rte_rdtsc();
+    for (size_t i = 0; i < len; i++) {
+        char key[KEY_LEN] = {0};
+        key[0] = text[i];
+        void *data;
+        if (rte_hash_lookup_data(h, key, &data) >= 0) (*found)++;
+    }
+    return rte_rdtsc() - start;
+}
+
+static uint64_t run_trie(const struct da_trie *trie, const uint8_t *text, size_t len, long *found) {
+    uint64_t start = rte_rdtsc();
+    size_t i = 0;
+    while (i < len) {
+        int id;
+        size_t match = da_trie_longest(trie, text + i, len - i, &id);
+        if (match) {
+            (*found)++;
+            i += match;
+        } else {
+            i++;
+        }
+    }
+    return rte_rdtsc() - start;
+}
+
+int main(int argc, char **argv) {
+    int ret = rte_eal_init(argc, argv);
+    if (ret < 0) rte_exit(EXIT_FAILURE, "Error with EAL initialization\n");
+    argc -= ret;
+    argv += ret;
+    if (argc < 3) rte_exit(EXIT_FAILURE, "Usage: %s [EAL args] -- <vocab.json> <text file> [iterations]\n", argv[0]);
+    int iterations = argc > 3 ? atoi(argv[3]) : 10;
+
+    long vocab_size, text_len;
+    char *vocab_data = vocab_read_file(argv[1], &vocab_size);
+    char *text = vocab_read_file(argv[2], &text_len);
+    if (!vocab_data || !text) rte_exit(EXIT_FAILURE, "Failed to read input files\n");
+    cJSON *json = cJSON_Parse(vocab_data);
+    if (!json) rte_exit(EXIT_FAILURE, "Failed to parse %s\n", argv[1]);
+
+    int count = cJSON_GetArraySize(json);
+    struct vocab_token *tokens = calloc(count, sizeof(*tokens));
+    int n = 0;
+    cJSON *item;
+    cJSON_ArrayForEach(item, json) {
+        if (!item->string[0]) continue;
+        tokens[n].bytes = (const uint8_t *)item->string;
+        tokens[n].len = strlen(item->string);
+        tokens[n].id = item->valueint;
+        n++;
+    }
+
+    uint64_t t0 = rte_rdtsc();
+    struct rte_hash *h = build_hash(json, count);
+    uint64_t t1 = rte_rdtsc();
+    struct da_trie *trie = da_trie_build(tokens, n);
+    uint64_t t2 = rte_rdtsc();
+    if (!h || !trie) rte_exit(EXIT_FAILURE, "Failed to build indexes\n");
+    printf("Vocabulary: %d tokens, max length %u bytes\n", n, trie->max_len);
+    printf("Build: rte_hash %lu cycles, trie %lu cycles (%u nodes, %lu KB)\n",
+           t1 - t0, t2 - t1, trie->size, trie->size * sizeof(struct da_node) / 1024);
+
+    uint64_t hash_cycles = 0, trie_cycles = 0;
+    long hash_found = 0, trie_found = 0;
+    for (int it = 0; it < iterations; it++) {
+        hash_cycles += run_hash(h, (const uint8_t *)text, text_len, &hash_found);
+        trie_cycles += run_trie(trie, (const uint8_t *)text, text_len, &trie_found);
+    }
+    double bytes = (double)text_len * iterations;
+    printf("%-10s %12s %12s %14s\n", "index", "bytes/cycle", "cycles/byte", "tokens/iter");
+    printf("%-10s %12.4f %12.2f %14ld\n", "rte_hash", bytes / hash_cycles, hash_cycles / bytes, hash_found / iterations);
+    printf("%-10s %12.4f %12.2f %14ld\n", "trie", bytes / trie_cycles, trie_cycles / bytes, trie_found / iterations);
+
+    da_trie_free(trie);
+    rte_hash_free(h);
+    cJSON_Delete(json);
+    free(tokens);
+    free(text);
+    free(vocab_data);
+    rte_eal_cleanup();
+    return 0;
+}
+
+// Build with: make bench
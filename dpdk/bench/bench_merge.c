@@ -0,0 +1,120 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <rte_eal.h>
+#include <rte_cycles.h>
+#include <rte_prefetch.h>
+
+#include "../bpe.h"
+#include "../vocab.h"
+
+// Compares ways of finding the initial merge ranks of every piece, as
+// bpe_encode_word does: one probe per byte pair (what the server does),
+// prefetching the slots of all pairs of a piece before probing them, and
+// prefetching the slots of the piece PREFETCH_AHEAD pieces later. Each line
+// of the text file stands for one request; its space-separated words, with
+// their leading space, stand for pre-tokenizer pieces.
+//
+// Usage: bench_merge [EAL args] -- <BPE image or vocab.json> <text file> [iterations]
+
+#define MAX_PIECES (1 << 20)
+#define PREFETCH_AHEAD 4
+
+// A piece is n token ids from parts + off.
+struct piece {
+    uint32_t off;
+    uint32_t n;
+};
+
+static inline void prefetch_piece(const struct bpe *bpe, const int *parts, const struct piece *pc) {
+    for (uint32_t i = 0; i + 1 < pc->n; i++) {
+        uint64_t key = (uint64_t)parts[i] << 32 | (uint32_t)parts[i + 1];
+        rte_prefetch0(&bpe->merges[vocab_merge_slot(key) & bpe->merge_mask]);
+    }
+}
+
+enum variant { PER_KEY, PREFETCH_PIECE, PREFETCH_NEXT, NB_VARIANTS };
+
+static const char *const variant_names[NB_VARIANTS] = { "per-key", "piece", "ahead" };
+
+static uint64_t run(enum variant v, const struct bpe *bpe, const int *parts, const struct piece *pieces,
+                    int nb_pieces, uint64_t *sum) {
+    uint32_t ranks[BPE_MAX_WORD];
+    int merged[BPE_MAX_WORD];
+    uint64_t start = rte_rdtsc();
+    for (int p = 0; p < nb_pieces; p++) {
+        const struct piece *pc = &pieces[p];
+        const int *pp = parts + pc->off;
+        if (v == PREFETCH_PIECE) prefetch_piece(bpe, pp, pc);
+        else if (v == PREFETCH_NEXT && p + PREFETCH_AHEAD < nb_pieces) {
+            const struct piece *ahead = &pieces[p + PREFETCH_AHEAD];
+            prefetch_piece(bpe, parts + ahead->off, ahead);
+        }
+        for (uint32_t i = 0; i + 1 < pc->n; i++) ranks[i] = bpe_merge_lookup(bpe, pp[i], pp[i + 1], &merged[i]);
+        for (uint32_t i = 0; i + 1 < pc->n; i++) *sum += ranks[i];
+    }
+    return rte_rdtsc() - start;
+}
+
+int main(int argc, char **argv) {
+    int ret = rte_eal_init(argc, argv);
+    if (ret < 0) rte_exit(EXIT_FAILURE, "Error with EAL initialization\n");
+    argc -= ret;
+    argv += ret;
+    if (argc < 3)
+        rte_exit(EXIT_FAILURE, "Usage: %s [EAL args] -- <BPE image or vocab.json> <text file> [iterations]\n", argv[0]);
+    int iterations = argc > 3 ? atoi(argv[3]) : 10;
+
+    struct bpe *bpe = vocab_is_image(argv[1]) ? bpe_create_from_image(argv[1], BPE_PRETOK_GPT2)
+                                              : bpe_create_from_json(argv[1], NULL, BPE_PRETOK_GPT2);
+    long text_len;
+    char *text = vocab_read_file(argv[2], &text_len);
+    // One part per byte of text, so parts holds every piece back to back.
+    int *parts = text ? malloc((text_len + 1) * sizeof(*parts)) : NULL;
+    struct piece *pieces = calloc(MAX_PIECES, sizeof(*pieces));
+    if (!bpe || !text || !parts || !pieces) rte_exit(EXIT_FAILURE, "Failed to load inputs\n");
+
+    int nb_pieces = 0, nb_lines = 0;
+    long pairs = 0;
+    uint32_t used = 0;
+    for (long i = 0; i < text_len && nb_pieces < MAX_PIECES;) {
+        struct piece *pc = &pieces[nb_pieces];
+        pc->off = used;
+        pc->n = 0;
+        do {
+            parts[used + pc->n++] = bpe->byte_ids[(uint8_t)text[i++]];
+        } while (i < text_len && text[i] != ' ' && text[i] != '\n' && pc->n < BPE_MAX_WORD);
+        used += pc->n;
+        if (i < text_len && text[i] == '\n') {
+            nb_lines++;
+            i++;
+        }
+        pairs += pc->n - 1;
+        nb_pieces++;
+    }
+    if (!nb_lines) nb_lines = 1;
+    printf("Merge table: %u merges in %u slots (%u KB); %d pieces, %ld pairs, %d requests\n", bpe->nb_merges,
+           bpe->merge_mask + 1, (bpe->merge_mask + 1) * (unsigned)sizeof(struct vocab_merge) / 1024, nb_pieces,
+           pairs, nb_lines);
+
+    uint64_t cycles[NB_VARIANTS] = { 0 }, sums[NB_VARIANTS] = { 0 };
+    for (int it = 0; it < iterations; it++)
+        for (int v = 0; v < NB_VARIANTS; v++) cycles[v] += run(v, bpe, parts, pieces, nb_pieces, &sums[v]);
+    double hz = rte_get_tsc_hz();
+    printf("%-10s %14s %14s %12s\n", "lookup", "cycles/pair", "Mpairs/s", "Mreq/s");
+    for (int v = 0; v < NB_VARIANTS; v++) {
+        if (sums[v] != sums[PER_KEY]) rte_exit(EXIT_FAILURE, "Rank mismatch in %s\n", variant_names[v]);
+        double s = cycles[v] / hz;
+        printf("%-10s %14.2f %14.2f %12.3f\n", variant_names[v], (double)cycles[v] / iterations / pairs,
+               pairs * iterations / s / 1e6, (double)nb_lines * iterations / s / 1e6);
+    }
+
+    bpe_free(bpe);
+    free(pieces);
+    free(parts);
+    free(text);
+    rte_eal_cleanup();
+    return 0;
+}
+
+// Build with: make bench
@@ -0,0 +1,330 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#include <rte_eal.h>
+#include <rte_cycles.h>
+#include <rte_lcore.h>
+#include <cjson/cJSON.h>
+
+#include "../bpe.h"
+#include "../stream.h"
+#include "../trie.h"
+#include "../vocab.h"
+#include "../wcache.h"
+#include "../wordpiece.h"
+
+// Times the tokenizer engines on text in memory, with no port and no mbufs.
+// Each request is fed to stream_feed in one chunk, as tokenize() feeds a
+// request held in a single segment. Requests are cut from the text file at
+// word boundaries. They are either about LEN bytes long (--lengths) or
+// BATCH words long (--batches, the batch size of clients/), and every
+// engine runs over the same ones. Where perf_event is available, the
+// instructions and the L1D and last-level cache misses of the timed loop
+// are reported too.
+//
+// Usage: bench_tokenize [EAL args] -- [--lengths L,...] [--batches B,...] [--word-cache N] [--iterations N]
+//                       <text file> MODE:VOCAB[:MERGES]...
+// MODE is char, gpt2, llama3 or wordpiece, as for the server's --mode.
+
+#define MAX_IDS 8192            // MAX_SEQUENCE_LENGTH in tokenizer.c
+#define MAX_REQUESTS 65536
+#define MAX_SIZES 32
+#define WCACHE_ENTRIES 4096
+
+enum { PERF_INSTRUCTIONS, PERF_L1D_MISSES, PERF_LLC_MISSES, NB_PERF };
+
+struct bench_engine {
+    const char *spec;
+    stream_encode_fn encode;
+    const void *engine;
+    struct bpe *bpe;
+    struct wordpiece *wp;
+    struct da_trie *trie;
+    const struct vocab_image_header *image;
+};
+
+struct request {
+    uint32_t off;
+    uint32_t len;
+};
+
+static struct wcache *cache;
+static int perf_fd[NB_PERF] = { -1, -1, -1 };
+
+// The scan of char_encode_partial in tokenizer.c.
+static int char_encode(const void *engine, const char *text, size_t len, int final, size_t *consumed, int *ids,
+                       int max_ids) {
+    const struct da_trie *trie = engine;
+    const uint8_t *s = (const uint8_t *)text;
+    int n = 0;
+    size_t i = 0;
+    while (i < len && n < max_ids) {
+        if (!final && len - i < trie->max_len) break;
+        int id;
+        size_t match = da_trie_longest(trie, s + i, len - i, &id);
+        if (!match) {
+            i++;
+            continue;
+        }
+        ids[n++] = id;
+        i += match;
+    }
+    *consumed = i;
+    return n;
+}
+
+static int bpe_encode_stream(const void *engine, const char *text, size_t len, int final, size_t *consumed,
+                             int *ids, int max_ids) {
+    return bpe_encode_partial(engine, cache, text, len, final, consumed, ids, max_ids);
+}
+
+static int wordpiece_encode_stream(const void *engine, const char *text, size_t len, int final, size_t *consumed,
+                                   int *ids, int max_ids) {
+    return wordpiece_encode_partial(engine, cache, text, len, final, consumed, ids, max_ids);
+}
+
+static struct da_trie *char_trie_from_json(const char *json_file) {
+    long size;
+    char *json_data = vocab_read_file(json_file, &size);
+    if (!json_data) return NULL;
+    cJSON *json = cJSON_Parse(json_data);
+    int count = json ? cJSON_GetArraySize(json) : 0;
+    struct vocab_token *tokens = calloc(count ? count : 1, sizeof(*tokens));
+    struct da_trie *trie = NULL;
+    if (json && tokens) {
+        int n = 0;
+        cJSON *item;
+        cJSON_ArrayForEach(item, json) {
+            if (!item->string || !item->string[0]) continue;
+            tokens[n].bytes = (const uint8_t *)item->string;
+            tokens[n].len = strlen(item->string);
+            tokens[n].id = item->valueint;
+            n++;
+        }
+        trie = da_trie_build(tokens, n);
+    }
+    free(tokens);
+    cJSON_Delete(json);
+    free(json_data);
+    return trie;
+}
+
+// Parses MODE:VOCAB[:MERGES] in place and loads the engine.
+static int load_engine(struct bench_engine *be, char *spec) {
+    char *save;
+    be->spec = strdup(spec);
+    char *mode = strtok_r(spec, ":", &save);
+    char *vocab = strtok_r(NULL, ":", &save);
+    char *merges = strtok_r(NULL, ":", &save);
+    if (!mode || !vocab) return -1;
+    int image = vocab_is_image(vocab);
+    if (!strcmp(mode, "char")) {
+        if (image) {
+            be->image = vocab_image_open(vocab);
+            be->trie = be->image ? da_trie_from_image(be->image) : NULL;
+        } else {
+            be->trie = char_trie_from_json(vocab);
+        }
+        be->encode = char_encode;
+        be->engine = be->trie;
+    } else if (!strcmp(mode, "wordpiece")) {
+        be->wp = image ? wordpiece_create_from_image(vocab, 1) : wordpiece_create(vocab, 1);
+        be->encode = wordpiece_encode_stream;
+        be->engine = be->wp;
+    } else if (!strcmp(mode, "gpt2") || !strcmp(mode, "llama3")) {
+        enum bpe_pretok pretok = !strcmp(mode, "llama3") ? BPE_PRETOK_LLAMA3 : BPE_PRETOK_GPT2;
+        be->bpe = image ? bpe_create_from_image(vocab, pretok) : bpe_create_from_json(vocab, merges, pretok);
+        be->encode = bpe_encode_stream;
+        be->engine = be->bpe;
+    } else {
+        printf("Error: Unknown mode '%s'\n", mode);
+        return -1;
+    }
+    return be->engine ? 0 : -1;
+}
+
+static void free_engine(struct bench_engine *be) {
+    bpe_free(be->bpe);
+    wordpiece_free(be->wp);
+    if (be->trie) da_trie_free(be->trie);
+    if (be->image) vocab_image_close(be->image);
+    free((char *)be->spec);
+}
+
+static int perf_open(uint32_t type, uint64_t config) {
+    struct perf_event_attr attr = {
+        .type = type,
+        .size = sizeof(attr),
+        .config = config,
+        .disabled = 1,
+        .exclude_kernel = 1,
+        .exclude_hv = 1,
+    };
+    return syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+}
+
+static void perf_init(void) {
+    perf_fd[PERF_INSTRUCTIONS] = perf_open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+    perf_fd[PERF_L1D_MISSES] = perf_open(PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D |
+                                         PERF_COUNT_HW_CACHE_OP_READ << 8 | PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+    perf_fd[PERF_LLC_MISSES] = perf_open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES);
+    if (perf_fd[PERF_INSTRUCTIONS] < 0) printf("perf_event unavailable, counters are not reported\n");
+}
+
+static void perf_start(void) {
+    for (int k = 0; k < NB_PERF; k++) {
+        if (perf_fd[k] < 0) continue;
+        ioctl(perf_fd[k], PERF_EVENT_IOC_RESET, 0);
+        ioctl(perf_fd[k], PERF_EVENT_IOC_ENABLE, 0);
+    }
+}
+
+static void perf_stop(uint64_t *counts) {
+    for (int k = 0; k < NB_PERF; k++) {
+        uint64_t v = 0;
+        if (perf_fd[k] >= 0) {
+            ioctl(perf_fd[k], PERF_EVENT_IOC_DISABLE, 0);
+            if (read(perf_fd[k], &v, sizeof(v)) != sizeof(v)) v = 0;
+        }
+        counts[k] += v;
+    }
+}
+
+// Cuts consecutive requests from text: up to the first space at or after
+// size bytes, or size words, when by_words is set.
+static int cut_requests(const char *text, long text_len, int size, int by_words, struct request *reqs) {
+    int n = 0;
+    long i = 0;
+    while (i < text_len && n < MAX_REQUESTS) {
+        long start = i, words = 0;
+        while (i < text_len) {
+            if (text[i] == ' ' && (by_words ? ++words >= size : i - start >= size)) break;
+            i++;
+        }
+        if (i - start > MAX_IDS) break;
+        reqs[n].off = start;
+        reqs[n].len = i - start;
+        n++;
+        while (i < text_len && text[i] == ' ') i++;
+    }
+    return n;
+}
+
+static uint64_t run(const struct bench_engine *be, const char *text, const struct request *reqs, int nb_reqs,
+                    uint64_t *nb_ids) {
+    static int ids[MAX_IDS];
+    struct tok_stream st;
+    uint64_t start = rte_rdtsc();
+    for (int r = 0; r < nb_reqs; r++) {
+        stream_init(&st, be->encode, be->engine, ids, MAX_IDS);
+        stream_feed(&st, text + reqs[r].off, reqs[r].len, 1);
+        *nb_ids += st.nb_ids;
+    }
+    return rte_rdtsc() - start;
+}
+
+static void bench(const struct bench_engine *be, const char *text, const struct request *reqs, int nb_reqs,
+                  const char *unit, int size, int iterations) {
+    uint64_t bytes = 0, nb_ids = 0, warm_ids = 0, cycles = 0, counts[NB_PERF] = { 0 };
+    for (int r = 0; r < nb_reqs; r++) bytes += reqs[r].len;
+    run(be, text, reqs, nb_reqs, &warm_ids);    // fills the word cache
+    for (int it = 0; it < iterations; it++) {
+        perf_start();
+        cycles += run(be, text, reqs, nb_reqs, &nb_ids);
+        perf_stop(counts);
+    }
+    double ns = (double)cycles * 1e9 / rte_get_tsc_hz();
+    double total_bytes = (double)bytes * iterations;
+    printf("%-28.28s %6s %6d %8d %9.1f %9.1f %10.1f %8.3f %8.2f", be->spec, unit, size, nb_reqs,
+           (double)bytes / nb_reqs, (double)nb_ids / iterations / nb_reqs, ns / iterations / nb_reqs,
+           ns / total_bytes, nb_ids ? ns / nb_ids : 0.0);
+    if (perf_fd[PERF_INSTRUCTIONS] >= 0)
+        printf(" %9.1f %10.2f %10.3f", counts[PERF_INSTRUCTIONS] / total_bytes,
+               counts[PERF_L1D_MISSES] * 1024 / total_bytes, counts[PERF_LLC_MISSES] * 1024 / total_bytes);
+    printf("\n");
+}
+
+static int parse_sizes(char *list, int *sizes) {
+    int n = 0;
+    char *save;
+    for (char *s = strtok_r(list, ",", &save); s && n < MAX_SIZES; s = strtok_r(NULL, ",", &save)) {
+        sizes[n] = atoi(s);
+        if (sizes[n] <= 0) return -1;
+        n++;
+    }
+    return n;
+}
+
+int main(int argc, char **argv) {
+    int ret = rte_eal_init(argc, argv);
+    if (ret < 0) rte_exit(EXIT_FAILURE, "Error with EAL initialization\n");
+    argc -= ret;
+    argv += ret;
+
+    char default_lengths[] = "16,64,256,1024,4096", default_batches[] = "1,8,32,128";
+    char *lengths = default_lengths, *batches = default_batches;
+    uint32_t wcache_entries = WCACHE_ENTRIES;
+    int iterations = 10, arg = 1;
+    for (; arg + 1 < argc && !strncmp(argv[arg], "--", 2); arg += 2) {
+        if (!strcmp(argv[arg], "--lengths")) lengths = argv[arg + 1];
+        else if (!strcmp(argv[arg], "--batches")) batches = argv[arg + 1];
+        else if (!strcmp(argv[arg], "--word-cache")) wcache_entries = atoi(argv[arg + 1]);
+        else if (!strcmp(argv[arg], "--iterations")) iterations = atoi(argv[arg + 1]);
+        else break;
+    }
+    int lens[MAX_SIZES], bats[MAX_SIZES];
+    int nb_lens = parse_sizes(lengths, lens), nb_bats = parse_sizes(batches, bats);
+    if (argc - arg < 2 || nb_lens < 0 || nb_bats < 0 || iterations <= 0)
+        rte_exit(EXIT_FAILURE,
+                 "Usage: %s [EAL args] -- [--lengths L,...] [--batches B,...] [--word-cache N] [--iterations N] "
+                 "<text file> MODE:VOCAB[:MERGES]...\n", argv[0]);
+
+    long text_len;
+    char *text = vocab_read_file(argv[arg], &text_len);
+    if (!text) rte_exit(EXIT_FAILURE, "Failed to read %s\n", argv[arg]);
+    for (long i = 0; i < text_len; i++)
+        if (text[i] == '\n') text[i] = ' ';
+    int nb_engines = argc - arg - 1;
+    struct bench_engine *engines = calloc(nb_engines, sizeof(*engines));
+    struct request *reqs = calloc(MAX_REQUESTS, sizeof(*reqs));
+    if (!engines || !reqs) rte_exit(EXIT_FAILURE, "Out of memory\n");
+    for (int e = 0; e < nb_engines; e++)
+        if (load_engine(&engines[e], argv[arg + 1 + e]) < 0)
+            rte_exit(EXIT_FAILURE, "Failed to load %s\n", argv[arg + 1 + e]);
+    if (wcache_entries) {
+        cache = wcache_create(wcache_entries, rte_socket_id());
+        if (!cache) rte_exit(EXIT_FAILURE, "Failed to create word cache\n");
+    }
+    perf_init();
+
+    printf("%-28s %6s %6s %8s %9s %9s %10s %8s %8s", "engine", "unit", "size", "requests", "bytes/req", "ids/req",
+           "ns/req", "ns/byte", "ns/id");
+    if (perf_fd[PERF_INSTRUCTIONS] >= 0) printf(" %9s %10s %10s", "insn/byte", "L1D/KB", "LLC/KB");
+    printf("\n");
+    for (int e = 0; e < nb_engines; e++) {
+        for (int s = 0; s < nb_lens; s++) {
+            int n = cut_requests(text, text_len, lens[s], 0, reqs);
+            if (n) bench(&engines[e], text, reqs, n, "bytes", lens[s], iterations);
+        }
+        for (int s = 0; s < nb_bats; s++) {
+            int n = cut_requests(text, text_len, bats[s], 1, reqs);
+            if (n) bench(&engines[e], text, reqs, n, "words", bats[s], iterations);
+        }
+    }
+
+    for (int k = 0; k < NB_PERF; k++)
+        if (perf_fd[k] >= 0) close(perf_fd[k]);
+    wcache_free(cache);
+    for (int e = 0; e < nb_engines; e++) free_engine(&engines[e]);
+    free(engines);
+    free(reqs);
+    free(text);
+    rte_eal_cleanup();
+    return 0;
+}
+
+// Build with: make bench
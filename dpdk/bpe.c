@@ -0,0 +1,460 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <rte_common.h>
+#include <rte_malloc.h>
+#include <cjson/cJSON.h>
+
+#include "bpe.h"
+#include "utf8.h"
+#include "trie.h"
+#include "vocab.h"
+#include "wcache.h"
+
+
+// GPT-2 maps every byte to a printable code point so vocabulary keys are
+// valid strings: printable Latin-1 bytes map to themselves, the rest to
+// 256 + n in byte order.
+static void byte_unicode_table(int16_t cp_to_byte[512]) {
+    int n = 0;
+    for (int cp = 0; cp < 512; cp++) cp_to_byte[cp] = -1;
+    for (int b = 0; b < 256; b++) {
+        if ((b >= '!' && b <= '~') || (b >= 0xA1 && b <= 0xAC) || (b >= 0xAE && b <= 0xFF))
+            cp_to_byte[b] = b;
+        else
+            cp_to_byte[256 + n++] = b;
+    }
+}
+
+// Maps a byte-level token back to its bytes, at most cap of them. Returns
+// -1 for code points outside the byte alphabet or a token longer than cap.
+static int decode_token(const int16_t *cp_to_byte, const char *key, size_t key_len, uint8_t *out, size_t cap) {
+    const uint8_t *s = (const uint8_t *)key;
+    int n = 0;
+    size_t i = 0;
+    while (i < key_len) {
+        size_t cp_len;
+        uint32_t cp = utf8_decode(s, key_len, i, &cp_len);
+        if (cp >= 512 || cp_to_byte[cp] < 0 || (size_t)n == cap) return -1;
+        out[n++] = cp_to_byte[cp];
+        i += cp_len;
+    }
+    return n;
+}
+
+static int token_cmp(const void *a, const void *b) {
+    const struct vocab_token *x = a, *y = b;
+    uint32_t n = x->len < y->len ? x->len : y->len;
+    int c = memcmp(x->bytes, y->bytes, n);
+    if (c) return c;
+    return (x->len > y->len) - (x->len < y->len);
+}
+
+static int token_find(const struct vocab_token *sorted, int count, const uint8_t *bytes, uint32_t len) {
+    struct vocab_token key = { .bytes = bytes, .len = len };
+    const struct vocab_token *t = bsearch(&key, sorted, count, sizeof(*sorted), token_cmp);
+    return t ? t->id : -1;
+}
+
+static int load_merges(const char *merges_file, const int16_t *cp_to_byte,
+                       const struct vocab_token *sorted, int count, uint64_t *keys, uint64_t *vals, size_t max_pairs) {
+    long size;
+    char *data = vocab_read_file(merges_file, &size);
+    if (!data) return -1;
+    uint8_t left[BPE_MAX_WORD * 2], right[BPE_MAX_WORD];
+    uint32_t rank = 0;
+    int nb = 0;
+    char *save = NULL;
+    for (char *line = strtok_r(data, "\r\n", &save); line && (size_t)nb < max_pairs; line = strtok_r(NULL, "\r\n", &save)) {
+        if (!strncmp(line, "#version", 8)) continue;
+        char *sep = strchr(line, ' ');
+        if (!sep) continue;
+        // Longer tokens never take part in a merge, as the pieces are cut
+        // at BPE_MAX_WORD bytes; left keeps room for right after it.
+        int l = decode_token(cp_to_byte, line, sep - line, left, BPE_MAX_WORD);
+        int r = decode_token(cp_to_byte, sep + 1, strlen(sep + 1), right, BPE_MAX_WORD);
+        if (l <= 0 || r <= 0) {
+            rank++;
+            continue;
+        }
+        int a = token_find(sorted, count, left, l);
+        int b = token_find(sorted, count, right, r);
+        memcpy(left + l, right, r);
+        int m = token_find(sorted, count, left, l + r);
+        if (a >= 0 && b >= 0 && m >= 0) {
+            keys[nb] = (uint64_t)a << 32 | (uint32_t)b;
+            vals[nb] = (uint64_t)rank << 32 | (uint32_t)m;
+            nb++;
+        }
+        rank++;
+    }
+    free(data);
+    return nb;
+}
+
+// Every split of a token into two vocabulary entries becomes a merge whose
+// rank is the merged token's id (tiktoken semantics).
+static int derive_merges(const struct vocab_token *tokens, const struct vocab_token *sorted, int count,
+                         uint64_t *keys, uint64_t *vals) {
+    int nb = 0;
+    for (int i = 0; i < count; i++) {
+        const struct vocab_token *t = &tokens[i];
+        for (uint32_t k = 1; k < t->len; k++) {
+            int a = token_find(sorted, count, t->bytes, k);
+            if (a < 0) continue;
+            int b = token_find(sorted, count, t->bytes + k, t->len - k);
+            if (b < 0) continue;
+            keys[nb] = (uint64_t)a << 32 | (uint32_t)b;
+            vals[nb] = (uint64_t)(uint32_t)t->id << 32 | (uint32_t)t->id;
+            nb++;
+        }
+    }
+    return nb;
+}
+
+// Resolves the Llama-3 special tokens once bpe->words is set. A tiktoken
+// vocabulary without them, like the cl100k_base ranks of
+// vocab/llama3_vocab.json, encodes with no BOS.
+static void llama3_init(struct bpe *bpe) {
+    static const char bos[] = "<|begin_of_text|>";
+    bpe->bos_id = da_trie_lookup(bpe->words, (const uint8_t *)bos, sizeof(bos) - 1);
+    if (bpe->bos_id < 0) printf("Warning: Vocabulary has no %s, encodings start without it\n", bos);
+}
+
+struct bpe *bpe_create_from_json(const char *vocab_file, const char *merges_file, enum bpe_pretok pretok) {
+    printf("Creating BPE tokenizer from %s...\n", vocab_file);
+    long size;
+    char *json_data = vocab_read_file(vocab_file, &size);
+    if (!json_data) return NULL;
+    cJSON *json = cJSON_Parse(json_data);
+    if (!json) {
+        printf("Error: Failed to parse JSON: %s\n", cJSON_GetErrorPtr());
+        free(json_data);
+        return NULL;
+    }
+
+    int16_t cp_to_byte[512];
+    byte_unicode_table(cp_to_byte);
+
+    int count = cJSON_GetArraySize(json);
+    struct vocab_token *tokens = calloc(count, sizeof(*tokens));
+    struct vocab_token *sorted = calloc(count, sizeof(*tokens));
+    uint8_t *pool = malloc(size);
+    struct bpe *bpe = rte_zmalloc("bpe", sizeof(*bpe), 0);
+    uint64_t *keys = NULL, *vals = NULL;
+    if (!tokens || !sorted || !pool || !bpe) goto fail;
+
+    bpe->pretok = pretok;
+    bpe->bos_id = -1;
+    bpe->cache_tag = wcache_new_tag();
+    for (int b = 0; b < 256; b++) bpe->byte_ids[b] = -1;
+    int n = 0;
+    size_t used = 0;
+    size_t max_pairs = 0;
+    cJSON *item;
+    cJSON_ArrayForEach(item, json) {
+        int len = decode_token(cp_to_byte, item->string, strlen(item->string), pool + used, size - used);
+        if (len <= 0) {
+            printf("Warning: Skipping token '%s' outside the byte alphabet\n", item->string);
+            continue;
+        }
+        tokens[n].bytes = pool + used;
+        tokens[n].len = len;
+        tokens[n].id = item->valueint;
+        if (len == 1) bpe->byte_ids[pool[used]] = item->valueint;
+        if ((uint32_t)item->valueint >= bpe->vocab_size) bpe->vocab_size = item->valueint + 1;
+        max_pairs += len - 1;
+        used += len;
+        n++;
+    }
+    cJSON_Delete(json);
+    json = NULL;
+    for (int b = 0; b < 256; b++) {
+        if (bpe->byte_ids[b] < 0) {
+            printf("Error: Vocabulary has no token for byte 0x%02x\n", b);
+            goto fail;
+        }
+    }
+
+    memcpy(sorted, tokens, n * sizeof(*tokens));
+    qsort(sorted, n, sizeof(*sorted), token_cmp);
+
+    keys = malloc((max_pairs + 1) * sizeof(*keys));
+    vals = malloc((max_pairs + 1) * sizeof(*vals));
+    if (!keys || !vals) goto fail;
+    int nb = merges_file ? load_merges(merges_file, cp_to_byte, sorted, n, keys, vals, max_pairs)
+                         : derive_merges(tokens, sorted, n, keys, vals);
+    if (nb < 0) goto fail;
+    if (!merges_file && pretok == BPE_PRETOK_GPT2)
+        printf("Warning: No merges file, GPT-2 merges are derived from token ids; pass vocab/gpt2_merges.txt\n");
+
+    uint32_t slots = 64;
+    while (slots < 2 * (uint32_t)nb) slots *= 2;
+    struct vocab_merge *table = rte_malloc("bpe_merges", slots * sizeof(*table), RTE_CACHE_LINE_SIZE);
+    if (!table) {
+        printf("Error: Failed to create merge table\n");
+        goto fail;
+    }
+    memset(table, 0xFF, slots * sizeof(*table));
+    bpe->merges = table;
+    bpe->merge_mask = slots - 1;
+    for (int i = 0; i < nb; i++) {
+        // Keep the first (lowest rank) entry for a repeated pair.
+        uint32_t k = vocab_merge_slot(keys[i]) & bpe->merge_mask;
+        while (table[k].key != VOCAB_MERGE_EMPTY && table[k].key != keys[i]) k = (k + 1) & bpe->merge_mask;
+        if (table[k].key == VOCAB_MERGE_EMPTY) table[k] = (struct vocab_merge){ keys[i], vals[i] };
+    }
+    bpe->nb_merges = nb;
+    if (pretok == BPE_PRETOK_LLAMA3) {
+        if (!(bpe->words = da_trie_build(tokens, n))) goto fail;
+        llama3_init(bpe);
+    }
+    printf("Loaded %d tokens and %d merges\n", n, nb);
+
+    free(keys);
+    free(vals);
+    free(pool);
+    free(sorted);
+    free(tokens);
+    free(json_data);
+    return bpe;
+
+fail:
+    free(keys);
+    free(vals);
+    free(pool);
+    free(sorted);
+    free(tokens);
+    cJSON_Delete(json);
+    free(json_data);
+    bpe_free(bpe);
+    return NULL;
+}
+
+struct bpe *bpe_create_from_image(const char *image_file, enum bpe_pretok pretok) {
+    printf("Loading BPE vocabulary image %s...\n", image_file);
+    const struct vocab_image_header *img = vocab_image_open(image_file);
+    if (!img) return NULL;
+    if (!(img->flags & VOCAB_IMAGE_BYTE_LEVEL)) {
+        printf("Error: '%s' is not a byte-level BPE image\n", image_file);
+        vocab_image_close(img);
+        return NULL;
+    }
+    struct bpe *bpe = rte_zmalloc("bpe", sizeof(*bpe), 0);
+    if (!bpe) {
+        vocab_image_close(img);
+        return NULL;
+    }
+    bpe->image = img;
+    bpe->pretok = pretok;
+    bpe->bos_id = -1;
+    bpe->cache_tag = wcache_new_tag();
+    memcpy(bpe->byte_ids, img->byte_ids, sizeof(bpe->byte_ids));
+    for (int b = 0; b < 256; b++) {
+        if (bpe->byte_ids[b] < 0) {
+            printf("Error: Vocabulary has no token for byte 0x%02x\n", b);
+            goto fail;
+        }
+    }
+    bpe->merges = (const struct vocab_merge *)((const uint8_t *)img + img->merge_off);
+    bpe->merge_mask = img->merge_slots - 1;
+    bpe->vocab_size = img->vocab_size;
+    bpe->nb_merges = img->nb_merges;
+    if (pretok == BPE_PRETOK_LLAMA3) {
+        if (!(bpe->words = da_trie_from_image(img))) goto fail;
+        llama3_init(bpe);
+    }
+    printf("Loaded %u tokens and %u merges\n", img->nb_keys, img->nb_merges);
+    return bpe;
+
+fail:
+    bpe_free(bpe);
+    return NULL;
+}
+
+void bpe_free(struct bpe *bpe) {
+    if (!bpe) return;
+    if (!bpe->image) rte_free((void *)bpe->merges);
+    da_trie_free(bpe->words);
+    vocab_image_close(bpe->image);
+    rte_free(bpe);
+}
+
+static int bpe_encode_word(const struct bpe *bpe, const uint8_t *w, size_t len, int *ids, int max_ids) {
+    int parts[BPE_MAX_WORD];
+    int merged[BPE_MAX_WORD];
+    uint32_t ranks[BPE_MAX_WORD];
+    int n = len;
+
+    for (int i = 0; i < n; i++) parts[i] = bpe->byte_ids[w[i]];
+    for (int i = 0; i < n - 1; i++) ranks[i] = bpe_merge_lookup(bpe, parts[i], parts[i + 1], &merged[i]);
+
+    while (n > 1) {
+        int best = 0;
+        for (int i = 1; i < n - 1; i++)
+            if (ranks[i] < ranks[best]) best = i;
+        if (ranks[best] == BPE_NO_RANK) break;
+
+        parts[best] = merged[best];
+        memmove(&parts[best + 1], &parts[best + 2], (n - best - 2) * sizeof(*parts));
+        memmove(&ranks[best + 1], &ranks[best + 2], (n - best - 2) * sizeof(*ranks));
+        memmove(&merged[best + 1], &merged[best + 2], (n - best - 2) * sizeof(*merged));
+        n--;
+        if (best > 0) ranks[best - 1] = bpe_merge_lookup(bpe, parts[best - 1], parts[best], &merged[best - 1]);
+        if (best < n - 1) ranks[best] = bpe_merge_lookup(bpe, parts[best], parts[best + 1], &merged[best]);
+    }
+
+    if (n > max_ids) n = max_ids;
+    memcpy(ids, parts, n * sizeof(*ids));
+    return n;
+}
+
+// GPT-2 pre-tokenizer:
+//   's|'t|'re|'ve|'m|'ll|'d| ?\p{L}+| ?\p{N}+| ?[^\s\p{L}\p{N}]+|\s+(?!\S)|\s+
+// Returns the end offset of the piece starting at i.
+static size_t gpt2_split(const uint8_t *s, size_t len, size_t i) {
+    size_t cp_len;
+    if (s[i] == '\'' && i + 1 < len) {
+        uint8_t c = s[i + 1];
+        if (c == 's' || c == 't' || c == 'm' || c == 'd') return i + 2;
+        if (i + 2 < len) {
+            uint8_t d = s[i + 2];
+            if ((c == 'r' && d == 'e') || (c == 'v' && d == 'e') || (c == 'l' && d == 'l')) return i + 3;
+        }
+    }
+
+    size_t j = (s[i] == ' ' && i + 1 < len) ? i + 1 : i;
+    enum uc_class cls = utf8_class_at(s, len, j, &cp_len);
+    if (cls != UC_SPACE) {
+        j += cp_len;
+        while (j < len) {
+            enum uc_class next = utf8_class_at(s, len, j, &cp_len);
+            if (next != cls) break;
+            j += cp_len;
+        }
+        return j;
+    }
+
+    // Whitespace run: leave the last whitespace character for the next piece
+    // unless the run ends the text.
+    size_t last = i;
+    j = i;
+    while (j < len && utf8_class_at(s, len, j, &cp_len) == UC_SPACE) {
+        last = j;
+        j += cp_len;
+    }
+    if (j == len || last == i) return j;
+    return last;
+}
+
+static inline int is_newline(uint8_t c) {
+    return c == '\r' || c == '\n';
+}
+
+// Llama-3 (tiktoken) pre-tokenizer:
+//   (?i:'s|'t|'re|'ve|'m|'ll|'d)|[^\r\n\p{L}\p{N}]?\p{L}+|\p{N}{1,3}|
+//    ?[^\s\p{L}\p{N}]+[\r\n]*|\s*[\r\n]+|\s+(?!\S)|\s+
+static size_t llama3_split(const uint8_t *s, size_t len, size_t i) {
+    size_t cp_len, next_len;
+    if (s[i] == '\'' && i + 1 < len) {
+        uint8_t c = s[i + 1] | 0x20;
+        if (c == 's' || c == 't' || c == 'm' || c == 'd') return i + 2;
+        if (i + 2 < len) {
+            uint8_t d = s[i + 2] | 0x20;
+            if ((c == 'r' && d == 'e') || (c == 'v' && d == 'e') || (c == 'l' && d == 'l')) return i + 3;
+        }
+    }
+
+    enum uc_class cls = utf8_class_at(s, len, i, &cp_len);
+    size_t j = i + cp_len;
+    if (cls == UC_LETTER || (cls != UC_NUMBER && !is_newline(s[i]) && j < len &&
+                             utf8_class_at(s, len, j, &next_len) == UC_LETTER)) {
+        while (j < len && utf8_class_at(s, len, j, &next_len) == UC_LETTER) j += next_len;
+        return j;
+    }
+    if (cls == UC_NUMBER) {
+        for (int k = 1; k < 3 && j < len && utf8_class_at(s, len, j, &next_len) == UC_NUMBER; k++) j += next_len;
+        return j;
+    }
+
+    j = (s[i] == ' ' && i + 1 < len) ? i + 1 : i;
+    if (utf8_class_at(s, len, j, &cp_len) == UC_OTHER) {
+        j += cp_len;
+        while (j < len && utf8_class_at(s, len, j, &next_len) == UC_OTHER) j += next_len;
+        while (j < len && is_newline(s[j])) j++;
+        return j;
+    }
+
+    // Whitespace run: end after its last newline if it has one, otherwise
+    // leave the last whitespace character for the next piece.
+    size_t last = i, nl_end = 0;
+    j = i;
+    while (j < len && utf8_class_at(s, len, j, &cp_len) == UC_SPACE) {
+        last = j;
+        j += cp_len;
+        if (is_newline(s[last])) nl_end = j;
+    }
+    if (nl_end) return nl_end;
+    if (j == len || last == i) return j;
+    return last;
+}
+
+// Start of the whitespace run that ends s[0, len), or len when there is none.
+static size_t trailing_space(const uint8_t *s, size_t len) {
+    size_t j = len, cp_len;
+    while (j > 0) {
+        size_t k = j - 1;
+        while (k > 0 && j - k < 4 && (s[k] & 0xC0) == 0x80) k--;
+        if (utf8_class_at(s, j, k, &cp_len) != UC_SPACE || k + cp_len != j) break;
+        j = k;
+    }
+    return j;
+}
+
+int bpe_encode_partial(const struct bpe *bpe, struct wcache *cache, const char *text, size_t len, int final,
+                       size_t *consumed, int *ids, int max_ids) {
+    const uint8_t *s = (const uint8_t *)text;
+    int n = 0;
+    size_t i = 0, safe = len;
+    if (!final) {
+        // A piece is settled once the splitter has seen what follows it: the
+        // contractions look two bytes ahead, and a trailing whitespace run can
+        // still change how the run before it is split.
+        len = utf8_complete_len(s, len);
+        safe = len < BPE_LOOKAHEAD ? 0 : RTE_MIN(len - BPE_LOOKAHEAD, trailing_space(s, len));
+    }
+    while (i < len && n < max_ids) {
+        size_t end = bpe->pretok == BPE_PRETOK_LLAMA3 ? llama3_split(s, len, i) : gpt2_split(s, len, i);
+        if (end > safe) break;
+        if (bpe->words) {
+            int id = da_trie_lookup(bpe->words, s + i, end - i);
+            if (id >= 0) {
+                ids[n++] = id;
+                i = end;
+                continue;
+            }
+        }
+        if (cache) {
+            int hit = wcache_lookup(cache, bpe->cache_tag, s + i, end - i, ids + n, max_ids - n);
+            if (hit >= 0) {
+                n += hit;
+                i = end;
+                continue;
+            }
+        }
+        int first = n;
+        for (size_t k = i; k < end && n < max_ids; k += BPE_MAX_WORD) {
+            size_t w = end - k < BPE_MAX_WORD ? end - k : BPE_MAX_WORD;
+            n += bpe_encode_word(bpe, s + k, w, ids + n, max_ids - n);
+        }
+        if (cache && n < max_ids) wcache_insert(cache, bpe->cache_tag, s + i, end - i, ids + first, n - first);
+        i = end;
+    }
+    *consumed = i;
+    return n;
+}
+
+int bpe_encode(const struct bpe *bpe, const char *text, size_t len, int *ids, int max_ids) {
+    size_t consumed;
+    return bpe_encode_partial(bpe, NULL, text, len, 1, &consumed, ids, max_ids);
+}
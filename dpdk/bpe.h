@@ -0,0 +1,84 @@
+#ifndef BPE_H
+#define BPE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "vocab.h"
+
+#define BPE_MAX_WORD 256
+#define BPE_LOOKAHEAD 2     // bytes the pre-tokenizer may read past a piece
+#define BPE_NO_RANK UINT32_MAX
+
+struct da_trie;
+struct wcache;
+
+enum bpe_pretok {
+    BPE_PRETOK_GPT2,
+    BPE_PRETOK_LLAMA3,
+};
+
+struct bpe {
+    enum bpe_pretok pretok;
+    int byte_ids[256];          // raw byte -> base token id
+    const struct vocab_merge *merges;   // open addressing, see vocab.h
+    uint32_t merge_mask;
+    struct da_trie *words;      // whole-token lookup, Llama-3 only
+    int bos_id;                 // <|begin_of_text|>, -1 when absent or not Llama-3
+    const struct vocab_image_header *image;   // backing image, NULL for JSON
+    uint32_t vocab_size;
+    uint32_t nb_merges;
+    uint32_t cache_tag;         // its entries in a wcache
+};
+
+// Loads a HuggingFace byte-level vocabulary (vocab/gpt2_vocab.json,
+// vocab/llama3_vocab.json). When merges_file is NULL the merge table is
+// derived from the vocabulary with the token id as merge rank, which is exact
+// for tiktoken vocabularies like Llama-3. For GPT-2 every split of a token
+// into two entries becomes a merge (108,299 of them against the 50,000 of
+// merges.txt); that is tiktoken's GPT-2 rule, not HuggingFace's merge list.
+// Pass vocab/gpt2_merges.txt for GPT2Tokenizer's exact merge order
+// (test/check_gpt2_parity.py).
+//
+// Llama-3 encodings start with <|begin_of_text|> when the vocabulary has it.
+// The committed vocab/llama3_vocab.json does not: it is tiktoken's
+// cl100k_base, whose 100,256 ranks are the first ones of Llama-3's 128,000.
+//
+// Llama-3 pieces that are whole vocabulary entries are emitted after one walk
+// of the vocabulary trie (HuggingFace ignore_merges), so per-piece cost
+// depends on the piece length and not on the vocabulary size.
+struct bpe *bpe_create_from_json(const char *vocab_file, const char *merges_file, enum bpe_pretok pretok);
+
+// Maps a byte-level image from vocab/compile_vocab.py; the merge table and
+// trie are used in place with no per-entry work at startup.
+struct bpe *bpe_create_from_image(const char *image_file, enum bpe_pretok pretok);
+void bpe_free(struct bpe *bpe);
+
+// Encodes len bytes of UTF-8 text into at most max_ids token ids and returns
+// the number written.
+int bpe_encode(const struct bpe *bpe, const char *text, size_t len, int *ids, int max_ids);
+
+// As bpe_encode, for text that continues past len. Unless final is set,
+// pieces near the end of the buffer that more bytes could still extend or
+// re-split are left unencoded; *consumed is where the caller resumes.
+// Pieces are looked up in cache first, when given, and added on a miss.
+int bpe_encode_partial(const struct bpe *bpe, struct wcache *cache, const char *text, size_t len, int final,
+                       size_t *consumed, int *ids, int max_ids);
+
+// Rank of merging left and right, setting *merged to the merged id, or
+// BPE_NO_RANK when the pair does not merge.
+static inline uint32_t bpe_merge_lookup(const struct bpe *bpe, int left, int right, int *merged) {
+    uint64_t key = (uint64_t)left << 32 | (uint32_t)right;
+    uint32_t k = vocab_merge_slot(key) & bpe->merge_mask;
+    for (;;) {
+        const struct vocab_merge *m = &bpe->merges[k];
+        if (m->key == key) {
+            *merged = (int)(uint32_t)m->val;
+            return m->val >> 32;
+        }
+        if (m->key == VOCAB_MERGE_EMPTY) return BPE_NO_RANK;
+        k = (k + 1) & bpe->merge_mask;
+    }
+}
+
+#endif
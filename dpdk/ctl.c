@@ -0,0 +1,91 @@
+#include <errno.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <rte_lcore.h>
+
+#include "ctl.h"
+
+static int ctl_fd = -1;
+static char ctl_path[sizeof(((struct sockaddr_un *)0)->sun_path)];
+static ctl_handler_fn ctl_handler;
+static pthread_t ctl_thread;
+
+// Reads commands until the client closes; a line longer than CTL_MAX_LINE
+// is rejected whole.
+static void ctl_serve(int fd) {
+    char line[CTL_MAX_LINE], reply[CTL_MAX_LINE];
+    size_t len = 0;
+    int overflow = 0;
+    char c;
+    while (read(fd, &c, 1) == 1) {
+        if (c != '\n') {
+            if (len < sizeof(line) - 1) line[len++] = c;
+            else overflow = 1;
+            continue;
+        }
+        line[len] = '\0';
+        if (len && line[len - 1] == '\r') line[len - 1] = '\0';
+        if (overflow) snprintf(reply, sizeof(reply), "ERR line too long");
+        else ctl_handler(line, reply, sizeof(reply));
+        size_t n = strlen(reply);
+        reply[n++] = '\n';
+        if (write(fd, reply, n) != (ssize_t)n) return;
+        len = 0;
+        overflow = 0;
+    }
+}
+
+static void *ctl_main(__rte_unused void *arg) {
+    while (1) {
+        int fd = accept(ctl_fd, NULL, NULL);
+        if (fd < 0) {
+            if (errno == EINTR) continue;
+            break;
+        }
+        ctl_serve(fd);
+        close(fd);
+    }
+    return NULL;
+}
+
+int ctl_start(const char *path, ctl_handler_fn handler) {
+    struct sockaddr_un addr = { .sun_family = AF_UNIX };
+    if (strlen(path) >= sizeof(addr.sun_path)) {
+        printf("Error: Control socket path '%s' is too long\n", path);
+        return -1;
+    }
+    strcpy(addr.sun_path, path);
+    ctl_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (ctl_fd < 0) {
+        printf("Error: Cannot create control socket: %s\n", strerror(errno));
+        return -1;
+    }
+    unlink(path);
+    if (bind(ctl_fd, (struct sockaddr *)&addr, sizeof(addr)) < 0 || listen(ctl_fd, 4) < 0) {
+        printf("Error: Cannot listen on '%s': %s\n", path, strerror(errno));
+        close(ctl_fd);
+        ctl_fd = -1;
+        return -1;
+    }
+    strcpy(ctl_path, path);
+    ctl_handler = handler;
+    if (rte_ctrl_thread_create(&ctl_thread, "nettok-ctl", NULL, ctl_main, NULL) != 0) {
+        printf("Error: Cannot start control thread\n");
+        ctl_stop();
+        return -1;
+    }
+    printf("Control socket listening on %s\n", path);
+    return 0;
+}
+
+void ctl_stop(void) {
+    if (ctl_fd < 0) return;
+    shutdown(ctl_fd, SHUT_RDWR);
+    close(ctl_fd);
+    unlink(ctl_path);
+    ctl_fd = -1;
+}
@@ -0,0 +1,18 @@
+#ifndef CTL_H
+#define CTL_H
+
+#include <stddef.h>
+
+#define CTL_MAX_LINE 1024
+
+// Handles one command line (without the newline) and writes a one-line
+// reply. Runs on the control thread, never on a packet lcore.
+typedef void (*ctl_handler_fn)(char *line, char *reply, size_t size);
+
+// Serves line-based commands on a UNIX stream socket at path from a DPDK
+// control thread, e.g. `echo "reload gpt2 gpt2.vocab" | socat - UNIX-CONNECT:path`.
+// One connection is served at a time; commands are run in order.
+int ctl_start(const char *path, ctl_handler_fn handler);
+void ctl_stop(void);
+
+#endif
@@ -0,0 +1,36 @@
+#include "hist.h"
+
+static inline unsigned bucket_shift(unsigned i) {
+    return i < 2 * HIST_SUB ? 0 : i / HIST_SUB - 1;
+}
+
+uint64_t hist_bucket_low(unsigned i) {
+    unsigned shift = bucket_shift(i);
+    return (uint64_t)(i - shift * HIST_SUB) << shift;
+}
+
+void hist_merge(struct hist *dst, const struct hist *src) {
+    for (unsigned i = 0; i < HIST_BUCKETS; i++) dst->counts[i] += __atomic_load_n(&src->counts[i], __ATOMIC_RELAXED);
+}
+
+uint64_t hist_count(const struct hist *h) {
+    uint64_t n = 0;
+    for (unsigned i = 0; i < HIST_BUCKETS; i++) n += h->counts[i];
+    return n;
+}
+
+uint64_t hist_percentile(const struct hist *h, double percentile) {
+    uint64_t n = hist_count(h);
+    if (!n) return 0;
+    // Rank of the value, counting from 1; percentile 0 is the smallest.
+    uint64_t rank = (uint64_t)(percentile / 100 * n + 0.5);
+    if (rank < 1) rank = 1;
+    if (rank > n) rank = n;
+    uint64_t seen = 0;
+    unsigned i = 0;
+    for (; i < HIST_BUCKETS - 1; i++) {
+        seen += h->counts[i];
+        if (seen >= rank) break;
+    }
+    return hist_bucket_low(i) + ((1ull << bucket_shift(i)) - 1) / 2;
+}
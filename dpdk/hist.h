@@ -0,0 +1,43 @@
+#ifndef HIST_H
+#define HIST_H
+
+#include <stdint.h>
+
+#define HIST_SUB_BITS 4         // 16 linear buckets per power of two, so within 1/16 of the value
+#define HIST_SUB (1u << HIST_SUB_BITS)
+#define HIST_MAX_BITS 40        // larger values land in the last bucket
+#define HIST_BUCKETS ((HIST_MAX_BITS - HIST_SUB_BITS + 1) * HIST_SUB)
+
+// Log-linear histogram of non-negative values, e.g. latencies in TSC
+// cycles, in the manner of HdrHistogram: values below 2 * HIST_SUB are
+// counted exactly, larger ones in buckets 1/HIST_SUB of a power of two
+// wide. One writer; any thread may read it at the same time, and sees every
+// count whole if not the latest.
+struct hist {
+    uint64_t counts[HIST_BUCKETS];
+};
+
+static inline unsigned hist_index(uint64_t v) {
+    if (v >> HIST_MAX_BITS) return HIST_BUCKETS - 1;
+    int msb = 63 - __builtin_clzll(v | 1);
+    int shift = msb > HIST_SUB_BITS ? msb - HIST_SUB_BITS : 0;
+    return (unsigned)shift * HIST_SUB + (unsigned)(v >> shift);
+}
+
+// A relaxed load, add and store: no locked instruction, since the caller
+// is the only writer.
+static inline void hist_record(struct hist *h, uint64_t v) {
+    uint64_t *c = &h->counts[hist_index(v)];
+    __atomic_store_n(c, __atomic_load_n(c, __ATOMIC_RELAXED) + 1, __ATOMIC_RELAXED);
+}
+
+// Smallest value counted in bucket i.
+uint64_t hist_bucket_low(unsigned i);
+// Adds the counts of src, which may be being written, to dst.
+void hist_merge(struct hist *dst, const struct hist *src);
+uint64_t hist_count(const struct hist *h);
+// Value below which percentile % of the counted values fall, as the middle
+// of its bucket; 0 for an empty histogram.
+uint64_t hist_percentile(const struct hist *h, double percentile);
+
+#endif
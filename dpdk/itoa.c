@@ -0,0 +1,116 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+#include "itoa.h"
+
+#define ITOA_LIMIT 100000000
+#define ASCII_ZEROS 0x3030303030303030ULL
+
+// Eight decimal digits of v < 10^8 as bytes, most significant digit in the
+// lowest byte: split into 4-digit halves, then 2-digit quarters, then digits,
+// each step a multiply-shift over every lane of the word at once.
+static inline uint64_t digits8(uint32_t v) {
+    uint64_t hi = v / 10000;
+    uint64_t x = hi | (uint64_t)(v - hi * 10000) << 32;
+    uint64_t y = ((x * 10486) >> 20) & 0x0000007F0000007FULL;
+    x = (x - y * 100) << 16 | y;
+    y = ((x * 103) >> 10) & 0x000F000F000F000FULL;
+    return (x - y * 10) << 8 | y;
+}
+
+// Appends the digits (and a space) produced by digits8 with one unaligned
+// 8-byte store; the caller guarantees 9 bytes of room.
+static inline int emit8(char *out, uint64_t d) {
+    int lz = d ? __builtin_ctzll(d) >> 3 : 7;
+    uint64_t ascii = (d + ASCII_ZEROS) >> (lz * 8);
+    memcpy(out, &ascii, 8);
+    out[8 - lz] = ' ';
+    return 9 - lz;
+}
+
+static int emit_slow(char *out, int room, int id) {
+    char tmp[16];
+    int n = snprintf(tmp, sizeof(tmp), "%d ", id);
+    if (n > room) return -1;
+    memcpy(out, tmp, n);
+    return n;
+}
+
+// Formats ids[j..] one at a time; shared tail for both paths.
+static int format_tail(const int *ids, int j, int nb_ids, char *out, int offset, int room) {
+    for (; j < nb_ids; j++) {
+        uint32_t v = ids[j];
+        if (v < ITOA_LIMIT && room - offset >= 9) {
+            offset += emit8(out + offset, digits8(v));
+            continue;
+        }
+        if (v < ITOA_LIMIT) {
+            char tmp[16];
+            int n = emit8(tmp, digits8(v));
+            if (n > room - offset) break;
+            memcpy(out + offset, tmp, n);
+            offset += n;
+            continue;
+        }
+        int n = emit_slow(out + offset, room - offset, ids[j]);
+        if (n < 0) break;
+        offset += n;
+    }
+    return offset;
+}
+
+int itoa_format_ids_scalar(const int *ids, int nb_ids, char *out, int room) {
+    return format_tail(ids, 0, nb_ids, out, 0, room);
+}
+
+#ifdef __AVX2__
+// digits8 on four ids at a time, one per 64-bit lane; the variable-length
+// stores stay scalar.
+int itoa_format_ids_avx2(const int *ids, int nb_ids, char *out, int room) {
+    const __m128i limit = _mm_set1_epi32(ITOA_LIMIT);
+    const __m256i div10000 = _mm256_set1_epi64x(109951163);     // 2^40 / 10^4
+    const __m256i k10000 = _mm256_set1_epi64x(10000);
+    const __m256i div100 = _mm256_set1_epi32(10486);            // 2^20 / 10^2
+    const __m256i k100 = _mm256_set1_epi32(100);
+    const __m256i div10 = _mm256_set1_epi16(103);               // 2^10 / 10
+    const __m256i k10 = _mm256_set1_epi16(10);
+    int offset = 0, j = 0;
+
+    // 4 ids need at most 36 bytes.
+    for (; j + 4 <= nb_ids && room - offset >= 36; j += 4) {
+        __m128i v32 = _mm_loadu_si128((const __m128i *)(ids + j));
+        // Unsigned compare: negative ids and ids >= 10^8 go the slow way.
+        __m128i big = _mm_cmpeq_epi32(_mm_max_epu32(v32, limit), v32);
+        if (!_mm_testz_si128(big, big)) break;
+
+        __m256i v = _mm256_cvtepu32_epi64(v32);
+        __m256i hi = _mm256_srli_epi64(_mm256_mul_epu32(v, div10000), 40);
+        __m256i lo = _mm256_sub_epi64(v, _mm256_mul_epu32(hi, k10000));
+        __m256i x = _mm256_or_si256(hi, _mm256_slli_epi64(lo, 32));
+        __m256i y = _mm256_srli_epi32(_mm256_mullo_epi32(x, div100), 20);
+        x = _mm256_or_si256(_mm256_slli_epi32(_mm256_sub_epi32(x, _mm256_mullo_epi32(y, k100)), 16), y);
+        y = _mm256_srli_epi16(_mm256_mullo_epi16(x, div10), 10);
+        x = _mm256_or_si256(_mm256_slli_epi16(_mm256_sub_epi16(x, _mm256_mullo_epi16(y, k10)), 8), y);
+
+        uint64_t d[4];
+        _mm256_storeu_si256((__m256i *)d, x);
+        offset += emit8(out + offset, d[0]);
+        offset += emit8(out + offset, d[1]);
+        offset += emit8(out + offset, d[2]);
+        offset += emit8(out + offset, d[3]);
+    }
+    return format_tail(ids, j, nb_ids, out, offset, room);
+}
+#endif
+
+int itoa_format_ids(const int *ids, int nb_ids, char *out, int room) {
+#ifdef __AVX2__
+    return itoa_format_ids_avx2(ids, nb_ids, out, room);
+#else
+    return itoa_format_ids_scalar(ids, nb_ids, out, room);
+#endif
+}
@@ -0,0 +1,18 @@
+#ifndef ITOA_H
+#define ITOA_H
+
+// Batch formatting of token ids as space-separated decimals ("%d " each),
+// the legacy response format. Ids in [0, 10^8) take a branchless path that
+// builds all eight digits at once and drops the leading zeros with a shift;
+// anything else falls back to snprintf.
+//
+// Each function writes whole ids only, stops before the first id that does
+// not fit in room, and returns the number of bytes written (no NUL).
+int itoa_format_ids(const int *ids, int nb_ids, char *out, int room);
+
+int itoa_format_ids_scalar(const int *ids, int nb_ids, char *out, int room);
+#ifdef __AVX2__
+int itoa_format_ids_avx2(const int *ids, int nb_ids, char *out, int room);
+#endif
+
+#endif
@@ -0,0 +1,112 @@
+#include <errno.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+#include <rte_lcore.h>
+
+#include "metrics.h"
+
+#define METRICS_MAX_REQUEST 2048
+
+static int metrics_fd = -1;
+static metrics_fn metrics_writer;
+static pthread_t metrics_thread;
+
+static int write_all(int fd, const char *buf, size_t len) {
+    while (len) {
+        ssize_t n = write(fd, buf, len);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) return -1;
+        buf += n;
+        len -= n;
+    }
+    return 0;
+}
+
+// Answers one HTTP request: the metrics for GET /metrics, 404 for any
+// other path. The request headers are read and ignored.
+static void metrics_serve(int fd, char *body) {
+    char req[METRICS_MAX_REQUEST];
+    size_t len = 0;
+    while (len < sizeof(req) - 1) {
+        ssize_t n = read(fd, req + len, sizeof(req) - 1 - len);
+        if (n <= 0) return;
+        len += n;
+        req[len] = '\0';
+        if (strstr(req, "\r\n\r\n") || strstr(req, "\n\n")) break;
+    }
+    req[len] = '\0';
+
+    char header[256];
+    size_t body_len = 0;
+    const char *status = "404 Not Found";
+    if (!strncmp(req, "GET /metrics ", 13) || !strncmp(req, "GET /metrics?", 13)) {
+        body_len = metrics_writer(body, METRICS_MAX_SIZE);
+        status = "200 OK";
+    }
+    int n = snprintf(header, sizeof(header),
+                     "HTTP/1.1 %s\r\nContent-Type: text/plain; version=0.0.4\r\nContent-Length: %zu\r\n"
+                     "Connection: close\r\n\r\n", status, body_len);
+    if (write_all(fd, header, n) == 0) write_all(fd, body, body_len);
+}
+
+static void *metrics_main(__rte_unused void *arg) {
+    char *body = malloc(METRICS_MAX_SIZE);
+    if (!body) return NULL;
+    while (1) {
+        int fd = accept(metrics_fd, NULL, NULL);
+        if (fd < 0) {
+            if (errno == EINTR) continue;
+            break;
+        }
+        // A client that sends nothing must not hold up the next scrape.
+        struct timeval timeout = { .tv_sec = 1 };
+        setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+        metrics_serve(fd, body);
+        close(fd);
+    }
+    free(body);
+    return NULL;
+}
+
+int metrics_start(uint16_t port, metrics_fn fn) {
+    struct sockaddr_in addr = {
+        .sin_family = AF_INET,
+        .sin_port = htons(port),
+        .sin_addr.s_addr = htonl(INADDR_LOOPBACK),
+    };
+    metrics_fd = socket(AF_INET, SOCK_STREAM, 0);
+    if (metrics_fd < 0) {
+        printf("Error: Cannot create metrics socket: %s\n", strerror(errno));
+        return -1;
+    }
+    int one = 1;
+    setsockopt(metrics_fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+    if (bind(metrics_fd, (struct sockaddr *)&addr, sizeof(addr)) < 0 || listen(metrics_fd, 4) < 0) {
+        printf("Error: Cannot listen on 127.0.0.1:%u: %s\n", port, strerror(errno));
+        close(metrics_fd);
+        metrics_fd = -1;
+        return -1;
+    }
+    metrics_writer = fn;
+    if (rte_ctrl_thread_create(&metrics_thread, "nettok-metrics", NULL, metrics_main, NULL) != 0) {
+        printf("Error: Cannot start metrics thread\n");
+        metrics_stop();
+        return -1;
+    }
+    printf("Prometheus metrics on http://127.0.0.1:%u/metrics\n", port);
+    return 0;
+}
+
+void metrics_stop(void) {
+    if (metrics_fd < 0) return;
+    shutdown(metrics_fd, SHUT_RDWR);
+    close(metrics_fd);
+    metrics_fd = -1;
+}
@@ -0,0 +1,20 @@
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define METRICS_MAX_SIZE (1 << 20)
+
+// Writes the metrics in Prometheus text format to buf and returns their
+// length, at most size - 1. Runs on the metrics thread, never on a packet
+// lcore.
+typedef size_t (*metrics_fn)(char *buf, size_t size);
+
+// Serves GET /metrics over HTTP on 127.0.0.1:port from a DPDK control
+// thread, for Prometheus to scrape or for `curl localhost:port/metrics`.
+// One connection is served at a time.
+int metrics_start(uint16_t port, metrics_fn fn);
+void metrics_stop(void);
+
+#endif
@@ -0,0 +1,139 @@
+#include <string.h>
+
+#include "itoa.h"
+#include "proto.h"
+
+int proto_parse_request(const uint8_t *payload, int len, struct proto_request *req) {
+    memset(req, 0, sizeof(*req));
+    req->format = PROTO_FMT_ASCII;
+    req->frag_count = 1;
+    if (len < 1 || payload[0] != PROTO_MAGIC) return 0;
+    if (len < (int)sizeof(struct proto_req_hdr)) return -1;
+    const struct proto_req_hdr *hdr = (const struct proto_req_hdr *)payload;
+    if (hdr->version != PROTO_VERSION) return -1;
+    if (hdr->format > PROTO_FMT_VARINT && hdr->format != PROTO_FMT_AUTO) return -1;
+    req->format = hdr->format;
+    req->flags = hdr->flags;
+    if (!(hdr->flags & PROTO_REQ_F_FRAGMENT)) return sizeof(*hdr);
+
+    if (len < (int)PROTO_REQ_MAX_HDR) return -1;
+    const uint8_t *f = payload + sizeof(*hdr);
+    req->req_id = f[0] | f[1] << 8 | f[2] << 16 | (uint32_t)f[3] << 24;
+    req->frag_index = f[4] | f[5] << 8;
+    req->frag_count = f[6] | f[7] << 8;
+    if (!req->frag_count || req->frag_index >= req->frag_count) return -1;
+    return PROTO_REQ_MAX_HDR;
+}
+
+uint8_t proto_resolve_format(uint8_t format, uint32_t max_id) {
+    if (format == PROTO_FMT_AUTO || format == PROTO_FMT_U16)
+        return max_id <= UINT16_MAX ? PROTO_FMT_U16 : PROTO_FMT_U32;
+    return format;
+}
+
+static inline int varint_len(uint32_t v) {
+    int n = 1;
+    while (v >= 0x80) {
+        v >>= 7;
+        n++;
+    }
+    return n;
+}
+
+static inline int decimal_len(uint32_t v) {
+    int n = 1;
+    while (v >= 10) {
+        v /= 10;
+        n++;
+    }
+    return n;
+}
+
+int proto_max_len(uint8_t format, int nb_ids, uint32_t max_id) {
+    switch (format) {
+    case PROTO_FMT_U16: return sizeof(struct proto_resp_hdr) + 2 * nb_ids;
+    case PROTO_FMT_U32: return sizeof(struct proto_resp_hdr) + 4 * nb_ids;
+    case PROTO_FMT_VARINT: return sizeof(struct proto_resp_hdr) + varint_len(max_id) * nb_ids;
+    default: return (decimal_len(max_id) + 1) * nb_ids;
+    }
+}
+
+static inline void put_le16(uint8_t *p, uint16_t v) {
+    p[0] = v;
+    p[1] = v >> 8;
+}
+
+static inline void put_le32(uint8_t *p, uint32_t v) {
+    p[0] = v;
+    p[1] = v >> 8;
+    p[2] = v >> 16;
+    p[3] = v >> 24;
+}
+
+// Writes ids in format from p up to end; returns the new end and sets *done.
+static uint8_t *encode_ids(uint8_t format, const int *ids, int nb_ids, uint8_t *p, uint8_t *end, int *done) {
+    int j = 0;
+    switch (format) {
+    case PROTO_FMT_ASCII: {
+        int len = itoa_format_ids(ids, nb_ids, (char *)p, end - p);
+        for (int k = 0; k < len; k++) j += p[k] == ' ';
+        p += len;
+        break;
+    }
+    case PROTO_FMT_U16:
+        for (; j < nb_ids && p + 2 <= end; j++, p += 2) put_le16(p, ids[j]);
+        break;
+    case PROTO_FMT_U32:
+        for (; j < nb_ids && p + 4 <= end; j++, p += 4) put_le32(p, ids[j]);
+        break;
+    case PROTO_FMT_VARINT:
+        for (; j < nb_ids && p + varint_len(ids[j]) <= end; j++) {
+            uint32_t v = ids[j];
+            while (v >= 0x80) {
+                *p++ = v | 0x80;
+                v >>= 7;
+            }
+            *p++ = v;
+        }
+        break;
+    }
+    *done = j;
+    return p;
+}
+
+static void put_resp_hdr(uint8_t *out, uint8_t format, uint8_t flags, uint16_t count) {
+    struct proto_resp_hdr *hdr = (struct proto_resp_hdr *)out;
+    hdr->magic = PROTO_MAGIC;
+    hdr->version = PROTO_VERSION;
+    hdr->format = format;
+    hdr->flags = flags;
+    put_le16((uint8_t *)&hdr->count, count);
+    hdr->reserved = 0;
+}
+
+int proto_encode(uint8_t format, const int *ids, int nb_ids, uint8_t *out, int room) {
+    int done;
+    if (format == PROTO_FMT_ASCII) return itoa_format_ids(ids, nb_ids, (char *)out, room);
+    if (room < (int)sizeof(struct proto_resp_hdr)) return 0;
+    uint8_t *p = encode_ids(format, ids, nb_ids, out + sizeof(struct proto_resp_hdr), out + room, &done);
+    put_resp_hdr(out, format, done < nb_ids ? PROTO_F_TRUNCATED : 0, done);
+    return p - out;
+}
+
+int proto_encode_part(uint8_t format, const int *ids, int nb_ids, uint32_t req_id, uint16_t index, uint8_t *out,
+                      int room, int *done) {
+    const int hdr_len = sizeof(struct proto_resp_hdr) + sizeof(struct proto_frag_hdr);
+    *done = 0;
+    if (room < hdr_len) return 0;
+    uint8_t *p = encode_ids(format, ids, nb_ids, out + hdr_len, out + room, done);
+    put_resp_hdr(out, format, PROTO_F_FRAGMENT, *done);
+    uint8_t *frag = out + sizeof(struct proto_resp_hdr);
+    put_le32(frag, req_id);
+    put_le16(frag + 4, index);
+    put_le16(frag + 6, 0);
+    return p - out;
+}
+
+void proto_set_part_count(uint8_t *part, uint16_t count) {
+    put_le16(part + sizeof(struct proto_resp_hdr) + offsetof(struct proto_frag_hdr, count), count);
+}
@@ -0,0 +1,92 @@
+#ifndef PROTO_H
+#define PROTO_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Optional request header. 0xFE never occurs in UTF-8, so a payload that
+// starts with it cannot be plain text; requests without it get the legacy
+// space-separated ASCII response.
+#define PROTO_MAGIC 0xFE
+#define PROTO_VERSION 1
+
+enum proto_format {
+    PROTO_FMT_ASCII = 0,    // "%d " per id, no header
+    PROTO_FMT_U16 = 1,      // little-endian uint16 per id
+    PROTO_FMT_U32 = 2,      // little-endian uint32 per id
+    PROTO_FMT_VARINT = 3,   // unsigned LEB128 per id
+    PROTO_FMT_AUTO = 0xFF,  // request only: U16 when every id fits, else U32
+};
+
+// Response flags
+#define PROTO_F_TRUNCATED 0x1   // ids were dropped to fit the packet
+#define PROTO_F_FRAGMENT 0x2    // one part of several; a proto_frag_hdr follows
+
+struct proto_req_hdr {
+    uint8_t magic;
+    uint8_t version;
+    uint8_t format;         // enum proto_format
+    uint8_t flags;          // PROTO_REQ_F_*
+} __attribute__((packed));
+
+// Request flags
+#define PROTO_REQ_F_FRAGMENT 0x1    // a proto_frag_hdr follows
+
+// One fragment of a prompt larger than a frame. Fragments of a request share
+// req_id (per sender MAC and UDP port) and may arrive in any order; the
+// response goes out once all count of them are in. Fields are little endian.
+struct proto_frag_hdr {
+    uint32_t req_id;
+    uint16_t index;
+    uint16_t count;
+} __attribute__((packed));
+
+// Longest request header the server peeks at.
+#define PROTO_REQ_MAX_HDR (sizeof(struct proto_req_hdr) + sizeof(struct proto_frag_hdr))
+
+struct proto_request {
+    uint8_t format;
+    uint8_t flags;
+    uint32_t req_id;
+    uint16_t frag_index;
+    uint16_t frag_count;    // 1 for a request in a single frame
+};
+
+// Precedes every binary response, and every part of a response split over
+// several frames whatever its format. count is the ids in this frame, little
+// endian. A split response follows it with a proto_frag_hdr: the request's
+// req_id (0 for a single-frame request), the part index and the part count.
+struct proto_resp_hdr {
+    uint8_t magic;
+    uint8_t version;
+    uint8_t format;         // format actually used, never AUTO
+    uint8_t flags;
+    uint16_t count;
+    uint16_t reserved;
+} __attribute__((packed));
+
+// Parses an optional request header and fragment header. Returns their
+// length (0 when absent) and fills *req; returns -1 for a malformed or
+// unsupported header.
+int proto_parse_request(const uint8_t *payload, int len, struct proto_request *req);
+
+// Resolves AUTO, and U16 when ids can exceed 16 bits, against the largest
+// id the engine can emit.
+uint8_t proto_resolve_format(uint8_t format, uint32_t max_id);
+
+// Upper bound on the proto_encode output for nb_ids ids no larger than max_id.
+int proto_max_len(uint8_t format, int nb_ids, uint32_t max_id);
+
+// Writes the response payload for ids in format into out and returns its
+// length. Never writes more than room bytes.
+int proto_encode(uint8_t format, const int *ids, int nb_ids, uint8_t *out, int room);
+
+// Writes part index of a split response: headers, then as many ids as fit
+// in room. Returns its length and sets *done to the ids written. The part
+// count is not known yet; proto_set_part_count fills it in once every part
+// is built.
+int proto_encode_part(uint8_t format, const int *ids, int nb_ids, uint32_t req_id, uint16_t index, uint8_t *out,
+                      int room, int *done);
+void proto_set_part_count(uint8_t *part, uint16_t count);
+
+#endif
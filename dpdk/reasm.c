@@ -0,0 +1,149 @@
+#include <stdio.h>
+#include <string.h>
+#include <rte_common.h>
+#include <rte_malloc.h>
+
+#include "reasm.h"
+
+struct reasm_table *reasm_create(uint32_t entries, uint64_t max_cycles, reasm_feed_fn feed, reasm_close_fn close,
+                                 int socket_id) {
+    uint32_t buckets = rte_align32pow2(RTE_MAX(entries / REASM_BUCKET_ENTRIES, 1u));
+    size_t size = sizeof(struct reasm_table) + (size_t)buckets * REASM_BUCKET_ENTRIES * sizeof(struct reasm_entry);
+    struct reasm_table *tbl = rte_zmalloc_socket("reasm", size, RTE_CACHE_LINE_SIZE, socket_id);
+    if (!tbl) {
+        printf("Error: Cannot allocate reassembly table for %u requests\n", buckets * REASM_BUCKET_ENTRIES);
+        return NULL;
+    }
+    tbl->feed = feed;
+    tbl->close = close;
+    tbl->max_cycles = max_cycles;
+    tbl->bucket_mask = buckets - 1;
+    return tbl;
+}
+
+static void reasm_drop(struct reasm_table *tbl, struct reasm_entry *e) {
+    for (int k = 0; k < REASM_MAX_HELD && e->nb_held; k++) {
+        if (!e->held[k].m) continue;
+        rte_pktmbuf_free(e->held[k].m);
+        e->held[k].m = NULL;
+        e->nb_held--;
+    }
+    if (e->next && tbl->close) tbl->close(e);
+    e->in_use = 0;
+    tbl->stats.in_flight--;
+}
+
+void reasm_free(struct reasm_table *tbl) {
+    if (!tbl) return;
+    for (uint32_t i = 0; i < (tbl->bucket_mask + 1) * REASM_BUCKET_ENTRIES; i++)
+        if (tbl->entries[i].in_use) reasm_drop(tbl, &tbl->entries[i]);
+    rte_free(tbl);
+}
+
+static inline uint32_t reasm_bucket(const struct reasm_table *tbl, const struct rte_ether_addr *src, uint16_t port,
+                                    uint16_t dst_port, uint32_t req_id) {
+    uint64_t key = (uint64_t)req_id << 32 | (uint32_t)port << 16 |
+                   ((src->addr_bytes[4] << 8 | src->addr_bytes[5]) ^ dst_port);
+    return (uint32_t)((key * 0x9E3779B97F4A7C15ULL) >> 32) & tbl->bucket_mask;
+}
+
+// Finds the request, or claims a slot for it: a free one, else the bucket's
+// least recently active request is evicted. Only a first fragment evicts;
+// the rest of an evicted request would otherwise push out the next one.
+static struct reasm_entry *reasm_lookup(struct reasm_table *tbl, const struct rte_ether_addr *src, uint16_t port,
+                                        uint16_t dst_port, uint32_t req_id, uint16_t index, uint16_t count,
+                                        uint64_t now) {
+    struct reasm_entry *bucket = &tbl->entries[reasm_bucket(tbl, src, port, dst_port, req_id) * REASM_BUCKET_ENTRIES];
+    struct reasm_entry *victim = NULL;
+    for (int k = 0; k < REASM_BUCKET_ENTRIES; k++) {
+        struct reasm_entry *e = &bucket[k];
+        if (!e->in_use) {
+            if (!victim || victim->in_use) victim = e;
+            continue;
+        }
+        if (e->req_id == req_id && e->port == port && e->dst_port == dst_port && rte_is_same_ether_addr(&e->src, src))
+            return e;
+        if (!victim || (victim->in_use && e->last_tsc < victim->last_tsc)) victim = e;
+    }
+    if (victim->in_use) {
+        if (index) return NULL;
+        reasm_drop(tbl, victim);
+        tbl->stats.evicted++;
+    }
+    struct reasm_entry *e = victim;
+    rte_ether_addr_copy(src, &e->src);
+    e->port = port;
+    e->dst_port = dst_port;
+    e->req_id = req_id;
+    e->in_use = 1;
+    e->next = 0;
+    e->count = count;
+    e->nb_held = 0;
+    e->start_tsc = now;
+    e->words = 0;
+    e->bytes = 0;
+    tbl->stats.in_flight++;
+    return e;
+}
+
+int reasm_fragment(struct reasm_table *tbl, struct rte_mbuf *m, const struct rte_ether_addr *src, uint16_t port,
+                   uint16_t dst_port, uint32_t req_id, uint16_t index, uint16_t count, uint32_t off, uint32_t len,
+                   uint64_t now, struct reasm_entry **done) {
+    tbl->stats.fragments++;
+    struct reasm_entry *e = reasm_lookup(tbl, src, port, dst_port, req_id, index, count, now);
+    if (!e) {
+        tbl->stats.dropped++;
+        return -1;
+    }
+    if (e->count != count || index < e->next || index - e->next >= REASM_MAX_HELD) {
+        if (!e->next && !e->nb_held) reasm_drop(tbl, e);   // claimed just now
+        tbl->stats.dropped++;
+        return -1;
+    }
+    e->last_tsc = now;
+
+    if (index != e->next) {
+        struct reasm_frag *h = &e->held[index % REASM_MAX_HELD];
+        if (h->m) {
+            tbl->stats.dropped++;
+            return -1;
+        }
+        h->m = m;
+        h->off = off;
+        h->len = len;
+        e->nb_held++;
+        return REASM_PENDING;
+    }
+
+    tbl->feed(e, m, off, len);
+    e->next++;
+    struct reasm_frag *h;
+    while ((h = &e->held[e->next % REASM_MAX_HELD])->m) {
+        tbl->feed(e, h->m, h->off, h->len);
+        rte_pktmbuf_free(h->m);
+        h->m = NULL;
+        e->nb_held--;
+        e->next++;
+    }
+    if (e->next == e->count) {
+        tbl->stats.completed++;
+        *done = e;
+        return REASM_COMPLETE;
+    }
+    rte_pktmbuf_free(m);
+    return REASM_PENDING;
+}
+
+void reasm_release(struct reasm_table *tbl, struct reasm_entry *e) {
+    reasm_drop(tbl, e);
+}
+
+void reasm_expire(struct reasm_table *tbl, uint64_t now) {
+    for (uint32_t i = 0; i < (tbl->bucket_mask + 1) * REASM_BUCKET_ENTRIES; i++) {
+        struct reasm_entry *e = &tbl->entries[i];
+        if (e->in_use && now - e->last_tsc > tbl->max_cycles) {
+            reasm_drop(tbl, e);
+            tbl->stats.timed_out++;
+        }
+    }
+}
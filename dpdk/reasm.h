@@ -0,0 +1,92 @@
+#ifndef REASM_H
+#define REASM_H
+
+#include <stdint.h>
+#include <rte_ether.h>
+#include <rte_mbuf.h>
+
+#include "stream.h"
+
+#define REASM_BUCKET_ENTRIES 8  // associativity; a full bucket evicts its oldest request
+#define REASM_MAX_HELD 16       // out-of-order fragments held per request
+#define REASM_MAX_IDS 8192      // MAX_SEQUENCE_LENGTH in tokenizer.c
+
+enum {
+    REASM_PENDING,      // fragment consumed, request still open
+    REASM_COMPLETE,     // request done; the fragment's mbuf is left to the caller
+};
+
+struct reasm_frag {
+    struct rte_mbuf *m;
+    uint32_t off;
+    uint32_t len;
+};
+
+// One request being reassembled. Fragments are tokenized the moment they
+// are next in order, so only out-of-order ones are held, and at most
+// REASM_MAX_HELD of them.
+struct reasm_entry {
+    struct rte_ether_addr src;
+    uint16_t port;              // UDP source port, network order
+    uint16_t dst_port;          // UDP destination port, network order; picks the tenant
+    uint32_t req_id;
+    int in_use;
+    uint16_t next;              // index of the next fragment to tokenize
+    uint16_t count;
+    uint16_t nb_held;
+    uint64_t start_tsc;
+    uint64_t last_tsc;
+    struct reasm_frag held[REASM_MAX_HELD];   // by index % REASM_MAX_HELD
+
+    // Owned by the feed callback.
+    void *ctx;
+    int words;
+    uint32_t bytes;
+    struct tok_stream stream;
+    int ids[REASM_MAX_IDS];
+};
+
+struct reasm_stats {
+    uint64_t fragments;
+    uint64_t completed;
+    uint64_t timed_out;     // requests aged out
+    uint64_t evicted;       // requests pushed out by a new one in a full bucket
+    uint64_t dropped;       // duplicate, out of window or inconsistent fragments
+    uint32_t in_flight;
+};
+
+// Called with each fragment in index order; e->next is its index.
+typedef void (*reasm_feed_fn)(struct reasm_entry *e, const struct rte_mbuf *m, uint32_t off, uint32_t len);
+// Called when a request that was fed at least once is released or dropped.
+typedef void (*reasm_close_fn)(struct reasm_entry *e);
+
+// Per-lcore table, not thread safe. Memory is fixed at creation: entries
+// requests (rounded up to whole buckets) plus the mbufs they hold.
+struct reasm_table {
+    reasm_feed_fn feed;
+    reasm_close_fn close;       // may be NULL
+    uint64_t max_cycles;        // timer cycles a request may sit idle
+    uint32_t bucket_mask;
+    struct reasm_stats stats;
+    struct reasm_entry entries[];
+};
+
+struct reasm_table *reasm_create(uint32_t entries, uint64_t max_cycles, reasm_feed_fn feed, reasm_close_fn close,
+                                 int socket_id);
+void reasm_free(struct reasm_table *tbl);
+
+// Adds a fragment of request req_id from src/port to dst_port whose text is
+// len bytes of m at off. Returns
+// REASM_PENDING once m is consumed, or REASM_COMPLETE with *done set when
+// this fragment finished the request; m then stays with the caller, who
+// answers and calls reasm_release. Returns -1 and leaves m to the caller
+// when the fragment is dropped.
+int reasm_fragment(struct reasm_table *tbl, struct rte_mbuf *m, const struct rte_ether_addr *src, uint16_t port,
+                   uint16_t dst_port, uint32_t req_id, uint16_t index, uint16_t count, uint32_t off, uint32_t len,
+                   uint64_t now, struct reasm_entry **done);
+void reasm_release(struct reasm_table *tbl, struct reasm_entry *e);
+
+// Evicts requests idle for longer than max_cycles.
+void reasm_expire(struct reasm_table *tbl, uint64_t now);
+
+#endif
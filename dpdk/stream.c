@@ -0,0 +1,69 @@
+#include <string.h>
+
+#include "stream.h"
+
+void stream_init(struct tok_stream *st, stream_encode_fn encode, const void *engine, int *ids, int max_ids) {
+    st->encode = encode;
+    st->engine = engine;
+    st->ids = ids;
+    st->max_ids = max_ids;
+    st->nb_ids = 0;
+    st->carry_len = 0;
+}
+
+static size_t stream_encode(struct tok_stream *st, const char *text, size_t len, int final) {
+    size_t consumed;
+    st->nb_ids += st->encode(st->engine, text, len, final, &consumed, st->ids + st->nb_ids, st->max_ids - st->nb_ids);
+    return consumed;
+}
+
+// Encodes the head of an open piece that has outgrown the carry.
+static size_t stream_force(struct tok_stream *st, const char *text, size_t len) {
+    size_t cut = len / STREAM_FLUSH * STREAM_FLUSH;
+    stream_encode(st, text, cut, 1);
+    return cut;
+}
+
+// Holds back the unencoded tail.
+static void stream_keep(struct tok_stream *st, const char *text, size_t len) {
+    if (len > STREAM_CARRY) {
+        size_t cut = stream_force(st, text, len - STREAM_CARRY + STREAM_FLUSH - 1);
+        text += cut;
+        len -= cut;
+    }
+    memmove(st->carry, text, len);
+    st->carry_len = len;
+}
+
+void stream_feed(struct tok_stream *st, const char *data, size_t len, int last) {
+    size_t p = 0;
+    if (st->nb_ids >= st->max_ids) return;
+
+    if (st->carry_len) {
+        // Re-encode the carried piece against the head of this chunk. The
+        // window is bounded, so a piece running past it is forced out.
+        char window[2 * STREAM_CARRY];
+        size_t carry = st->carry_len;
+        size_t take = len < sizeof(window) - carry ? len : sizeof(window) - carry;
+        int whole = take == len;
+        memcpy(window, st->carry, carry);
+        memcpy(window + carry, data, take);
+        st->carry_len = 0;
+
+        size_t c = stream_encode(st, window, carry + take, last && whole);
+        if (c < carry && st->nb_ids < st->max_ids) {
+            if (whole) {
+                stream_keep(st, window + c, carry + take - c);
+                return;
+            }
+            c += stream_force(st, window + c, carry + take - c);
+        }
+        if (c < carry) return;
+        p = c - carry;
+    }
+
+    if (p < len && st->nb_ids < st->max_ids) {
+        p += stream_encode(st, data + p, len - p, last);
+        if (!last && st->nb_ids < st->max_ids) stream_keep(st, data + p, len - p);
+    }
+}
@@ -0,0 +1,38 @@
+#ifndef STREAM_H
+#define STREAM_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Longest run of text held back between chunks. A piece or word still open
+// when it outgrows the carry is cut in STREAM_FLUSH multiples and encoded as
+// if the text ended there; that is BPE_MAX_WORD, where bpe_encode splits
+// long pieces anyway.
+#define STREAM_CARRY 1024
+#define STREAM_FLUSH 256
+
+// Engine entry point in the shape of bpe_encode_partial: encode
+// text[0, len), stopping before a piece that more text could still extend
+// unless final is set; *consumed is where the next call must resume.
+typedef int (*stream_encode_fn)(const void *engine, const char *text, size_t len, int final, size_t *consumed,
+                                int *ids, int max_ids);
+
+// Tokenizes text that arrives in chunks (mbuf segments) without first
+// copying it into one buffer. Only the open piece at each chunk boundary is
+// copied, into carry, and re-encoded together with the head of the next
+// chunk.
+struct tok_stream {
+    stream_encode_fn encode;
+    const void *engine;
+    int *ids;
+    int max_ids;
+    int nb_ids;
+    uint32_t carry_len;
+    char carry[STREAM_CARRY];
+};
+
+void stream_init(struct tok_stream *st, stream_encode_fn encode, const void *engine, int *ids, int max_ids);
+// Feeds the next len bytes; last marks the end of the text and flushes carry.
+void stream_feed(struct tok_stream *st, const char *data, size_t len, int last);
+
+#endif
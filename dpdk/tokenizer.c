@@ -1,237 +1,1712 @@
+#include <inttypes.h>
+#include <signal.h>
+#include <stdarg.h>
+#include <stddef.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <ctype.h>
+#include <getopt.h>
 #include <rte_eal.h>
 #include <rte_ethdev.h>
 #include <rte_mbuf.h>
-#include <rte_hash.h>
+#include <rte_mbuf_dyn.h>
+#include <rte_ring.h>
+#include <rte_lcore.h>
 #include <rte_jhash.h>
+#include <rte_malloc.h>
+#include <rte_prefetch.h>
+#include <rte_rcu_qsbr.h>
+#include <rte_rwlock.h>
+#include <rte_telemetry.h>
 #include <cjson/cJSON.h>
 #include <rte_cycles.h>
 
+#include "bpe.h"
+#include "ctl.h"
+#include "hist.h"
+#include "metrics.h"
+#include "wcache.h"
+#include "proto.h"
+#include "reasm.h"
+#include "trace.h"
+#include "stream.h"
+#include "trie.h"
+#include "vocab.h"
+#include "wordpiece.h"
+
 #define RX_RING_SIZE 4096
 #define TX_RING_SIZE 4096
 #define NUM_MBUFS 65535
 #define MBUF_CACHE_SIZE 512
 #define BURST_SIZE 64
-#define HASH_TABLE_SIZE 262144
-#define MAX_SEQUENCE_LENGTH 512
+#define TX_DRAIN_US 10        // longest a ready response waits in an RTC lcore's TX buffer
+#define TX_RETRIES 8          // extra tx_burst calls for frames the TX queue refused
+#define MAX_SEQUENCE_LENGTH 8192     // Llama-3 context; longer outputs span several response frames
 #define MAX_PACKET_SIZE 8192
+#define MAX_PAYLOAD (MAX_PACKET_SIZE - RTE_ETHER_HDR_LEN - RTE_ETHER_CRC_LEN - (int)sizeof(struct rte_udp_hdr))
+#define MAX_RESPONSE_FRAMES 32
 #define MBUF_SIZE (MAX_PACKET_SIZE + RTE_PKTMBUF_HEADROOM)
+#define MIN_MBUF_DATA 256
+#define REASM_ENTRIES 256
+#define WCACHE_ENTRIES 4096   // 256 KB per lcore
+#define TRACE_EVENTS 4096     // 128 KB per lcore, and as much again for the frozen copy
+#define TRACE_MAX_EVENTS (1 << 24)
+#define PREFETCH_OFFSET 3     // packets ahead whose headers are prefetched
+#define REASM_TIMEOUT_MS 100
+#define WORKER_RING_SIZE 1024
+#define RESP_RING_SIZE 4096
+#define UDP_PORT 67
+#define PAYLOAD_OFF (sizeof(struct rte_ether_hdr) + sizeof(struct rte_udp_hdr))
+#define CTL_SOCKET "/var/run/nettok.sock"
+#define MAX_TENANTS 16
+#define LAT_BATCH_CLASSES 7   // words per request: 1, 2-3, 4-7, ... 64 and up
+#define LAT_SIZE_CLASSES 5    // payload bytes: under 64, 256, 1 KB, 4 KB, and larger
+#define LAT_CLASSES (LAT_BATCH_CLASSES * LAT_SIZE_CLASSES)
+#define LAT_CSV "tokenization_latency.csv"
+
+// Cycle accounting per stage, by payload size class. STAGE_BEGIN starts a
+// timestamp; each STAGE_END charges the cycles since then to a stage and
+// restarts it. Without STAGE_STATS both compile to nothing.
+#ifdef STAGE_STATS
+#define STAGE_BEGIN(t) uint64_t t = rte_rdtsc()
+#define STAGE_END(lc, t, bytes, stage) do {                                       \
+        uint64_t stage_now_ = rte_rdtsc();                                          \
+        (lc)->stage_cycles[lat_size_class(bytes)][stage] += stage_now_ - (t);       \
+        (t) = stage_now_;                                                           \
+    } while (0)
+#else
+#define STAGE_BEGIN(t) do { } while (0)
+#define STAGE_END(lc, t, bytes, stage) do { } while (0)
+#endif
+
+enum tx_mode {
+    TX_COPY,       // new mbuf per response
+    TX_INPLACE,    // response written over the request mbuf
+};
+
+enum tok_mode {
+    MODE_CHAR,
+    MODE_GPT2,
+    MODE_LLAMA3,
+    MODE_WORDPIECE,
+};
+
+static const char *const mode_names[] = { "char", "gpt2", "llama3", "wordpiece" };
+
+// A loaded vocabulary and the engine over it, shared read-only by all
+// lcores. Packet lcores reach the live one through its tenant under RCU: a
+// reload publishes a new engine and frees the old one once no lcore can
+// still be using it.
+struct tok_engine {
+    enum tok_mode mode;
+    struct da_trie *trie;                       // char mode
+    const struct vocab_image_header *image;     // char mode, when loaded from an image
+    struct bpe *bpe;
+    struct wordpiece *wordpiece;
+    uint32_t max_token_id;      // largest id the engine can emit, picks u16 vs u32
+    uint32_t refs;              // fragmented requests still being tokenized with it
+};
+
+// Requests pick their vocabulary by UDP destination port.
+struct tenant {
+    uint16_t udp_port;          // network order
+    struct tok_engine *engine;
+};
+
+enum topology {
+    TOPO_RTC,        // every lcore receives, tokenizes and answers on its own queue pair
+    TOPO_PIPELINE,   // RX lcores -> worker rings -> tokenizer lcores -> TX rings -> TX lcores
+};
+
+// The stages of a request, timed when built with -DSTAGE_STATS. Pipeline
+// workers count the hand-off to the TX ring as tx.
+enum stage {
+    STAGE_PARSE,        // headers and request header, on the lcore that receives it
+    STAGE_COUNT,        // count_tokens(), the batch size
+    STAGE_TOKENIZE,     // vocabulary lookups, and reassembly for fragments
+    STAGE_FORMAT,       // response ids and headers, mbuf alloc on the copy path
+    STAGE_TX,           // rte_eth_tx_burst(), or the TX ring in the pipeline
+    NB_STAGES,
+};
+
+enum drop_reason {
+    DROP_SHORT,         // frame shorter than its headers or its UDP length
+    DROP_NO_TENANT,     // UDP port with no vocabulary
+    DROP_OVERSIZE,      // empty, or payload over MAX_PACKET_SIZE
+    DROP_BAD_HEADER,    // request header not understood
+    DROP_REASM,         // fragment refused by reassembly
+    DROP_NO_MBUF,       // mempool exhausted building the response
+    DROP_WORKER_FULL,   // pipeline worker ring full
+    DROP_TX_FULL,       // TX queue full through the retries, or TX ring full
+    NB_DROP_REASONS,
+};
+
+static const char *const drop_names[NB_DROP_REASONS] = {
+    "short_frame", "no_tenant", "oversize", "bad_header", "reassembly", "no_mbuf", "worker_full", "tx_full",
+};
+
+enum lcore_role {
+    ROLE_RTC,
+    ROLE_RX,
+    ROLE_WORKER,
+    ROLE_TX,
+};
+
+// Per-lcore state; only its own lcore writes it once running.
+struct lcore_conf {
+    enum lcore_role role;
+    uint16_t rx_queue;
+    uint16_t tx_queue;
+    struct rte_ring *ring;          // worker: requests in; TX: responses in; RTC: stealable backlog
+    struct rte_ring *tx_ring;       // worker: ring of the TX lcore it hands off to
+    struct reasm_table *reasm;      // RTC and worker lcores
+    struct wcache *wcache;          // RTC and worker lcores, NULL with --word-cache 0
+    struct hist *latency;           // RTC and worker lcores: RX to TX cycles by batch and size class
+    struct trace_ring *trace;       // RTC and worker lcores, NULL with --trace-events 0
+    struct rte_eth_dev_tx_buffer *tx_buffer;    // RTC: responses waiting for one doorbell
+    uint64_t tx_first;              // RTC: when the oldest of them was ready
+    unsigned next_worker;           // RX: round robin over the workers; RTC: next lcore to steal from
+    uint64_t rx_packets;
+    uint64_t tx_packets;
+    uint64_t dropped;               // all of drops[]
+    uint64_t drops[NB_DROP_REASONS];
+    uint64_t requests;              // answered by this lcore
+    uint64_t ids;                   // in those answers
+    uint64_t stolen;                // of which taken from another lcore's backlog
+    uint64_t busy_cycles;
+    uint64_t last_expire;
+    uint64_t last_report;
+    struct reasm_stats reported;
+    uint64_t last_load;
+    uint64_t load_requests;
+    uint64_t load_busy;
+#ifdef STAGE_STATS
+    uint64_t stage_cycles[LAT_SIZE_CLASSES][NB_STAGES];
+    uint64_t stage_requests[LAT_SIZE_CLASSES];
+#endif
+} __rte_cache_aligned;
+
+// Filled in by the lcore that receives a request and carried in the mbuf, so
+// a pipeline worker starts from the parsed header and the RX timestamp.
+struct req_meta {
+    uint64_t rx_tsc;
+    struct proto_request req;
+    uint16_t hdr_len;       // 0 for legacy text requests
+    uint16_t text_len;
+    uint16_t rx_queue;
+    uint8_t tenant;         // index in tenants[]
+};
 
-struct rte_hash *hash_table;
 struct rte_mempool *mbuf_pool;
-FILE *log_file; 
 
-int create_hash_table_from_json(const char *json_file) {
-    printf("Creating hash table from %s...\n", json_file);
-    FILE *file = fopen(json_file, "r");
-    if (!file) {
-        printf("Error: Could not open JSON file '%s'\n", json_file);
-        return -1;
-    }
-    fseek(file, 0, SEEK_END);
-    long file_size = ftell(file);
-    fseek(file, 0, SEEK_SET);
-    char *json_data = malloc(file_size + 1);
-    fread(json_data, 1, file_size, file);
-    fclose(file);
-    json_data[file_size] = '\0';
+static enum tok_mode mode = MODE_CHAR;
+static enum tx_mode tx_mode = TX_INPLACE;
+static struct rte_ether_addr port_mac;
+static struct tenant tenants[MAX_TENANTS];
+static unsigned nb_tenants;
+static char *tenant_specs[MAX_TENANTS - 1];    // --tenant PORT:MODE:VOCAB[:MERGES]
+static unsigned nb_tenant_specs;
+static struct rte_rcu_qsbr *engine_qsbr;
+static const char *ctl_socket = CTL_SOCKET;
+static const char *vocab_file = "data.json";
+static const char *merges_file;
+static uint16_t mbuf_data = MAX_PACKET_SIZE;   // per-mbuf data room; smaller values chain segments
+static uint32_t reasm_entries = REASM_ENTRIES;
+static uint32_t wcache_entries = WCACHE_ENTRIES;
+static uint32_t reasm_timeout_ms = REASM_TIMEOUT_MS;
+static uint16_t port_id;
+static uint16_t nb_rx_queues, nb_tx_queues;
+static uint16_t metrics_port;
+static uint64_t tx_drain_cycles;
+static uint32_t tx_drain_us = TX_DRAIN_US;
+static uint32_t trace_events = TRACE_EVENTS;
+static uint32_t trace_threshold_us;
+static const char *trace_dir = ".";
+static enum topology topology = TOPO_RTC;
+static unsigned nb_rx_cores = 1;
+static unsigned nb_tx_cores = 1;
+static int work_stealing;
+static struct lcore_conf lcore_conf[RTE_MAX_LCORE];
+static unsigned worker_lcores[RTE_MAX_LCORE];
+static unsigned nb_workers;
+static int req_meta_offset = -1;
+static int quiet;
+static volatile int force_quit;
+
+static inline void count_drops(struct lcore_conf *lc, enum drop_reason reason, unsigned n) {
+    lc->dropped += n;
+    lc->drops[reason] += n;
+}
+
+static inline struct req_meta *req_meta(struct rte_mbuf *m) {
+    return RTE_MBUF_DYNFIELD(m, req_meta_offset, struct req_meta *);
+}
+
+static int parse_mode(const char *name) {
+    for (unsigned i = 0; i < RTE_DIM(mode_names); i++)
+        if (!strcmp(name, mode_names[i])) return i;
+    return -1;
+}
+
+int create_trie_from_json(struct tok_engine *eng, const char *json_file) {
+    printf("Creating vocabulary trie from %s...\n", json_file);
+    long file_size;
+    char *json_data = vocab_read_file(json_file, &file_size);
+    if (!json_data) return -1;
     cJSON *json = cJSON_Parse(json_data);
     if (!json) {
         printf("Error: Failed to parse JSON: %s\n", cJSON_GetErrorPtr());
         free(json_data);
         return -1;
     }
-    struct rte_hash_parameters hash_params = {
-        .name = "json_hash_table",
-        .entries = HASH_TABLE_SIZE,
-        .key_len = 32,
-        .hash_func = rte_jhash,
-        .hash_func_init_val = 0,
-    };
-    hash_table = rte_hash_create(&hash_params);
-    if (!hash_table) {
-        printf("Error: Failed to create hash table\n");
+    int count = cJSON_GetArraySize(json);
+    struct vocab_token *tokens = calloc(count ? count : 1, sizeof(*tokens));
+    if (!tokens) {
         cJSON_Delete(json);
         free(json_data);
         return -1;
     }
-    printf("Hash table created successfully\n");
-    int count = 0;
+    int n = 0;
     cJSON *item;
     cJSON_ArrayForEach(item, json) {
-        char *key = item->string;
-        int value = item->valueint;
-        char padded_key[32] = {0};
-        size_t key_len = strlen(key);
-        if (key_len > 32) key_len = 32;
-        memcpy(padded_key, key, key_len);
-        int *value_ptr = malloc(sizeof(int));
-        *value_ptr = value;
-        int ret = rte_hash_add_key_data(hash_table, padded_key, value_ptr);
-        if (ret < 0) {
-            free(value_ptr);
-            printf("Warning: Failed to add key '%s' to hash table\n", key);
-        } else {
-            count++;
-        }
+        if (!item->string || !item->string[0]) continue;
+        tokens[n].bytes = (const uint8_t *)item->string;
+        tokens[n].len = strlen(item->string);
+        tokens[n].id = item->valueint;
+        n++;
     }
-    printf("Added %d entries to hash table\n", count);
+    eng->trie = da_trie_build(tokens, n);
+    free(tokens);
     cJSON_Delete(json);
     free(json_data);
+    if (!eng->trie) return -1;
+    printf("Added %u entries to vocabulary trie\n", eng->trie->nb_keys);
+    return 0;
+}
+
+int create_trie_from_image(struct tok_engine *eng, const char *image_file) {
+    printf("Loading vocabulary image %s...\n", image_file);
+    eng->image = vocab_image_open(image_file);
+    if (!eng->image) return -1;
+    eng->trie = da_trie_from_image(eng->image);
+    if (!eng->trie) return -1;
+    printf("Loaded %u entries\n", eng->trie->nb_keys);
     return 0;
 }
 
-void tokenize_text(const char *text, int *input_ids, int *attention_mask) {
-    if (!hash_table) {
-        printf("Error: hash_table is NULL\n");
+static void engine_free(struct tok_engine *eng) {
+    if (!eng) return;
+    da_trie_free(eng->trie);
+    vocab_image_close(eng->image);
+    bpe_free(eng->bpe);
+    wordpiece_free(eng->wordpiece);
+    rte_free(eng);
+}
+
+// Images from vocab/compile_vocab.py are used in place; anything else is
+// parsed and indexed.
+static struct tok_engine *engine_load(enum tok_mode mode, const char *vocab_file, const char *merges_file) {
+    struct tok_engine *eng = rte_zmalloc("tok_engine", sizeof(*eng), RTE_CACHE_LINE_SIZE);
+    if (!eng) return NULL;
+    eng->mode = mode;
+    int image = vocab_is_image(vocab_file);
+    uint64_t load_start = rte_rdtsc();
+    if (mode == MODE_CHAR) {
+        if ((image ? create_trie_from_image(eng, vocab_file) : create_trie_from_json(eng, vocab_file)) < 0) {
+            printf("Error: Failed to load vocabulary trie\n");
+            goto fail;
+        }
+        eng->max_token_id = RTE_MAX(eng->trie->vocab_size - 1, 102u);
+    } else if (mode == MODE_WORDPIECE) {
+        eng->wordpiece = image ? wordpiece_create_from_image(vocab_file, 1) : wordpiece_create(vocab_file, 1);
+        if (!eng->wordpiece) {
+            printf("Error: Failed to load WordPiece vocabulary\n");
+            goto fail;
+        }
+        eng->max_token_id = eng->wordpiece->trie->vocab_size - 1;
+    } else {
+        enum bpe_pretok pretok = mode == MODE_LLAMA3 ? BPE_PRETOK_LLAMA3 : BPE_PRETOK_GPT2;
+        eng->bpe = image ? bpe_create_from_image(vocab_file, pretok)
+                         : bpe_create_from_json(vocab_file, merges_file, pretok);
+        if (!eng->bpe) {
+            printf("Error: Failed to load BPE vocabulary\n");
+            goto fail;
+        }
+        eng->max_token_id = eng->bpe->vocab_size - 1;
+    }
+    printf("Vocabulary ready in %.2f ms (%s)\n",
+           (double)(rte_rdtsc() - load_start) * 1000 / rte_get_tsc_hz(), image ? "image" : "source");
+    return eng;
+
+fail:
+    engine_free(eng);
+    return NULL;
+}
+
+// Publishes eng for t, then frees the engine it replaces once every lcore
+// has passed a quiescent point and no fragmented request still holds it. The
+// lcores never wait: each request runs on whichever engine it started with.
+static void engine_swap(struct tenant *t, struct tok_engine *eng) {
+    struct tok_engine *old = __atomic_exchange_n(&t->engine, eng, __ATOMIC_ACQ_REL);
+    rte_rcu_qsbr_synchronize(engine_qsbr, RTE_QSBR_THRID_INVALID);
+    while (__atomic_load_n(&old->refs, __ATOMIC_ACQUIRE))
+        rte_delay_us_sleep(1000);
+    engine_free(old);
+}
+
+static int find_tenant(uint16_t udp_port) {
+    for (unsigned i = 0; i < nb_tenants; i++)
+        if (tenants[i].udp_port == udp_port) return i;
+    return -1;
+}
+
+// Parses PORT:MODE:VOCAB[:MERGES] in place and loads the tenant's engine.
+static int add_tenant(char *spec) {
+    char *save;
+    char *port = strtok_r(spec, ":", &save);
+    char *name = strtok_r(NULL, ":", &save);
+    char *vocab = strtok_r(NULL, ":", &save);
+    char *merges = strtok_r(NULL, ":", &save);
+    int tenant_mode = name ? parse_mode(name) : -1;
+    int udp_port = port ? atoi(port) : 0;
+    if (udp_port <= 0 || udp_port > UINT16_MAX || tenant_mode < 0 || !vocab) {
+        printf("Error: Invalid tenant, expected PORT:MODE:VOCAB[:MERGES]\n");
+        return -1;
+    }
+    if (find_tenant(rte_cpu_to_be_16(udp_port)) >= 0) {
+        printf("Error: Port %d has two tenants\n", udp_port);
+        return -1;
+    }
+    struct tok_engine *eng = engine_load(tenant_mode, vocab, merges);
+    if (!eng) return -1;
+    tenants[nb_tenants].udp_port = rte_cpu_to_be_16(udp_port);
+    tenants[nb_tenants].engine = eng;
+    nb_tenants++;
+    printf("Tenant on port %d: %s %s\n", udp_port, name, vocab);
+    return 0;
+}
+
+static const char *const lat_batch_names[LAT_BATCH_CLASSES] = { "1", "2-3", "4-7", "8-15", "16-31", "32-63", "64+" };
+static const char *const lat_size_names[LAT_SIZE_CLASSES] = { "0-63", "64-255", "256-1023", "1024-4095", "4096+" };
+
+static inline int lat_size_class(uint32_t text_bytes) {
+    int s = (31 - __builtin_clz(text_bytes | 1) - 4) / 2;
+    return RTE_MAX(RTE_MIN(s, LAT_SIZE_CLASSES - 1), 0);
+}
+
+// A few cycles and one store into this lcore's own histograms, in place of
+// a log line per request.
+static inline void record_latency(struct lcore_conf *lc, int batch_size, uint32_t text_bytes, uint64_t cycles) {
+    int b = RTE_MIN(31 - __builtin_clz((unsigned)batch_size | 1), LAT_BATCH_CLASSES - 1);
+    int s = lat_size_class(text_bytes);
+    hist_record(&lc->latency[b * LAT_SIZE_CLASSES + s], cycles);
+#ifdef STAGE_STATS
+    lc->stage_requests[s]++;
+#endif
+}
+
+// Sums the latency histograms of every lcore, class by class, into
+// out[LAT_CLASSES] and all classes into *all. The lcores keep recording
+// meanwhile, so the latest requests may be missing.
+static void merge_latency(struct hist *out, struct hist *all) {
+    memset(out, 0, sizeof(*out) * LAT_CLASSES);
+    memset(all, 0, sizeof(*all));
+    unsigned lcore_id;
+    RTE_LCORE_FOREACH(lcore_id) {
+        const struct hist *lat = lcore_conf[lcore_id].latency;
+        if (!lat) continue;
+        for (unsigned c = 0; c < LAT_CLASSES; c++) hist_merge(&out[c], &lat[c]);
+    }
+    for (unsigned c = 0; c < LAT_CLASSES; c++) hist_merge(all, &out[c]);
+}
+
+static double latency_us(const struct hist *h, double percentile) {
+    return (double)hist_percentile(h, percentile) * 1e6 / rte_get_timer_hz();
+}
+
+static void format_latency(const struct hist *h, char *buf, size_t size) {
+    snprintf(buf, size, "%" PRIu64 " requests, p50 %.2f us, p99 %.2f us, p99.9 %.2f us, max %.2f us", hist_count(h),
+             latency_us(h, 50), latency_us(h, 99), latency_us(h, 99.9), latency_us(h, 100));
+}
+
+// Percentiles 0 to 100, and 99.9 and 99.99, of every class that has
+// requests and of all of them together, as plot_latency_quantiles.py reads
+// them.
+static int write_latency_csv(const char *path, const struct hist *classes, const struct hist *all) {
+    static const double tail[] = { 99.9, 99.99, 100 };
+    FILE *f = fopen(path, "w");
+    if (!f) {
+        printf("Error: Cannot write %s\n", path);
+        return -1;
+    }
+    fprintf(f, "BatchSize,PayloadBytes,Requests,Percentile,TokenizationTime_us\n");
+    for (int c = -1; c < LAT_CLASSES; c++) {
+        const struct hist *h = c < 0 ? all : &classes[c];
+        uint64_t n = hist_count(h);
+        if (!n) continue;
+        const char *batch = c < 0 ? "all" : lat_batch_names[c / LAT_SIZE_CLASSES];
+        const char *bytes = c < 0 ? "all" : lat_size_names[c % LAT_SIZE_CLASSES];
+        for (unsigned i = 0; i < 100 + RTE_DIM(tail); i++) {
+            double p = i < 100 ? i : tail[i - 100];
+            fprintf(f, "%s,%s,%" PRIu64 ",%g,%.2f\n", batch, bytes, n, p, latency_us(h, p));
+        }
+    }
+    fclose(f);
+    return 0;
+}
+
+// Latency of all requests so far, and per class unless --quiet.
+static void print_latency(void) {
+    struct hist *classes = calloc(LAT_CLASSES, sizeof(*classes));
+    struct hist all;
+    char line[256];
+    if (!classes) return;
+    merge_latency(classes, &all);
+    format_latency(&all, line, sizeof(line));
+    printf("Latency: %s\n", line);
+    if (!quiet) {
+        for (unsigned c = 0; c < LAT_CLASSES; c++) {
+            if (!hist_count(&classes[c])) continue;
+            format_latency(&classes[c], line, sizeof(line));
+            printf("  batch %s, %s bytes: %s\n", lat_batch_names[c / LAT_SIZE_CLASSES],
+                   lat_size_names[c % LAT_SIZE_CLASSES], line);
+        }
+        if (write_latency_csv(LAT_CSV, classes, &all) == 0) printf("Latency percentiles written to %s\n", LAT_CSV);
+    }
+    free(classes);
+}
+
+#ifdef STAGE_STATS
+static const char *const stage_names[NB_STAGES] = { "parse", "count", "tokenize", "format", "tx" };
+
+// Cycles per answered request in each stage, summed over all lcores, by
+// payload size. A fragment is charged to the class of its own size.
+static void print_stages(void) {
+    uint64_t cycles[LAT_SIZE_CLASSES + 1][NB_STAGES] = { { 0 } };
+    uint64_t requests[LAT_SIZE_CLASSES + 1] = { 0 };
+    unsigned lcore_id;
+    RTE_LCORE_FOREACH(lcore_id) {
+        const struct lcore_conf *lc = &lcore_conf[lcore_id];
+        for (int c = 0; c < LAT_SIZE_CLASSES; c++) {
+            requests[c] += lc->stage_requests[c];
+            requests[LAT_SIZE_CLASSES] += lc->stage_requests[c];
+            for (int st = 0; st < NB_STAGES; st++) {
+                cycles[c][st] += lc->stage_cycles[c][st];
+                cycles[LAT_SIZE_CLASSES][st] += lc->stage_cycles[c][st];
+            }
+        }
+    }
+    printf("Stage cycles per request:\n%-10s %10s", "bytes", "requests");
+    for (int st = 0; st < NB_STAGES; st++) printf(" %9s", stage_names[st]);
+    printf(" %9s\n", "total");
+    for (int c = 0; c <= LAT_SIZE_CLASSES; c++) {
+        if (!requests[c]) continue;
+        uint64_t total = 0;
+        printf("%-10s %10" PRIu64, c < LAT_SIZE_CLASSES ? lat_size_names[c] : "all", requests[c]);
+        for (int st = 0; st < NB_STAGES; st++) {
+            printf(" %9.0f", (double)cycles[c][st] / requests[c]);
+            total += cycles[c][st];
+        }
+        printf(" %9.0f\n", (double)total / requests[c]);
+    }
+}
+#else
+static void print_stages(void) {
+}
+#endif
+
+// latency [CSV]: percentiles of the requests answered so far, and all of
+// them written to CSV if given.
+static void ctl_latency(const char *path, char *reply, size_t size) {
+    struct hist *classes = calloc(LAT_CLASSES, sizeof(*classes));
+    struct hist all;
+    if (!classes) {
+        snprintf(reply, size, "ERR out of memory");
+        return;
+    }
+    merge_latency(classes, &all);
+    if (path && write_latency_csv(path, classes, &all) < 0) snprintf(reply, size, "ERR cannot write %s", path);
+    else {
+        char line[256];
+        format_latency(&all, line, sizeof(line));
+        snprintf(reply, size, "OK %s", line);
+    }
+    free(classes);
+}
+
+// reload [PORT] MODE VOCAB [MERGES]: the new vocabulary for the tenant on
+// PORT (default 67) is loaded on the control thread while the lcores keep
+// serving with the old one.
+static void ctl_command(char *line, char *reply, size_t size) {
+    char *save;
+    char *cmd = strtok_r(line, " \t", &save);
+    if (!cmd) {
+        snprintf(reply, size, "ERR empty command");
         return;
     }
-    size_t len = strlen(text);
-    input_ids[0] = 101; 
-    attention_mask[0] = 1;
-    int token_pos = 1;
-    for (int i = 0; i < len && token_pos < MAX_SEQUENCE_LENGTH - 1; i++) {
-        char key[2] = {text[i], '\0'};
-        char padded_key[32] = {0};
-        memcpy(padded_key, key, 1);
-        int *value = NULL;
-        int ret = rte_hash_lookup_data(hash_table, padded_key, (void **)&value);
-        if (ret >= 0 && value) {
-            input_ids[token_pos] = *value;
-            attention_mask[token_pos] = 1;
-            token_pos++;
+    if (!strcmp(cmd, "latency")) {
+        ctl_latency(strtok_r(NULL, " \t", &save), reply, size);
+        return;
+    }
+    if (strcmp(cmd, "reload")) {
+        snprintf(reply, size, "ERR unknown command '%s'", cmd);
+        return;
+    }
+    char *name = strtok_r(NULL, " \t", &save);
+    int udp_port = UDP_PORT;
+    if (name && isdigit((unsigned char)name[0])) {
+        udp_port = atoi(name);
+        name = strtok_r(NULL, " \t", &save);
+    }
+    char *vocab = strtok_r(NULL, " \t", &save);
+    char *merges = strtok_r(NULL, " \t", &save);
+    int new_mode = name ? parse_mode(name) : -1;
+    if (new_mode < 0 || !vocab) {
+        snprintf(reply, size, "ERR usage: reload [PORT] char|gpt2|llama3|wordpiece VOCAB [MERGES]");
+        return;
+    }
+    int t = udp_port <= UINT16_MAX ? find_tenant(rte_cpu_to_be_16(udp_port)) : -1;
+    if (t < 0) {
+        snprintf(reply, size, "ERR no tenant on port %d", udp_port);
+        return;
+    }
+    uint64_t start = rte_rdtsc();
+    struct tok_engine *eng = engine_load(new_mode, vocab, merges);
+    if (!eng) {
+        snprintf(reply, size, "ERR cannot load %s", vocab);
+        return;
+    }
+    engine_swap(&tenants[t], eng);
+    printf("Switched port %d to %s vocabulary %s\n", udp_port, name, vocab);
+    snprintf(reply, size, "OK %d %s %s, max id %u, %.2f ms", udp_port, name, vocab, eng->max_token_id,
+             (double)(rte_rdtsc() - start) * 1000 / rte_get_tsc_hz());
+}
+
+// Greedy longest match in one forward scan; bytes that start no token are
+// skipped, as the per-character lookup did. Without final, matching stops
+// where a longer token could still run past the end of the buffer.
+static int char_encode_partial(const void *engine, const char *text, size_t len, int final, size_t *consumed,
+                               int *ids, int max_ids) {
+    const struct da_trie *trie = engine;
+    const uint8_t *s = (const uint8_t *)text;
+    int n = 0;
+    size_t i = 0;
+    while (i < len && n < max_ids) {
+        if (!final && len - i < trie->max_len) break;
+        int id;
+        size_t match = da_trie_longest(trie, s + i, len - i, &id);
+        if (!match) {
+            i++;
+            continue;
         }
+        ids[n++] = id;
+        i += match;
     }
-    if (token_pos < MAX_SEQUENCE_LENGTH) {
-        input_ids[token_pos] = 102; 
-        attention_mask[token_pos] = 1;
+    *consumed = i;
+    return n;
+}
+
+// BPE and WordPiece go through the calling lcore's word cache.
+static int bpe_encode_stream(const void *engine, const char *text, size_t len, int final, size_t *consumed,
+                             int *ids, int max_ids) {
+    struct wcache *cache = lcore_conf[rte_lcore_id()].wcache;
+    return bpe_encode_partial(engine, cache, text, len, final, consumed, ids, max_ids);
+}
+
+static int wordpiece_encode_stream(const void *engine, const char *text, size_t len, int final, size_t *consumed,
+                                   int *ids, int max_ids) {
+    struct wcache *cache = lcore_conf[rte_lcore_id()].wcache;
+    return wordpiece_encode_partial(engine, cache, text, len, final, consumed, ids, max_ids);
+}
+
+// Writes the engine's leading special token and points st past it.
+static void tokenize_begin(const struct tok_engine *eng, struct tok_stream *st, int *input_ids) {
+    int n = 0;
+    if (eng->mode == MODE_CHAR) {
+        input_ids[n++] = 101;
+        stream_init(st, char_encode_partial, eng->trie, input_ids + n, MAX_SEQUENCE_LENGTH - 2);
+    } else if (eng->mode == MODE_WORDPIECE) {
+        input_ids[n++] = eng->wordpiece->cls_id;
+        stream_init(st, wordpiece_encode_stream, eng->wordpiece, input_ids + n, MAX_SEQUENCE_LENGTH - 2);
+    } else {
+        if (eng->bpe->bos_id >= 0) input_ids[n++] = eng->bpe->bos_id;
+        stream_init(st, bpe_encode_stream, eng->bpe, input_ids + n, MAX_SEQUENCE_LENGTH - n);
     }
 }
 
-static int count_tokens(const char *text) {
-    int count = 0;
-    char *copy = strdup(text);
-    char *token = strtok(copy, " ");
-    while (token) {
-        count++;
-        token = strtok(NULL, " ");
+// Feeds len bytes of m starting at off. The text is read segment by segment
+// where the NIC scattered it, so a jumbo request received into small mbufs
+// is never linearized.
+static void tokenize_feed(struct tok_stream *st, const struct rte_mbuf *m, uint32_t off, uint32_t len, int last) {
+    for (const struct rte_mbuf *seg = m; seg && len; seg = seg->next) {
+        if (off >= seg->data_len) {
+            off -= seg->data_len;
+            continue;
+        }
+        uint32_t chunk = RTE_MIN((uint32_t)seg->data_len - off, len);
+        len -= chunk;
+        stream_feed(st, rte_pktmbuf_mtod_offset(seg, const char *, off), chunk, last && !len);
+        if (!len) return;
+        off = 0;
+    }
+    if (last) stream_feed(st, "", 0, 1);
+}
+
+// Appends the trailing special token and returns the sequence length.
+static int tokenize_end(const struct tok_engine *eng, const struct tok_stream *st, int *input_ids) {
+    int n = st->ids - input_ids + st->nb_ids;
+    if (eng->mode == MODE_CHAR) input_ids[n++] = 102;
+    else if (eng->mode == MODE_WORDPIECE) input_ids[n++] = eng->wordpiece->sep_id;
+    return n;
+}
+
+static int tokenize(const struct tok_engine *eng, const struct rte_mbuf *m, uint32_t off, uint32_t len,
+                    int *input_ids) {
+    struct tok_stream st;
+    tokenize_begin(eng, &st, input_ids);
+    tokenize_feed(&st, m, off, len, 1);
+    return tokenize_end(eng, &st, input_ids);
+}
+
+// Space-separated words across all segments, the batch size of the request.
+static int count_tokens(const struct rte_mbuf *m, uint32_t off, uint32_t len) {
+    int count = 0, in_word = 0;
+    for (const struct rte_mbuf *seg = m; seg && len; seg = seg->next) {
+        if (off >= seg->data_len) {
+            off -= seg->data_len;
+            continue;
+        }
+        uint32_t chunk = RTE_MIN((uint32_t)seg->data_len - off, len);
+        const char *p = rte_pktmbuf_mtod_offset(seg, const char *, off);
+        for (uint32_t j = 0; j < chunk; j++) {
+            if (p[j] == ' ') in_word = 0;
+            else if (!in_word) {
+                in_word = 1;
+                count++;
+            }
+        }
+        len -= chunk;
+        off = 0;
     }
-    free(copy);
     return count;
 }
 
-static int lcore_main(__rte_unused void *arg) {
-    uint16_t port_id = 0;
+// Fragments reach here in order; each is tokenized on arrival so the
+// response is ready as soon as the last one is in. The request holds a
+// reference on the engine it started with, so a reload cannot free it or
+// switch vocabularies halfway through.
+static void reasm_feed(struct reasm_entry *e, const struct rte_mbuf *m, uint32_t off, uint32_t len) {
+    if (e->next == 0) {
+        const struct req_meta *meta = RTE_MBUF_DYNFIELD(m, req_meta_offset, const struct req_meta *);
+        struct tok_engine *eng = __atomic_load_n(&tenants[meta->tenant].engine, __ATOMIC_ACQUIRE);
+        __atomic_fetch_add(&eng->refs, 1, __ATOMIC_RELAXED);
+        e->ctx = eng;
+        tokenize_begin(eng, &e->stream, e->ids);
+    }
+    e->words += count_tokens(m, off, len);
+    e->bytes += len;
+    tokenize_feed(&e->stream, m, off, len, e->next + 1 == e->count);
+}
+
+static void reasm_close(struct reasm_entry *e) {
+    struct tok_engine *eng = e->ctx;
+    __atomic_fetch_sub(&eng->refs, 1, __ATOMIC_RELEASE);
+}
+
+// New frame from the server to the sender of m carrying len bytes of payload.
+static struct rte_mbuf *build_frame(const struct rte_mbuf *m, const uint8_t *payload, int len) {
+    const struct rte_ether_hdr *eth_hdr = rte_pktmbuf_mtod(m, const struct rte_ether_hdr *);
+    const struct rte_udp_hdr *udp_hdr = (const struct rte_udp_hdr *)(eth_hdr + 1);
+
+    struct rte_mbuf *response_mbuf = rte_pktmbuf_alloc(mbuf_pool);
+    if (!response_mbuf) return NULL;
+
+    char *data_ptr = rte_pktmbuf_append(response_mbuf, sizeof(struct rte_ether_hdr) + sizeof(struct rte_udp_hdr));
+    if (!data_ptr) {
+        rte_pktmbuf_free(response_mbuf);
+        return NULL;
+    }
+
+    struct rte_ether_hdr *resp_eth_hdr = (struct rte_ether_hdr *)data_ptr;
+    rte_ether_addr_copy(&eth_hdr->src_addr, &resp_eth_hdr->dst_addr);
+    rte_ether_addr_copy(&port_mac, &resp_eth_hdr->src_addr);
+    resp_eth_hdr->ether_type = eth_hdr->ether_type;
+
+    struct rte_udp_hdr *resp_udp_hdr = (struct rte_udp_hdr *)(resp_eth_hdr + 1);
+    resp_udp_hdr->src_port = udp_hdr->dst_port;
+    resp_udp_hdr->dst_port = udp_hdr->src_port;
+    resp_udp_hdr->dgram_len = rte_cpu_to_be_16(sizeof(struct rte_udp_hdr) + len);
+    resp_udp_hdr->dgram_cksum = 0;
+
+    // Responses larger than one mbuf are chained, like the requests.
+    while (len > 0) {
+        uint16_t chunk = RTE_MIN(len, rte_pktmbuf_tailroom(rte_pktmbuf_lastseg(response_mbuf)));
+        if (!chunk) {
+            struct rte_mbuf *seg = rte_pktmbuf_alloc(mbuf_pool);
+            if (!seg || rte_pktmbuf_chain(response_mbuf, seg) < 0) {
+                rte_pktmbuf_free(seg);
+                rte_pktmbuf_free(response_mbuf);
+                return NULL;
+            }
+            continue;
+        }
+        memcpy(rte_pktmbuf_append(response_mbuf, chunk), payload, chunk);
+        payload += chunk;
+        len -= chunk;
+    }
+    return response_mbuf;
+}
+
+static struct rte_mbuf *build_response_copy(struct rte_mbuf *m, uint8_t format, const int *ids, int nb_ids) {
+    uint8_t response_payload[MAX_PAYLOAD];
+    int len = proto_encode(format, ids, nb_ids, response_payload, MAX_PAYLOAD);
+    return build_frame(m, response_payload, len);
+}
+
+// Splits a response too long for one frame into parts with sequence numbers
+// (proto_encode_part), to be sent in one burst. Returns the number of frames
+// in out, 0 on allocation failure.
+static int build_response_parts(struct rte_mbuf *m, uint8_t format, uint32_t req_id, const int *ids, int nb_ids,
+                                struct rte_mbuf **out) {
+    const uint32_t part_off = sizeof(struct rte_ether_hdr) + sizeof(struct rte_udp_hdr);
+    uint8_t part[MAX_PAYLOAD];
+    int n = 0, sent = 0;
+    do {
+        int done;
+        int len = proto_encode_part(format, ids + sent, nb_ids - sent, req_id, n, part, MAX_PAYLOAD, &done);
+        out[n] = build_frame(m, part, len);
+        if (!out[n]) {
+            rte_pktmbuf_free_bulk(out, n);
+            return 0;
+        }
+        n++;
+        sent += done;
+    } while (sent < nb_ids && n < MAX_RESPONSE_FRAMES);
+    for (int k = 0; k < n; k++)
+        proto_set_part_count(rte_pktmbuf_mtod_offset(out[k], uint8_t *, part_off), n);
+    if (sent < nb_ids) rte_pktmbuf_mtod_offset(out[n - 1], struct proto_resp_hdr *, part_off)->flags |= PROTO_F_TRUNCATED;
+    return n;
+}
+
+// Turns the request mbuf into the response: ids are formatted over the
+// request payload (already tokenized) and the headers are swapped in place.
+// Returns NULL for segmented requests, and for mbufs too small to be sure of
+// holding the whole response, which take the copy path instead.
+static struct rte_mbuf *build_response_inplace(struct rte_mbuf *m, uint8_t format, uint32_t max_id, const int *ids,
+                                               int nb_ids) {
+    if (!rte_pktmbuf_is_contiguous(m)) return NULL;
+    const int hdr_len = sizeof(struct rte_ether_hdr) + sizeof(struct rte_udp_hdr);
+    struct rte_ether_hdr *eth_hdr = rte_pktmbuf_mtod(m, struct rte_ether_hdr *);
+    struct rte_udp_hdr *udp_hdr = (struct rte_udp_hdr *)(eth_hdr + 1);
+
+    int room = m->data_len - hdr_len + rte_pktmbuf_tailroom(m);
+    if (room > MAX_PAYLOAD) room = MAX_PAYLOAD;
+    if (room < proto_max_len(format, nb_ids, max_id)) return NULL;
+    int len = proto_encode(format, ids, nb_ids, (uint8_t *)(udp_hdr + 1), room);
+
+    int diff = hdr_len + len - (int)m->pkt_len;
+    if (diff > 0 && !rte_pktmbuf_append(m, diff)) return NULL;
+    if (diff < 0) rte_pktmbuf_trim(m, -diff);
+
+    rte_ether_addr_copy(&eth_hdr->src_addr, &eth_hdr->dst_addr);
+    rte_ether_addr_copy(&port_mac, &eth_hdr->src_addr);
+    uint16_t src_port = udp_hdr->src_port;
+    udp_hdr->src_port = udp_hdr->dst_port;
+    udp_hdr->dst_port = src_port;
+    udp_hdr->dgram_len = rte_cpu_to_be_16(sizeof(struct rte_udp_hdr) + len);
+    udp_hdr->dgram_cksum = 0;
+    return m;
+}
+
+// Checks that m is a request for us and parses its header into the mbuf's
+// req_meta. Returns -1 for frames to drop.
+static int parse_request(struct rte_mbuf *m, enum drop_reason *reason) {
+    *reason = DROP_SHORT;
+    if (m->data_len < PAYLOAD_OFF) return -1;
+    uint64_t start_cycles = rte_get_timer_cycles();
+    struct rte_ether_hdr *eth_hdr = rte_pktmbuf_mtod(m, struct rte_ether_hdr *);
+    struct rte_udp_hdr *udp_hdr = (struct rte_udp_hdr *)(eth_hdr + 1);
+    int tenant = find_tenant(udp_hdr->dst_port);
+    if (tenant < 0) {
+        *reason = DROP_NO_TENANT;
+        return -1;
+    }
+
+    // Only the headers are guaranteed to sit in the first segment;
+    // the payload may continue in chained mbufs.
+    int payload_len = rte_be_to_cpu_16(udp_hdr->dgram_len) - sizeof(struct rte_udp_hdr);
+    if (PAYLOAD_OFF + payload_len > m->pkt_len) return -1;
+    if (payload_len <= 0 || payload_len > MAX_PACKET_SIZE) {
+        *reason = DROP_OVERSIZE;
+        return -1;
+    }
+
+    struct req_meta *meta = req_meta(m);
+    uint8_t req_buf[PROTO_REQ_MAX_HDR];
+    int peek = RTE_MIN(payload_len, (int)sizeof(req_buf));
+    const uint8_t *req_hdr = rte_pktmbuf_read(m, PAYLOAD_OFF, peek, req_buf);
+    int hdr_len = proto_parse_request(req_hdr, peek, &meta->req);
+    if (hdr_len < 0) {
+        *reason = DROP_BAD_HEADER;
+        return -1;
+    }
+    meta->rx_tsc = start_cycles;
+    meta->tenant = tenant;
+    meta->hdr_len = hdr_len;
+    meta->text_len = payload_len - hdr_len;
+    return 0;
+}
+
+// Tokenizes a parsed request and builds its response frames in tx. Returns
+// the frame count, with ev filled in up to the send for the latency
+// histograms and the trace, or 0 when m was held as a fragment of an open
+// request or dropped.
+static int handle_request(struct lcore_conf *lc, struct rte_mbuf *m, struct rte_mbuf **tx, struct trace_event *ev) {
+    STAGE_BEGIN(stage_tsc);
+    const struct req_meta meta = *req_meta(m);
+    struct rte_ether_hdr *eth_hdr = rte_pktmbuf_mtod(m, struct rte_ether_hdr *);
+    struct rte_udp_hdr *udp_hdr = (struct rte_udp_hdr *)(eth_hdr + 1);
+    const struct tok_engine *eng = __atomic_load_n(&tenants[meta.tenant].engine, __ATOMIC_ACQUIRE);
+    uint32_t text_off = PAYLOAD_OFF + meta.hdr_len;
+
+    int nb_ids;
+    int input_ids[MAX_SEQUENCE_LENGTH];
+    const int *ids = input_ids;
+    struct reasm_entry *entry = NULL;
+    uint64_t cache_hits = lc->wcache ? lc->wcache->stats.hits : 0;
+    uint64_t cache_misses = lc->wcache ? lc->wcache->stats.misses : 0;
+    *ev = (struct trace_event){
+        .rx_tsc = meta.rx_tsc,
+        .rx_queue = meta.rx_queue,
+        .tenant = meta.tenant,
+        .flags = meta.hdr_len ? TRACE_PROTO : 0,
+    };
+    uint32_t words;
+    if (meta.req.frag_count > 1) {
+        int ret = reasm_fragment(lc->reasm, m, &eth_hdr->src_addr, udp_hdr->src_port, udp_hdr->dst_port,
+                                 meta.req.req_id, meta.req.frag_index, meta.req.frag_count, text_off, meta.text_len,
+                                 meta.rx_tsc, &entry);
+        if (ret < 0) {
+            count_drops(lc, DROP_REASM, 1);
+            rte_pktmbuf_free(m);
+            return 0;
+        }
+        if (ret == REASM_PENDING) {
+            STAGE_END(lc, stage_tsc, meta.text_len, STAGE_TOKENIZE);
+            return 0;
+        }
+        eng = entry->ctx;
+        words = entry->words;
+        ev->text_len = entry->bytes;
+        nb_ids = tokenize_end(eng, &entry->stream, entry->ids);
+        ids = entry->ids;
+        ev->rx_tsc = entry->start_tsc;
+        ev->flags |= TRACE_FRAGMENTED;
+        STAGE_END(lc, stage_tsc, meta.text_len, STAGE_TOKENIZE);
+    } else {
+        words = count_tokens(m, text_off, meta.text_len);
+        ev->text_len = meta.text_len;
+        STAGE_END(lc, stage_tsc, meta.text_len, STAGE_COUNT);
+        nb_ids = tokenize(eng, m, text_off, meta.text_len, input_ids);
+        STAGE_END(lc, stage_tsc, meta.text_len, STAGE_TOKENIZE);
+    }
+    ev->tokenized = trace_since(ev->rx_tsc, rte_get_timer_cycles());
+    ev->words = RTE_MIN(words, UINT16_MAX);
+    ev->nb_ids = RTE_MIN((unsigned)nb_ids, UINT16_MAX);
+    if (lc->wcache) {
+        ev->cache_hits = RTE_MIN(lc->wcache->stats.hits - cache_hits, UINT16_MAX);
+        ev->cache_misses = RTE_MIN(lc->wcache->stats.misses - cache_misses, UINT16_MAX);
+    }
+    uint8_t format = proto_resolve_format(meta.req.format, eng->max_token_id);
+
+    // Requests with a header get every id, over several frames if need be;
+    // legacy ASCII requests keep a single, truncated frame.
+    int nb_frames = 0;
+    if (meta.hdr_len && proto_max_len(format, nb_ids, eng->max_token_id) > MAX_PAYLOAD) {
+        nb_frames = build_response_parts(m, format, meta.req.req_id, ids, nb_ids, tx);
+    } else {
+        if (tx_mode == TX_INPLACE) tx[0] = build_response_inplace(m, format, eng->max_token_id, ids, nb_ids);
+        else tx[0] = NULL;
+        if (!tx[0]) tx[0] = build_response_copy(m, format, ids, nb_ids);
+        if (tx[0]) nb_frames = 1;
+    }
+    STAGE_END(lc, stage_tsc, meta.text_len, STAGE_FORMAT);
+    if (entry) reasm_release(lc->reasm, entry);
+    if (!nb_frames) {
+        rte_pktmbuf_free(m);
+        count_drops(lc, DROP_NO_MBUF, 1);
+        return 0;
+    }
+    if (tx[0] != m) rte_pktmbuf_free(m);
+    lc->ids += nb_ids;
+    return nb_frames;
+}
+
+// Ages out stalled fragmented requests and prints the reassembly counters
+// once a second while they change.
+static void reasm_tick(struct lcore_conf *lc, uint64_t now) {
+    struct reasm_table *reasm = lc->reasm;
+    if (now - lc->last_expire > reasm->max_cycles / 4) {
+        reasm_expire(reasm, now);
+        lc->last_expire = now;
+    }
+    if (now - lc->last_report > rte_get_timer_hz() && memcmp(&reasm->stats, &lc->reported, sizeof(lc->reported))) {
+        lc->reported = reasm->stats;
+        printf("Reassembly on lcore %u: %u in flight, %" PRIu64 " completed, %" PRIu64 " timed out, %" PRIu64
+               " evicted, %" PRIu64 " dropped\n", rte_lcore_id(), lc->reported.in_flight, lc->reported.completed,
+               lc->reported.timed_out, lc->reported.evicted, lc->reported.dropped);
+        lc->last_report = now;
+    }
+}
+
+// Prints what share of the last second this lcore spent on requests, once
+// a second while it is answering any.
+static void load_tick(struct lcore_conf *lc, uint64_t now) {
+    uint64_t elapsed = now - lc->last_load;
+    if (elapsed < rte_get_timer_hz()) return;
+    if (lc->requests != lc->load_requests) {
+        printf("Lcore %u: %" PRIu64 " requests, %" PRIu64 " stolen, %" PRIu64 " dropped, %u queued, %.0f%% busy\n",
+               rte_lcore_id(), lc->requests, lc->stolen, lc->dropped, lc->ring ? rte_ring_count(lc->ring) : 0,
+               (double)(lc->busy_cycles - lc->load_busy) * 100 / elapsed);
+    }
+    if (lc->requests != lc->load_requests && lc->wcache) {
+        const struct wcache_stats *ws = &lc->wcache->stats;
+        printf("Word cache on lcore %u: %" PRIu64 " hits, %" PRIu64 " misses, %" PRIu64 " evictions, %.1f%% hit rate\n",
+               rte_lcore_id(), ws->hits, ws->misses, ws->evictions,
+               ws->hits + ws->misses ? (double)ws->hits * 100 / (ws->hits + ws->misses) : 0.0);
+    }
+    lc->load_requests = lc->requests;
+    lc->load_busy = lc->busy_cycles;
+    lc->last_load = now;
+}
+
+// Sends n frames on this lcore's TX queue. A full queue often frees
+// descriptors on the next call, so what it refuses is offered again a few
+// times before it is dropped.
+static void send_burst(struct lcore_conf *lc, struct rte_mbuf **pkts, uint16_t n) {
+    uint16_t sent = rte_eth_tx_burst(port_id, lc->tx_queue, pkts, n);
+    for (unsigned retry = 0; sent < n && retry < TX_RETRIES; retry++)
+        sent += rte_eth_tx_burst(port_id, lc->tx_queue, pkts + sent, n - sent);
+    lc->tx_packets += sent;
+    if (sent < n) {
+        rte_pktmbuf_free_bulk(pkts + sent, n - sent);
+        count_drops(lc, DROP_TX_FULL, n - sent);
+    }
+}
+
+// Error callback of the TX buffers: the frames a flush could not send.
+static void tx_unsent(struct rte_mbuf **pkts, uint16_t unsent, void *userdata) {
+    send_burst(userdata, pkts, unsent);
+}
+
+static inline void tx_flush(struct lcore_conf *lc) {
+    if (lc->tx_buffer->length) lc->tx_packets += rte_eth_tx_buffer_flush(port_id, lc->tx_queue, lc->tx_buffer);
+}
+
+// Flushes once the oldest buffered frame has waited --tx-drain.
+static inline void tx_drain(struct lcore_conf *lc, uint64_t now) {
+    if (lc->tx_buffer->length && now - lc->tx_first >= tx_drain_cycles) tx_flush(lc);
+}
+
+// Buffers a response's frames, in order, for the next flush. A full buffer
+// flushes itself; ready is when the response was tokenized, so the drain
+// deadline covers its oldest frame.
+static inline void tx_buffer_frames(struct lcore_conf *lc, struct rte_mbuf **tx, int nb_frames, uint64_t ready) {
+    for (int i = 0; i < nb_frames; i++) {
+        if (!lc->tx_buffer->length) lc->tx_first = ready;
+        lc->tx_packets += rte_eth_tx_buffer(port_id, lc->tx_queue, lc->tx_buffer, tx[i]);
+    }
+}
+
+// Answers a parsed request through this lcore's TX buffer, which goes out
+// when it is full or once its oldest frame has waited --tx-drain
+// microseconds, so one doorbell can cover several RX bursts.
+static void serve_request(struct lcore_conf *lc, struct rte_mbuf *m) {
+    struct rte_mbuf *tx[MAX_RESPONSE_FRAMES];
+    uint64_t busy_start = rte_get_timer_cycles();
+    struct trace_event ev;
+    int nb_frames = handle_request(lc, m, tx, &ev);
+    if (nb_frames) {
+        STAGE_BEGIN(stage_tsc);
+        tx_buffer_frames(lc, tx, nb_frames, ev.rx_tsc + ev.tokenized);
+        STAGE_END(lc, stage_tsc, ev.text_len, STAGE_TX);
+    }
+    uint64_t now = rte_get_timer_cycles();
+    if (nb_frames) {
+        record_latency(lc, ev.words, ev.text_len, now - ev.rx_tsc);
+        if (lc->trace) trace_record(lc->trace, &ev, now);
+        lc->requests++;
+    }
+    tx_drain(lc, now);
+    lc->busy_cycles += now - busy_start;
+}
+
+// Takes up to half of the first backlog that has requests, oldest first.
+// TX queues are not shared, so the answers go out on the thief's own queue.
+static void steal_requests(struct lcore_conf *lc) {
     struct rte_mbuf *bufs[BURST_SIZE];
-    const uint16_t UDP_PORT = 67;
-    uint64_t dropped_packets = 0;
-    unsigned lcore_id = rte_lcore_id();
+    for (unsigned k = 0; k < nb_workers; k++) {
+        if (++lc->next_worker >= nb_workers) lc->next_worker = 0;
+        struct lcore_conf *victim = &lcore_conf[worker_lcores[lc->next_worker]];
+        if (victim == lc) continue;
+        unsigned count = rte_ring_count(victim->ring);
+        if (!count) continue;
+        unsigned n = rte_ring_mc_dequeue_burst(victim->ring, (void **)bufs, RTE_MIN((count + 1) / 2, BURST_SIZE),
+                                               NULL);
+        lc->stolen += n;
+        for (unsigned i = 0; i < n; i++) serve_request(lc, bufs[i]);
+        return;
+    }
+}
 
-    while (1) {
-        uint16_t nb_rx = rte_eth_rx_burst(port_id, 0, bufs, BURST_SIZE);
-        if (nb_rx == 0) continue;
+// With work stealing, whole requests wait in a backlog ring that idle lcores
+// dequeue from as well. The owner takes them one at a time, so whatever it
+// has not reached yet can still be stolen. Fragments stay with the owner,
+// whose reassembly table holds the rest of their request.
+static void rtc_loop(struct lcore_conf *lc) {
+    struct rte_mbuf *bufs[BURST_SIZE];
 
+    while (!force_quit) {
+        rte_rcu_qsbr_quiescent(engine_qsbr, rte_lcore_id());
+        uint64_t now = rte_get_timer_cycles();
+        reasm_tick(lc, now);
+        load_tick(lc, now);
+        tx_drain(lc, now);
+        uint16_t nb_rx = rte_eth_rx_burst(port_id, lc->rx_queue, bufs, BURST_SIZE);
+        lc->rx_packets += nb_rx;
         for (int i = 0; i < nb_rx; i++) {
             struct rte_mbuf *m = bufs[i];
-            if (!m || m->pkt_len < sizeof(struct rte_ether_hdr) + sizeof(struct rte_udp_hdr)) {
-                dropped_packets++;
-                rte_pktmbuf_free(m);
-                continue;
-            }
-            uint64_t start_cycles = rte_get_timer_cycles();
-            struct rte_ether_hdr *eth_hdr = rte_pktmbuf_mtod(m, struct rte_ether_hdr *);
-            struct rte_udp_hdr *udp_hdr = (struct rte_udp_hdr *)(eth_hdr + 1);
-            if (rte_be_to_cpu_16(udp_hdr->dst_port) != UDP_PORT) {
-                dropped_packets++;
+            if (i + PREFETCH_OFFSET < nb_rx) rte_prefetch0(rte_pktmbuf_mtod(bufs[i + PREFETCH_OFFSET], void *));
+            STAGE_BEGIN(stage_tsc);
+            enum drop_reason reason;
+            if (parse_request(m, &reason) < 0) {
+                count_drops(lc, reason, 1);
                 rte_pktmbuf_free(m);
                 continue;
             }
+            req_meta(m)->rx_queue = lc->rx_queue;
+            STAGE_END(lc, stage_tsc, req_meta(m)->text_len, STAGE_PARSE);
+            if (lc->ring && req_meta(m)->req.frag_count == 1 && rte_ring_sp_enqueue(lc->ring, m) == 0) continue;
+            serve_request(lc, m);
+        }
+        if (lc->ring) {
+            struct rte_mbuf *m;
+            while (rte_ring_mc_dequeue(lc->ring, (void **)&m) == 0) serve_request(lc, m);
+            if (nb_rx == 0) steal_requests(lc);
+        }
+    }
+    tx_flush(lc);
+}
 
-            char *payload = (char *)(udp_hdr + 1);
-            int payload_len = rte_be_to_cpu_16(udp_hdr->dgram_len) - sizeof(struct rte_udp_hdr);
-            if (payload_len <= 0 || payload_len > MAX_PACKET_SIZE) {
-                dropped_packets++;
+// Fragments of one request must meet in one worker's reassembly table, so
+// they are steered by sender and request id. Whole requests go round robin,
+// whatever flow they came in on.
+static unsigned pick_worker(struct lcore_conf *lc, struct rte_mbuf *m) {
+    const struct req_meta *meta = req_meta(m);
+    if (meta->req.frag_count > 1) {
+        const struct rte_ether_hdr *eth_hdr = rte_pktmbuf_mtod(m, const struct rte_ether_hdr *);
+        const struct rte_udp_hdr *udp_hdr = (const struct rte_udp_hdr *)(eth_hdr + 1);
+        uint32_t mac;
+        memcpy(&mac, &eth_hdr->src_addr.addr_bytes[2], sizeof(mac));
+        return rte_jhash_3words(meta->req.req_id, udp_hdr->src_port, mac, 0) % nb_workers;
+    }
+    if (++lc->next_worker >= nb_workers) lc->next_worker = 0;
+    return lc->next_worker;
+}
+
+static void rx_loop(struct lcore_conf *lc) {
+    struct rte_mbuf *bufs[BURST_SIZE];
+    struct rte_mbuf *out[nb_workers][BURST_SIZE];
+    uint16_t nb_out[nb_workers];
+
+    memset(nb_out, 0, sizeof(nb_out));
+    while (!force_quit) {
+        uint16_t nb_rx = rte_eth_rx_burst(port_id, lc->rx_queue, bufs, BURST_SIZE);
+        lc->rx_packets += nb_rx;
+        if (nb_rx == 0) continue;
+        for (int i = 0; i < nb_rx; i++) {
+            struct rte_mbuf *m = bufs[i];
+            if (i + PREFETCH_OFFSET < nb_rx) rte_prefetch0(rte_pktmbuf_mtod(bufs[i + PREFETCH_OFFSET], void *));
+            STAGE_BEGIN(stage_tsc);
+            enum drop_reason reason;
+            if (parse_request(m, &reason) < 0) {
+                count_drops(lc, reason, 1);
                 rte_pktmbuf_free(m);
                 continue;
             }
-            payload[payload_len] = '\0';
-
-            int batch_size = count_tokens(payload);
-
-            int input_ids[MAX_SEQUENCE_LENGTH] = {0};
-            int attention_mask[MAX_SEQUENCE_LENGTH] = {0};
-            tokenize_text(payload, input_ids, attention_mask);
-        
-            char response_payload[MAX_PACKET_SIZE] = {0};
-            int offset = 0;
-            for (int j = 0; j < MAX_SEQUENCE_LENGTH && input_ids[j] != 0; j++) {
-                offset += snprintf(response_payload + offset, MAX_PACKET_SIZE - offset, "%d ", input_ids[j]);
+            req_meta(m)->rx_queue = lc->rx_queue;
+            STAGE_END(lc, stage_tsc, req_meta(m)->text_len, STAGE_PARSE);
+            unsigned w = pick_worker(lc, m);
+            out[w][nb_out[w]++] = m;
+        }
+        for (unsigned w = 0; w < nb_workers; w++) {
+            if (!nb_out[w]) continue;
+            struct rte_ring *ring = lcore_conf[worker_lcores[w]].ring;
+            unsigned n = rte_ring_enqueue_burst(ring, (void **)out[w], nb_out[w], NULL);
+            if (n < nb_out[w]) {
+                rte_pktmbuf_free_bulk(&out[w][n], nb_out[w] - n);
+                count_drops(lc, DROP_WORKER_FULL, nb_out[w] - n);
             }
+            nb_out[w] = 0;
+        }
+    }
+}
 
-            struct rte_mbuf *response_mbuf = rte_pktmbuf_alloc(mbuf_pool);
-            if (!response_mbuf) {
-                rte_pktmbuf_free(m);
-                dropped_packets++;
-                continue;
-            }
+static void worker_loop(struct lcore_conf *lc) {
+    struct rte_mbuf *bufs[BURST_SIZE];
+    struct rte_mbuf *tx[MAX_RESPONSE_FRAMES];
 
-            char *data_ptr = rte_pktmbuf_append(response_mbuf,
-                sizeof(struct rte_ether_hdr) + sizeof(struct rte_udp_hdr) + strlen(response_payload));
-            if (!data_ptr) {
-                rte_pktmbuf_free(response_mbuf);
-                rte_pktmbuf_free(m);
-                dropped_packets++;
-                continue;
+    while (!force_quit) {
+        rte_rcu_qsbr_quiescent(engine_qsbr, rte_lcore_id());
+        reasm_tick(lc, rte_get_timer_cycles());
+        load_tick(lc, rte_get_timer_cycles());
+        unsigned n = rte_ring_dequeue_burst(lc->ring, (void **)bufs, BURST_SIZE, NULL);
+        for (unsigned i = 0; i < n; i++) {
+            if (i + 1 < n) rte_prefetch0(rte_pktmbuf_mtod_offset(bufs[i + 1], void *, PAYLOAD_OFF));
+            uint64_t busy_start = rte_get_timer_cycles();
+            struct trace_event ev;
+            int nb_frames = handle_request(lc, bufs[i], tx, &ev);
+            STAGE_BEGIN(stage_tsc);
+            // All parts of a response or none, so they leave in order.
+            if (nb_frames && rte_ring_enqueue_bulk(lc->tx_ring, (void **)tx, nb_frames, NULL) == 0) {
+                rte_pktmbuf_free_bulk(tx, nb_frames);
+                count_drops(lc, DROP_TX_FULL, nb_frames);
+                ev.flags |= TRACE_TX_DROP;
             }
+            if (nb_frames) STAGE_END(lc, stage_tsc, ev.text_len, STAGE_TX);
+            uint64_t now = rte_get_timer_cycles();
+            if (nb_frames) {
+                record_latency(lc, ev.words, ev.text_len, now - ev.rx_tsc);
+                if (lc->trace) trace_record(lc->trace, &ev, now);
+                lc->requests++;
+            }
+            lc->busy_cycles += now - busy_start;
+        }
+    }
+}
+
+static void tx_loop(struct lcore_conf *lc) {
+    struct rte_mbuf *bufs[BURST_SIZE];
 
-            struct rte_ether_hdr *resp_eth_hdr = (struct rte_ether_hdr *)data_ptr;
-            rte_ether_addr_copy(&eth_hdr->src_addr, &resp_eth_hdr->dst_addr);
-            rte_eth_macaddr_get(port_id, &resp_eth_hdr->src_addr);
-            resp_eth_hdr->ether_type = eth_hdr->ether_type;
+    while (!force_quit) {
+        unsigned n = rte_ring_dequeue_burst(lc->ring, (void **)bufs, BURST_SIZE, NULL);
+        if (n) send_burst(lc, bufs, n);
+    }
+}
 
-            struct rte_udp_hdr *resp_udp_hdr = (struct rte_udp_hdr *)(resp_eth_hdr + 1);
-            resp_udp_hdr->src_port = udp_hdr->dst_port;
-            resp_udp_hdr->dst_port = udp_hdr->src_port;
-            resp_udp_hdr->dgram_len = rte_cpu_to_be_16(sizeof(struct rte_udp_hdr) + strlen(response_payload));
-            resp_udp_hdr->dgram_cksum = 0;
+// Lcores that tokenize report a quiescent state once per loop, between
+// requests, when they hold no engine pointer, and go offline when they stop
+// so that a reload in progress does not wait for them.
+static int lcore_main(__rte_unused void *arg) {
+    unsigned lcore_id = rte_lcore_id();
+    struct lcore_conf *lc = &lcore_conf[lcore_id];
+    if (lc->role == ROLE_RTC || lc->role == ROLE_WORKER) {
+        rte_rcu_qsbr_thread_register(engine_qsbr, lcore_id);
+        rte_rcu_qsbr_thread_online(engine_qsbr, lcore_id);
+    }
+    switch (lc->role) {
+    case ROLE_RTC:
+        rtc_loop(lc);
+        break;
+    case ROLE_RX:
+        rx_loop(lc);
+        break;
+    case ROLE_WORKER:
+        worker_loop(lc);
+        break;
+    case ROLE_TX:
+        tx_loop(lc);
+        break;
+    }
+    if (lc->role == ROLE_RTC || lc->role == ROLE_WORKER) {
+        rte_rcu_qsbr_thread_offline(engine_qsbr, lcore_id);
+        rte_rcu_qsbr_thread_unregister(engine_qsbr, lcore_id);
+    }
+    return 0;
+}
 
-            char *resp_payload = (char *)(resp_udp_hdr + 1);
-            memcpy(resp_payload, response_payload, strlen(response_payload));
+// Gives every lcore its role, queues and rings. Run to completion gives each
+// lcore an RX/TX queue pair. The pipeline puts RX on the first lcores and TX
+// on the last ones, with tokenizer workers in between; worker k hands its
+// responses to TX lcore k % nb_tx_cores.
+static void setup_lcores(uint16_t *nb_rxq, uint16_t *nb_txq) {
+    unsigned nb_lcores = rte_lcore_count();
+    unsigned tx_lcores[RTE_MAX_LCORE];
+    unsigned lcore_id, i = 0, nb_tx = 0;
+    char name[RTE_RING_NAMESIZE];
 
-            uint16_t nb_tx = rte_eth_tx_burst(port_id, 0, &response_mbuf, 1);
-            if (nb_tx < 1) {
-                rte_pktmbuf_free(response_mbuf);
-                dropped_packets++;
+    if (topology == TOPO_PIPELINE && nb_lcores < nb_rx_cores + nb_tx_cores + 1)
+        rte_exit(EXIT_FAILURE, "Pipeline needs %u RX, %u TX and at least one worker lcore, have %u\n",
+                 nb_rx_cores, nb_tx_cores, nb_lcores);
+    RTE_LCORE_FOREACH(lcore_id) {
+        struct lcore_conf *lc = &lcore_conf[lcore_id];
+        if (topology == TOPO_RTC) {
+            lc->role = ROLE_RTC;
+            lc->rx_queue = lc->tx_queue = i;
+            lc->tx_buffer = rte_zmalloc_socket("tx_buffer", RTE_ETH_TX_BUFFER_SIZE(BURST_SIZE), 0,
+                                               rte_lcore_to_socket_id(lcore_id));
+            if (!lc->tx_buffer) rte_exit(EXIT_FAILURE, "Cannot create TX buffer\n");
+            rte_eth_tx_buffer_init(lc->tx_buffer, BURST_SIZE);
+            rte_eth_tx_buffer_set_err_callback(lc->tx_buffer, tx_unsent, lc);
+            if (work_stealing) {
+                snprintf(name, sizeof(name), "backlog_%u", lcore_id);
+                lc->ring = rte_ring_create(name, WORKER_RING_SIZE, rte_lcore_to_socket_id(lcore_id), RING_F_SP_ENQ);
+                if (!lc->ring) rte_exit(EXIT_FAILURE, "Cannot create %s\n", name);
             }
-            uint64_t end_cycles = rte_get_timer_cycles();
-            double time_us = (double)(end_cycles - start_cycles) * 1e6 / rte_get_timer_hz();
-            fprintf(log_file, "%d,%.2f\n", batch_size, time_us);
-            fflush(log_file);
-            printf("Tokenization time for batch size %d: %.2f µs\n", batch_size, time_us);
+        } else if (i < nb_rx_cores) {
+            lc->role = ROLE_RX;
+            lc->rx_queue = i;
+        } else if (i >= nb_lcores - nb_tx_cores) {
+            lc->role = ROLE_TX;
+            lc->tx_queue = nb_tx;
+            tx_lcores[nb_tx++] = lcore_id;
+            snprintf(name, sizeof(name), "tx_ring_%u", lcore_id);
+            // Single producer unless several workers share this TX lcore.
+            lc->ring = rte_ring_create(name, RESP_RING_SIZE, rte_lcore_to_socket_id(lcore_id),
+                                       (nb_lcores - nb_rx_cores - nb_tx_cores > nb_tx_cores ? 0 : RING_F_SP_ENQ) |
+                                       RING_F_SC_DEQ);
+            if (!lc->ring) rte_exit(EXIT_FAILURE, "Cannot create %s\n", name);
+        } else {
+            lc->role = ROLE_WORKER;
+        }
+        if (lc->role == ROLE_RTC || lc->role == ROLE_WORKER) worker_lcores[nb_workers++] = lcore_id;
+        i++;
+    }
 
-            rte_pktmbuf_free(m);
+    for (unsigned w = 0; w < nb_workers; w++) {
+        lcore_id = worker_lcores[w];
+        struct lcore_conf *lc = &lcore_conf[lcore_id];
+        int socket = rte_lcore_to_socket_id(lcore_id);
+        lc->reasm = reasm_create(reasm_entries, rte_get_timer_hz() / 1000 * reasm_timeout_ms, reasm_feed, reasm_close,
+                                 socket);
+        if (!lc->reasm) rte_exit(EXIT_FAILURE, "Failed to create reassembly table\n");
+        if (wcache_entries) {
+            lc->wcache = wcache_create(wcache_entries, socket);
+            if (!lc->wcache) rte_exit(EXIT_FAILURE, "Failed to create word cache\n");
+        }
+        lc->latency = rte_zmalloc_socket("latency", sizeof(struct hist) * LAT_CLASSES,
+                                         RTE_CACHE_LINE_SIZE, socket);
+        if (!lc->latency) rte_exit(EXIT_FAILURE, "Failed to create latency histograms\n");
+        if (trace_events) {
+            lc->trace = trace_create(lcore_id, trace_events, rte_get_timer_hz() / 1000000 * trace_threshold_us, socket);
+            if (!lc->trace) rte_exit(EXIT_FAILURE, "Failed to create trace ring\n");
         }
+        if (lc->role != ROLE_WORKER) continue;
+        snprintf(name, sizeof(name), "worker_ring_%u", lcore_id);
+        lc->ring = rte_ring_create(name, WORKER_RING_SIZE, socket,
+                                   (nb_rx_cores > 1 ? 0 : RING_F_SP_ENQ) | RING_F_SC_DEQ);
+        if (!lc->ring) rte_exit(EXIT_FAILURE, "Cannot create %s\n", name);
+        lc->tx_ring = lcore_conf[tx_lcores[w % nb_tx]].ring;
     }
 
+    *nb_rxq = topology == TOPO_RTC ? nb_lcores : nb_rx_cores;
+    *nb_txq = topology == TOPO_RTC ? nb_lcores : nb_tx_cores;
+}
+
+static void signal_handler(int signum) {
+    printf("\nSignal %d received, preparing to exit...\n", signum);
+    force_quit = 1;
+}
+
+static void trace_signal(__rte_unused int signum) {
+    trace_request_dump();
+}
+
+static const char *const role_names[] = { "rtc", "rx", "worker", "tx" };
+
+// What the telemetry and metrics threads read of an lcore while it runs.
+// Each counter has one writer, so a reader sees it whole if a little late.
+struct counters {
+    uint64_t rx_packets;
+    uint64_t tx_packets;
+    uint64_t requests;
+    uint64_t ids;
+    uint64_t stolen;
+    uint64_t dropped;
+    uint64_t drops[NB_DROP_REASONS];
+    struct wcache_stats wcache;
+};
+
+static const struct {
+    const char *name;
+    const char *help;
+    size_t off;
+} counter_fields[] = {
+    { "rx_packets", "Packets received", offsetof(struct counters, rx_packets) },
+    { "tx_packets", "Packets sent", offsetof(struct counters, tx_packets) },
+    { "requests", "Requests answered", offsetof(struct counters, requests) },
+    { "tokens", "Token ids in the answers", offsetof(struct counters, ids) },
+    { "stolen", "Requests taken from another lcore's backlog", offsetof(struct counters, stolen) },
+    { "word_cache_hits", "Word cache hits", offsetof(struct counters, wcache.hits) },
+    { "word_cache_misses", "Word cache misses", offsetof(struct counters, wcache.misses) },
+    { "word_cache_evictions", "Word cache evictions", offsetof(struct counters, wcache.evictions) },
+};
+
+static inline uint64_t counter_field(const struct counters *c, unsigned i) {
+    return *(const uint64_t *)((const char *)c + counter_fields[i].off);
+}
+
+// Telemetry callbacks run on DPDK's telemetry thread, which cannot be
+// stopped before rte_eal_cleanup(). They read the lcores' state under
+// stats_lock, and main closes it before freeing that state.
+static rte_rwlock_t stats_lock = RTE_RWLOCK_INITIALIZER;
+static int stats_closed;
+
+static int tel_begin(void) {
+    rte_rwlock_read_lock(&stats_lock);
+    if (stats_closed) {
+        rte_rwlock_read_unlock(&stats_lock);
+        return -1;
+    }
+    return 0;
+}
+
+static void tel_end(void) {
+    rte_rwlock_read_unlock(&stats_lock);
+}
+
+// Waits for the telemetry callbacks in progress; later ones fail.
+static void stats_close(void) {
+    rte_rwlock_write_lock(&stats_lock);
+    stats_closed = 1;
+    rte_rwlock_write_unlock(&stats_lock);
+}
+
+// Adds the counters of lcore_id to c.
+static void add_counters(struct counters *c, unsigned lcore_id) {
+    const struct lcore_conf *lc = &lcore_conf[lcore_id];
+    c->rx_packets += lc->rx_packets;
+    c->tx_packets += lc->tx_packets;
+    c->requests += lc->requests;
+    c->ids += lc->ids;
+    c->stolen += lc->stolen;
+    c->dropped += lc->dropped;
+    for (int r = 0; r < NB_DROP_REASONS; r++) c->drops[r] += lc->drops[r];
+    if (lc->wcache) {
+        c->wcache.hits += lc->wcache->stats.hits;
+        c->wcache.misses += lc->wcache->stats.misses;
+        c->wcache.evictions += lc->wcache->stats.evictions;
+    }
+}
+
+static void tel_add_counters(struct rte_tel_data *d, const struct counters *c) {
+    char name[64];
+    for (unsigned i = 0; i < RTE_DIM(counter_fields); i++)
+        rte_tel_data_add_dict_u64(d, counter_fields[i].name, counter_field(c, i));
+    rte_tel_data_add_dict_u64(d, "dropped", c->dropped);
+    for (int r = 0; r < NB_DROP_REASONS; r++) {
+        snprintf(name, sizeof(name), "drop_%s", drop_names[r]);
+        rte_tel_data_add_dict_u64(d, name, c->drops[r]);
+    }
+}
+
+// /nettok/stats: totals over all lcores, and the mbuf pool.
+static int tel_stats(__rte_unused const char *cmd, __rte_unused const char *params, struct rte_tel_data *d) {
+    struct counters c = { 0 };
+    unsigned lcore_id;
+    if (tel_begin() < 0) return -1;
+    RTE_LCORE_FOREACH(lcore_id) add_counters(&c, lcore_id);
+    rte_tel_data_start_dict(d);
+    tel_add_counters(d, &c);
+    rte_tel_data_add_dict_u64(d, "mempool_in_use", rte_mempool_in_use_count(mbuf_pool));
+    rte_tel_data_add_dict_u64(d, "mempool_available", rte_mempool_avail_count(mbuf_pool));
+    tel_end();
+    return 0;
+}
+
+// /nettok/lcores: the ids that /nettok/lcore takes.
+static int tel_lcores(__rte_unused const char *cmd, __rte_unused const char *params, struct rte_tel_data *d) {
+    unsigned lcore_id;
+    rte_tel_data_start_array(d, RTE_TEL_U64_VAL);
+    RTE_LCORE_FOREACH(lcore_id) rte_tel_data_add_array_u64(d, lcore_id);
+    return 0;
+}
+
+// /nettok/lcore,ID: the counters of one lcore, with its role and queues.
+static int tel_lcore(__rte_unused const char *cmd, const char *params, struct rte_tel_data *d) {
+    if (!params || !isdigit((unsigned char)params[0])) return -1;
+    unsigned lcore_id = atoi(params);
+    if (lcore_id >= RTE_MAX_LCORE || !rte_lcore_is_enabled(lcore_id)) return -1;
+    const struct lcore_conf *lc = &lcore_conf[lcore_id];
+    struct counters c = { 0 };
+    if (tel_begin() < 0) return -1;
+    add_counters(&c, lcore_id);
+    rte_tel_data_start_dict(d);
+    rte_tel_data_add_dict_string(d, "role", role_names[lc->role]);
+    if (lc->role == ROLE_RTC || lc->role == ROLE_RX) rte_tel_data_add_dict_int(d, "rx_queue", lc->rx_queue);
+    if (lc->role == ROLE_RTC || lc->role == ROLE_TX) rte_tel_data_add_dict_int(d, "tx_queue", lc->tx_queue);
+    tel_add_counters(d, &c);
+    if (lc->ring) rte_tel_data_add_dict_u64(d, "queued", rte_ring_count(lc->ring));
+    tel_end();
+    return 0;
+}
+
+static size_t appendf(char *buf, size_t size, size_t len, const char *fmt, ...) {
+    if (len >= size - 1) return len;
+    va_list ap;
+    va_start(ap, fmt);
+    int n = vsnprintf(buf + len, size - len, fmt, ap);
+    va_end(ap);
+    return n < 0 ? len : RTE_MIN(len + n, size - 1);
+}
+
+// The same counters per lcore, the mbuf pool and the port's own counters,
+// in Prometheus text format.
+static size_t write_metrics(char *buf, size_t size) {
+    struct counters lcores[RTE_MAX_LCORE];
+    unsigned lcore_id;
+    size_t n = 0;
+    RTE_LCORE_FOREACH(lcore_id) {
+        memset(&lcores[lcore_id], 0, sizeof(lcores[lcore_id]));
+        add_counters(&lcores[lcore_id], lcore_id);
+    }
+    for (unsigned i = 0; i < RTE_DIM(counter_fields); i++) {
+        n = appendf(buf, size, n, "# HELP nettok_%s_total %s.\n# TYPE nettok_%s_total counter\n",
+                    counter_fields[i].name, counter_fields[i].help, counter_fields[i].name);
+        RTE_LCORE_FOREACH(lcore_id) {
+            n = appendf(buf, size, n, "nettok_%s_total{lcore=\"%u\",role=\"%s\"} %" PRIu64 "\n",
+                        counter_fields[i].name, lcore_id, role_names[lcore_conf[lcore_id].role],
+                        counter_field(&lcores[lcore_id], i));
+        }
+    }
+    n = appendf(buf, size, n, "# HELP nettok_dropped_total Packets dropped, by reason.\n"
+                              "# TYPE nettok_dropped_total counter\n");
+    RTE_LCORE_FOREACH(lcore_id) {
+        for (int r = 0; r < NB_DROP_REASONS; r++)
+            n = appendf(buf, size, n, "nettok_dropped_total{lcore=\"%u\",reason=\"%s\"} %" PRIu64 "\n", lcore_id,
+                        drop_names[r], lcores[lcore_id].drops[r]);
+    }
+    n = appendf(buf, size, n, "# HELP nettok_mempool_mbufs Mbufs of the pool, in use or available.\n"
+                              "# TYPE nettok_mempool_mbufs gauge\n"
+                              "nettok_mempool_mbufs{state=\"in_use\"} %u\nnettok_mempool_mbufs{state=\"available\"} %u\n",
+                rte_mempool_in_use_count(mbuf_pool), rte_mempool_avail_count(mbuf_pool));
+
+    struct rte_eth_stats stats;
+    if (rte_eth_stats_get(port_id, &stats) != 0) return n;
+    n = appendf(buf, size, n, "# HELP nettok_port_packets_total Packets counted by the port.\n"
+                              "# TYPE nettok_port_packets_total counter\n"
+                              "nettok_port_packets_total{dir=\"rx\"} %" PRIu64 "\n"
+                              "nettok_port_packets_total{dir=\"tx\"} %" PRIu64 "\n"
+                              "# HELP nettok_port_missed_total Packets the port dropped with its RX queues full.\n"
+                              "# TYPE nettok_port_missed_total counter\nnettok_port_missed_total %" PRIu64 "\n"
+                              "# HELP nettok_port_rx_nombuf_total RX mbuf allocation failures.\n"
+                              "# TYPE nettok_port_rx_nombuf_total counter\nnettok_port_rx_nombuf_total %" PRIu64 "\n",
+                stats.ipackets, stats.opackets, stats.imissed, stats.rx_nombuf);
+    n = appendf(buf, size, n, "# HELP nettok_queue_packets_total Packets per port queue.\n"
+                              "# TYPE nettok_queue_packets_total counter\n");
+    for (uint16_t q = 0; q < RTE_MIN(nb_rx_queues, RTE_ETHDEV_QUEUE_STAT_CNTRS); q++)
+        n = appendf(buf, size, n, "nettok_queue_packets_total{dir=\"rx\",queue=\"%u\"} %" PRIu64 "\n", q,
+                    stats.q_ipackets[q]);
+    for (uint16_t q = 0; q < RTE_MIN(nb_tx_queues, RTE_ETHDEV_QUEUE_STAT_CNTRS); q++)
+        n = appendf(buf, size, n, "nettok_queue_packets_total{dir=\"tx\",queue=\"%u\"} %" PRIu64 "\n", q,
+                    stats.q_opackets[q]);
+    return n;
+}
+
+// Totals for the whole run, e.g. a replay through net_pcap. Cycles per
+// packet count every polling lcore for the whole run, busy or not.
+static void print_totals(uint64_t elapsed) {
+    struct rte_eth_stats stats;
+    if (rte_eth_stats_get(port_id, &stats) != 0) memset(&stats, 0, sizeof(stats));
+    uint64_t requests = 0, ids = 0, dropped = 0, busy = 0;
+    unsigned lcore_id;
+    RTE_LCORE_FOREACH(lcore_id) {
+        const struct lcore_conf *lc = &lcore_conf[lcore_id];
+        requests += lc->requests;
+        ids += lc->ids;
+        dropped += lc->dropped;
+        busy += lc->busy_cycles;
+    }
+    double secs = (double)elapsed / rte_get_timer_hz();
+    printf("Totals: %.2f s on %u lcores, %" PRIu64 " packets in (%" PRIu64 " missed), %" PRIu64 " out, %" PRIu64
+           " requests, %" PRIu64 " tokens, %" PRIu64 " dropped\n",
+           secs, rte_lcore_count(), stats.ipackets, stats.imissed, stats.opackets, requests, ids, dropped);
+    if (!stats.ipackets || !requests) return;
+    printf("Rate: %.3f Mpps, %.3f Mtokens/s, %.0f cycles per packet, %.0f busy cycles per request\n",
+           stats.ipackets / secs / 1e6, ids / secs / 1e6, (double)elapsed * rte_lcore_count() / stats.ipackets,
+           (double)busy / requests);
+}
+
+static void usage(const char *prog) {
+    printf("Usage: %s [EAL options] -- [--mode char|gpt2|llama3|wordpiece] [--vocab FILE] [--merges FILE] [--tx-mode copy|inplace] [--mbuf-size BYTES]\n"
+           "       [--reasm-entries N] [--reasm-timeout MS] [--topology rtc|pipeline] [--rx-cores N] [--tx-cores N] [--steal]\n"
+           "       [--ctl-socket PATH] [--tenant PORT:MODE:VOCAB[:MERGES]]... [--word-cache N] [--metrics-port PORT]\n"
+           "       [--trace-events N] [--trace-threshold US] [--trace-dir DIR] [--tx-drain US] [--quiet]\n"
+           "  --mode    tokenizer engine for requests to port %d (default char)\n"
+           "  --vocab   vocabulary JSON, vocab.txt for wordpiece, or a compiled image (default data.json)\n"
+           "  --merges  merges.txt for byte-level BPE (default: derived from vocab; images carry their own)\n"
+           "  --tx-mode response path: rewrite the request mbuf, or copy into a new one (default inplace)\n"
+           "  --mbuf-size data room per mbuf; larger packets are received and sent as chains (default %d)\n"
+           "  --reasm-entries fragmented requests in flight per lcore (default %d)\n"
+           "  --reasm-timeout ms a fragmented request may wait for its next fragment (default %d)\n"
+           "  --topology run to completion on every lcore, or an RX -> tokenizer -> TX pipeline (default rtc)\n"
+           "  --rx-cores lcores receiving and steering requests in the pipeline (default 1)\n"
+           "  --tx-cores lcores transmitting responses in the pipeline (default 1)\n"
+           "  --steal   let idle lcores answer requests queued on busy ones (run to completion only)\n"
+           "  --ctl-socket UNIX socket taking 'reload [PORT] MODE VOCAB [MERGES]' and 'latency [CSV]' commands (default %s)\n"
+           "  --tenant  another vocabulary, for requests to PORT; may be repeated up to %d times\n"
+           "  --word-cache pieces cached with their ids per lcore, 0 to disable (default %d)\n"
+           "  --metrics-port serve Prometheus metrics on 127.0.0.1:PORT/metrics (default off)\n"
+           "  --trace-events requests kept per lcore in the flight recorder, 0 to disable (default %d)\n"
+           "  --trace-threshold dump an lcore's recorder when a request takes longer than US, RX to TX (default off)\n"
+           "  --trace-dir directory for recorder dumps, on a slow request or SIGUSR1 (default .)\n"
+           "  --tx-drain longest a ready response waits to share a TX doorbell, 0 for one per request (default %d us)\n"
+           "  --quiet   only overall latency on exit, no per-class lines or " LAT_CSV ", e.g. for benchmarks\n",
+           prog, UDP_PORT, MAX_PACKET_SIZE, REASM_ENTRIES, REASM_TIMEOUT_MS, CTL_SOCKET, MAX_TENANTS - 1, WCACHE_ENTRIES,
+           TRACE_EVENTS, TX_DRAIN_US);
+}
+
+static int parse_args(int argc, char **argv) {
+    static const struct option long_options[] = {
+        { "mode", required_argument, NULL, 'm' },
+        { "vocab", required_argument, NULL, 'v' },
+        { "merges", required_argument, NULL, 'g' },
+        { "tx-mode", required_argument, NULL, 't' },
+        { "mbuf-size", required_argument, NULL, 's' },
+        { "reasm-entries", required_argument, NULL, 'r' },
+        { "reasm-timeout", required_argument, NULL, 'a' },
+        { "topology", required_argument, NULL, 'p' },
+        { "rx-cores", required_argument, NULL, 'x' },
+        { "tx-cores", required_argument, NULL, 'y' },
+        { "steal", no_argument, NULL, 'w' },
+        { "ctl-socket", required_argument, NULL, 'c' },
+        { "tenant", required_argument, NULL, 'n' },
+        { "word-cache", required_argument, NULL, 'k' },
+        { "metrics-port", required_argument, NULL, 'e' },
+        { "trace-events", required_argument, NULL, 'f' },
+        { "trace-threshold", required_argument, NULL, 'l' },
+        { "trace-dir", required_argument, NULL, 'd' },
+        { "tx-drain", required_argument, NULL, 'u' },
+        { "quiet", no_argument, NULL, 'q' },
+        { NULL, 0, NULL, 0 },
+    };
+    int opt;
+    while ((opt = getopt_long(argc, argv, "", long_options, NULL)) != -1) {
+        switch (opt) {
+        case 'm': {
+            int m = parse_mode(optarg);
+            if (m < 0) return -1;
+            mode = m;
+            break;
+        }
+        case 'v':
+            vocab_file = optarg;
+            break;
+        case 'g':
+            merges_file = optarg;
+            break;
+        case 't':
+            if (!strcmp(optarg, "copy")) tx_mode = TX_COPY;
+            else if (!strcmp(optarg, "inplace")) tx_mode = TX_INPLACE;
+            else return -1;
+            break;
+        case 's': {
+            int size = atoi(optarg);
+            if (size < MIN_MBUF_DATA || size > MAX_PACKET_SIZE) return -1;
+            mbuf_data = size;
+            break;
+        }
+        case 'r':
+            reasm_entries = atoi(optarg);
+            if (!reasm_entries) return -1;
+            break;
+        case 'a':
+            reasm_timeout_ms = atoi(optarg);
+            if (!reasm_timeout_ms) return -1;
+            break;
+        case 'p':
+            if (!strcmp(optarg, "rtc")) topology = TOPO_RTC;
+            else if (!strcmp(optarg, "pipeline")) topology = TOPO_PIPELINE;
+            else return -1;
+            break;
+        case 'x':
+            nb_rx_cores = atoi(optarg);
+            if (!nb_rx_cores) return -1;
+            break;
+        case 'y':
+            nb_tx_cores = atoi(optarg);
+            if (!nb_tx_cores) return -1;
+            break;
+        case 'w':
+            work_stealing = 1;
+            break;
+        case 'c':
+            ctl_socket = optarg;
+            break;
+        case 'n':
+            if (nb_tenant_specs == RTE_DIM(tenant_specs)) return -1;
+            tenant_specs[nb_tenant_specs++] = optarg;
+            break;
+        case 'k':
+            wcache_entries = atoi(optarg);
+            break;
+        case 'e':
+            if (atoi(optarg) <= 0 || atoi(optarg) > UINT16_MAX) return -1;
+            metrics_port = atoi(optarg);
+            break;
+        case 'f':
+            if (atoi(optarg) < 0 || atoi(optarg) > TRACE_MAX_EVENTS) return -1;
+            trace_events = atoi(optarg);
+            break;
+        case 'l':
+            trace_threshold_us = atoi(optarg);
+            break;
+        case 'd':
+            trace_dir = optarg;
+            break;
+        case 'u':
+            if (atoi(optarg) < 0) return -1;
+            tx_drain_us = atoi(optarg);
+            break;
+        case 'q':
+            quiet = 1;
+            break;
+        default:
+            return -1;
+        }
+    }
     return 0;
 }
 
 int main(int argc, char **argv) {
     int ret;
-    uint16_t port_id = 0;
 
     ret = rte_eal_init(argc, argv);
     if (ret < 0) rte_exit(EXIT_FAILURE, "Cannot init EAL\n");
+    argc -= ret;
+    argv += ret;
+    if (parse_args(argc, argv) < 0) {
+        usage(argv[0]);
+        rte_exit(EXIT_FAILURE, "Invalid arguments\n");
+    }
+    signal(SIGINT, signal_handler);
+    signal(SIGTERM, signal_handler);
+    signal(SIGUSR1, trace_signal);
 
     struct rte_eth_dev_info dev_info;
     ret = rte_eth_dev_info_get(port_id, &dev_info);
     if (ret < 0) rte_exit(EXIT_FAILURE, "Cannot get device info\n");
 
-    mbuf_pool = rte_pktmbuf_pool_create("MBUF_POOL", NUM_MBUFS, MBUF_CACHE_SIZE, 0, MBUF_SIZE, rte_socket_id());
+    mbuf_pool = rte_pktmbuf_pool_create("MBUF_POOL", NUM_MBUFS, MBUF_CACHE_SIZE, 0,
+                                        mbuf_data + RTE_PKTMBUF_HEADROOM, rte_socket_id());
     if (!mbuf_pool) rte_exit(EXIT_FAILURE, "Cannot create mbuf pool\n");
 
+    static const struct rte_mbuf_dynfield req_meta_desc = {
+        .name = "nettok_req_meta",
+        .size = sizeof(struct req_meta),
+        .align = __alignof__(struct req_meta),
+    };
+    req_meta_offset = rte_mbuf_dynfield_register(&req_meta_desc);
+    if (req_meta_offset < 0) rte_exit(EXIT_FAILURE, "Cannot register mbuf field\n");
+
+    tx_drain_cycles = rte_get_timer_hz() / 1000000 * tx_drain_us;
+    uint16_t nb_rxq, nb_txq;
+    setup_lcores(&nb_rxq, &nb_txq);
+    if (nb_rxq > dev_info.max_rx_queues || nb_txq > dev_info.max_tx_queues)
+        rte_exit(EXIT_FAILURE, "Port has %u RX and %u TX queues, %u and %u needed\n", dev_info.max_rx_queues,
+                 dev_info.max_tx_queues, nb_rxq, nb_txq);
+
     struct rte_eth_conf port_conf = {
         .rxmode = {
             .max_lro_pkt_size = MBUF_SIZE,
@@ -239,38 +1714,86 @@ int main(int argc, char **argv) {
             .offloads = RTE_ETH_RX_OFFLOAD_SCATTER,
         },
     };
-    rte_eth_dev_configure(port_id, 1, 1, &port_conf);
+    if (dev_info.tx_offload_capa & RTE_ETH_TX_OFFLOAD_MULTI_SEGS)
+        port_conf.txmode.offloads |= RTE_ETH_TX_OFFLOAD_MULTI_SEGS;
+    // The RSS hash covers UDP over IP only; frames of our raw Ethernet
+    // protocol all land on queue 0.
+    if (nb_rxq > 1) {
+        port_conf.rxmode.mq_mode = RTE_ETH_MQ_RX_RSS;
+        port_conf.rx_adv_conf.rss_conf.rss_hf = RTE_ETH_RSS_UDP & dev_info.flow_type_rss_offloads;
+    }
+    rte_eth_dev_configure(port_id, nb_rxq, nb_txq, &port_conf);
 
     struct rte_eth_rxconf rx_conf = {
         .rx_thresh = { .pthresh = 8, .hthresh = 8, .wthresh = 0 },
         .rx_free_thresh = 64,
         .offloads = RTE_ETH_RX_OFFLOAD_SCATTER,
     };
-    rte_eth_rx_queue_setup(port_id, 0, RX_RING_SIZE, rte_eth_dev_socket_id(port_id), &rx_conf, mbuf_pool);
+    for (uint16_t q = 0; q < nb_rxq; q++)
+        rte_eth_rx_queue_setup(port_id, q, RX_RING_SIZE, rte_eth_dev_socket_id(port_id), &rx_conf, mbuf_pool);
 
     struct rte_eth_txconf tx_conf = {
         .tx_thresh = { .pthresh = 36, .hthresh = 0, .wthresh = 0 },
         .tx_free_thresh = 64,
     };
-    rte_eth_tx_queue_setup(port_id, 0, TX_RING_SIZE, rte_eth_dev_socket_id(port_id), &tx_conf);
+    for (uint16_t q = 0; q < nb_txq; q++)
+        rte_eth_tx_queue_setup(port_id, q, TX_RING_SIZE, rte_eth_dev_socket_id(port_id), &tx_conf);
 
     rte_eth_dev_start(port_id);
     rte_eth_promiscuous_enable(port_id);
+    rte_eth_macaddr_get(port_id, &port_mac);
 
-    if (create_hash_table_from_json("data.json") < 0)
-        rte_exit(EXIT_FAILURE, "Failed to load hash table\n");
+    tenants[0].udp_port = rte_cpu_to_be_16(UDP_PORT);
+    tenants[0].engine = engine_load(mode, vocab_file, merges_file);
+    if (!tenants[0].engine) rte_exit(EXIT_FAILURE, "Failed to load vocabulary\n");
+    nb_tenants = 1;
+    for (unsigned i = 0; i < nb_tenant_specs; i++)
+        if (add_tenant(tenant_specs[i]) < 0) rte_exit(EXIT_FAILURE, "Failed to load tenant %u\n", i + 1);
+    engine_qsbr = rte_zmalloc("engine_qsbr", rte_rcu_qsbr_get_memsize(RTE_MAX_LCORE), RTE_CACHE_LINE_SIZE);
+    if (!engine_qsbr || rte_rcu_qsbr_init(engine_qsbr, RTE_MAX_LCORE) != 0)
+        rte_exit(EXIT_FAILURE, "Cannot create RCU state\n");
+    if (ctl_start(ctl_socket, ctl_command) < 0) printf("Warning: Vocabulary reload is disabled\n");
+    nb_rx_queues = nb_rxq;
+    nb_tx_queues = nb_txq;
+    rte_telemetry_register_cmd("/nettok/stats", tel_stats, "Returns the totals of all lcores. Takes no parameters");
+    rte_telemetry_register_cmd("/nettok/lcores", tel_lcores, "Returns the lcore ids. Takes no parameters");
+    rte_telemetry_register_cmd("/nettok/lcore", tel_lcore, "Returns the counters of one lcore. Parameters: int lcore_id");
+    if (metrics_port && metrics_start(metrics_port, write_metrics) < 0) printf("Warning: Metrics are disabled\n");
+    if (trace_events && trace_start(trace_dir) < 0) printf("Warning: Trace dumps are disabled\n");
 
-    log_file = fopen("tokenization_log.csv", "w");
-    if (!log_file) rte_exit(EXIT_FAILURE, "Failed to open tokenization_log.csv\n");
-    fprintf(log_file, "BatchSize,TokenizationTime_us\n");
+    if (topology == TOPO_PIPELINE)
+        printf("Pipeline: %u RX, %u worker and %u TX lcores\n", nb_rx_cores, nb_workers, nb_tx_cores);
+    else
+        printf("Run to completion on %u lcores%s\n", nb_workers, work_stealing ? " with work stealing" : "");
 
+    unsigned lcore_id;
+    uint64_t start = rte_get_timer_cycles();
+    RTE_LCORE_FOREACH_WORKER(lcore_id) {
+        rte_eal_remote_launch(lcore_main, NULL, lcore_id);
+    }
     lcore_main(NULL);
+    rte_eal_mp_wait_lcore();
+    print_totals(rte_get_timer_cycles() - start);
+    print_latency();
+    print_stages();
 
-    fclose(log_file);
+    ctl_stop();
+    metrics_stop();
+    trace_stop();
+    stats_close();
     rte_eth_dev_stop(port_id);
     rte_eth_dev_close(port_id);
-    rte_hash_free(hash_table);
+    RTE_LCORE_FOREACH(lcore_id) {
+        reasm_free(lcore_conf[lcore_id].reasm);
+        wcache_free(lcore_conf[lcore_id].wcache);
+        rte_free(lcore_conf[lcore_id].latency);
+        rte_free(lcore_conf[lcore_id].tx_buffer);
+        trace_free(lcore_conf[lcore_id].trace);
+        rte_ring_free(lcore_conf[lcore_id].ring);
+    }
+    for (unsigned i = 0; i < nb_tenants; i++) engine_free(tenants[i].engine);
+    rte_free(engine_qsbr);
     rte_eal_cleanup();
     return 0;
 }
-// Compile with: gcc -o tokenizer tokenizer.c -ljson-c -lrte_eal -lrte_ethdev -lrte_mbuf -lrte_hash -lrte_jhash
+// Build with: make
@@ -0,0 +1,180 @@
+#include <errno.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <rte_cycles.h>
+#include <rte_lcore.h>
+#include <rte_malloc.h>
+
+#include "trace.h"
+
+#define TRACE_POLL_US 10000
+
+static struct trace_ring *trace_rings[RTE_MAX_LCORE];
+static char trace_dir[256];
+static pthread_t trace_thread;
+static volatile int trace_running;
+static volatile int dump_requested;
+static unsigned dump_seq;
+
+struct trace_ring *trace_create(unsigned lcore, uint32_t events, uint64_t threshold_cycles, int socket_id) {
+    uint32_t size = rte_align32pow2(events);
+    struct trace_ring *r = rte_zmalloc_socket("trace", sizeof(*r) + size * sizeof(struct trace_event),
+                                              RTE_CACHE_LINE_SIZE, socket_id);
+    if (!r) return NULL;
+    r->snap = rte_zmalloc_socket("trace_snap", size * sizeof(struct trace_event), RTE_CACHE_LINE_SIZE, socket_id);
+    if (!r->snap) {
+        rte_free(r);
+        return NULL;
+    }
+    r->mask = size - 1;
+    r->lcore = lcore;
+    r->threshold = threshold_cycles ? threshold_cycles : UINT64_MAX;
+    trace_rings[lcore] = r;
+    return r;
+}
+
+void trace_free(struct trace_ring *r) {
+    if (!r) return;
+    trace_rings[r->lcore] = NULL;
+    rte_free(r->snap);
+    rte_free(r);
+}
+
+// Runs on the recording lcore: one copy of the ring, a few microseconds,
+// and only until the trace thread has written it out.
+void trace_freeze(struct trace_ring *r, uint64_t tsc) {
+    memcpy(r->snap, r->events, (r->mask + 1) * sizeof(struct trace_event));
+    r->snap_head = r->head;
+    r->snap_tsc = tsc;
+    __atomic_store_n(&r->frozen, 1, __ATOMIC_RELEASE);
+}
+
+static int write_ring(FILE *f, const struct trace_ring *r, const struct trace_event *events, uint64_t head,
+                      uint64_t first, uint64_t trigger_tsc) {
+    struct trace_ring_header rh = {
+        .lcore = r->lcore,
+        .nb_events = head - first,
+        .trigger_tsc = trigger_tsc,
+    };
+    if (fwrite(&rh, sizeof(rh), 1, f) != 1) return -1;
+    for (uint64_t i = first; i < head; i++)
+        if (fwrite(&events[i & r->mask], sizeof(events[0]), 1, f) != 1) return -1;
+    return 0;
+}
+
+static FILE *open_dump(char *path, size_t size, uint32_t nb_rings, uint32_t reason) {
+    snprintf(path, size, "%s/nettok_trace.%d.%u.bin", trace_dir, getpid(), dump_seq++);
+    FILE *f = fopen(path, "wb");
+    if (!f) {
+        printf("Error: Cannot write trace %s: %s\n", path, strerror(errno));
+        return NULL;
+    }
+    struct trace_file_header fh = {
+        .magic = TRACE_MAGIC,
+        .tsc_hz = rte_get_timer_hz(),
+        .nb_rings = nb_rings,
+        .reason = reason,
+    };
+    if (fwrite(&fh, sizeof(fh), 1, f) != 1) {
+        fclose(f);
+        return NULL;
+    }
+    return f;
+}
+
+static void close_dump(FILE *f, const char *path, int err) {
+    if (fclose(f) != 0 || err) printf("Error: Cannot write trace %s\n", path);
+    else printf("Trace written to %s\n", path);
+}
+
+static void dump_frozen(const struct trace_ring *r) {
+    char path[320];
+    FILE *f = open_dump(path, sizeof(path), 1, 1);
+    if (!f) return;
+    uint64_t size = r->mask + 1;
+    uint64_t first = r->snap_head > size ? r->snap_head - size : 0;
+    close_dump(f, path, write_ring(f, r, r->snap, r->snap_head, first, r->snap_tsc));
+}
+
+// Copies each ring while its lcore keeps writing, then keeps only the
+// events that cannot have been overwritten during the copy.
+static void dump_live(struct trace_event *copy) {
+    uint32_t nb_rings = 0;
+    for (unsigned i = 0; i < RTE_MAX_LCORE; i++) nb_rings += trace_rings[i] != NULL;
+    char path[320];
+    FILE *f = open_dump(path, sizeof(path), nb_rings, 0);
+    if (!f) return;
+    uint64_t now = rte_get_timer_cycles();
+    int err = 0;
+    for (unsigned i = 0; i < RTE_MAX_LCORE && !err; i++) {
+        const struct trace_ring *r = trace_rings[i];
+        if (!r) continue;
+        uint64_t size = r->mask + 1;
+        uint64_t head = __atomic_load_n(&r->head, __ATOMIC_ACQUIRE);
+        uint64_t first = head > size ? head - size : 0;
+        for (uint64_t j = first; j < head; j++) copy[j & r->mask] = r->events[j & r->mask];
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        // The lcore may be writing event later, into the slot of later - size.
+        uint64_t later = __atomic_load_n(&r->head, __ATOMIC_RELAXED);
+        if (later >= size) first = RTE_MIN(head, RTE_MAX(first, later - size + 1));
+        err = write_ring(f, r, copy, head, first, now);
+    }
+    close_dump(f, path, err);
+}
+
+static void *trace_main(__rte_unused void *arg) {
+    uint32_t copy_size = 0;
+    for (unsigned i = 0; i < RTE_MAX_LCORE; i++)
+        if (trace_rings[i]) copy_size = RTE_MAX(copy_size, trace_rings[i]->mask + 1);
+    struct trace_event *copy = rte_malloc("trace_copy", copy_size * sizeof(*copy), 0);
+    uint64_t last_dump[RTE_MAX_LCORE] = {0};
+    uint8_t written[RTE_MAX_LCORE] = {0};
+
+    while (trace_running) {
+        if (dump_requested && copy) {
+            dump_requested = 0;
+            dump_live(copy);
+        }
+        uint64_t now = rte_get_timer_cycles();
+        for (unsigned i = 0; i < RTE_MAX_LCORE; i++) {
+            struct trace_ring *r = trace_rings[i];
+            if (!r || !__atomic_load_n(&r->frozen, __ATOMIC_ACQUIRE)) continue;
+            if (!written[i]) {
+                dump_frozen(r);
+                written[i] = 1;
+                last_dump[i] = now;
+            } else if (now - last_dump[i] >= rte_get_timer_hz()) {
+                // Keeping the copy frozen for a second bounds the dumps a
+                // stream of slow requests can write.
+                written[i] = 0;
+                __atomic_store_n(&r->frozen, 0, __ATOMIC_RELEASE);
+            }
+        }
+        usleep(TRACE_POLL_US);
+    }
+    rte_free(copy);
+    return NULL;
+}
+
+int trace_start(const char *dir) {
+    snprintf(trace_dir, sizeof(trace_dir), "%s", dir);
+    trace_running = 1;
+    if (rte_ctrl_thread_create(&trace_thread, "nettok-trace", NULL, trace_main, NULL) != 0) {
+        printf("Error: Cannot start trace thread\n");
+        trace_running = 0;
+        return -1;
+    }
+    return 0;
+}
+
+void trace_request_dump(void) {
+    dump_requested = 1;
+}
+
+void trace_stop(void) {
+    if (!trace_running) return;
+    trace_running = 0;
+    pthread_join(trace_thread, NULL);
+}
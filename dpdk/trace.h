@@ -0,0 +1,88 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <stdint.h>
+#include <rte_common.h>
+
+#define TRACE_MAGIC "NTTRACE1"
+
+enum trace_flag {
+    TRACE_FRAGMENTED = 1 << 0,  // reassembled from several frames; rx_tsc is the first one's
+    TRACE_PROTO      = 1 << 1,  // had a request header, else legacy text
+    TRACE_TX_DROP    = 1 << 2,  // a pipeline worker's TX ring refused the response
+};
+
+// One answered request, 32 bytes. Times are timer cycles after rx_tsc.
+struct trace_event {
+    uint64_t rx_tsc;
+    uint32_t tokenized;
+    uint32_t sent;
+    uint32_t text_len;
+    uint16_t nb_ids;
+    uint16_t words;
+    uint16_t cache_hits;        // word cache lookups for its last frame, saturated
+    uint16_t cache_misses;
+    uint16_t rx_queue;
+    uint8_t tenant;
+    uint8_t flags;
+};
+
+// Per-lcore flight recorder: the last mask + 1 requests, overwritten in a
+// loop. Only its lcore writes it. A request slower than threshold freezes
+// a copy of the ring in snap for the trace thread to write out.
+struct trace_ring {
+    uint64_t head;              // events recorded so far
+    uint32_t mask;
+    uint32_t lcore;
+    uint64_t threshold;         // RX to TX cycles, UINT64_MAX for none
+    uint32_t frozen;            // snap holds a copy not yet written
+    uint64_t snap_head;
+    uint64_t snap_tsc;          // rx_tsc of the request that froze it
+    struct trace_event *snap;
+    struct trace_event events[] __rte_cache_aligned;
+};
+
+// Dumps are files of a header, then per ring a trace_ring_header and its
+// events, oldest first. All fields are host order.
+struct trace_file_header {
+    char magic[8];
+    uint64_t tsc_hz;            // rte_get_timer_hz()
+    uint32_t nb_rings;
+    uint32_t reason;            // 0 on request (SIGUSR1), 1 for a slow request
+};
+
+struct trace_ring_header {
+    uint32_t lcore;
+    uint32_t nb_events;
+    uint64_t trigger_tsc;       // rx_tsc of the slow request, or the TSC of the dump
+};
+
+// events is rounded up to a power of two; threshold_cycles of 0 never freezes.
+struct trace_ring *trace_create(unsigned lcore, uint32_t events, uint64_t threshold_cycles, int socket_id);
+void trace_free(struct trace_ring *r);
+void trace_freeze(struct trace_ring *r, uint64_t tsc);
+
+// Cycles from tsc to now, saturated to fit an event.
+static inline uint32_t trace_since(uint64_t tsc, uint64_t now) {
+    return now - tsc > UINT32_MAX ? UINT32_MAX : (uint32_t)(now - tsc);
+}
+
+// Stores ev, with sent set from now, and freezes the ring when it took
+// longer than the threshold and no earlier copy is waiting.
+static inline void trace_record(struct trace_ring *r, struct trace_event *ev, uint64_t now) {
+    uint64_t sent = now - ev->rx_tsc;
+    ev->sent = trace_since(ev->rx_tsc, now);
+    r->events[r->head & r->mask] = *ev;
+    __atomic_store_n(&r->head, r->head + 1, __ATOMIC_RELEASE);
+    if (unlikely(sent > r->threshold) && !__atomic_load_n(&r->frozen, __ATOMIC_ACQUIRE)) trace_freeze(r, ev->rx_tsc);
+}
+
+// Starts a control thread that writes frozen rings to dir, at most one
+// file per lcore per second, and every live ring when trace_request_dump()
+// is called. Rings are created before and freed after it runs.
+int trace_start(const char *dir);
+// Async-signal-safe.
+void trace_request_dump(void);
+void trace_stop(void);
+
+#endif
@@ -0,0 +1,204 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <rte_common.h>
+#include <rte_malloc.h>
+
+#include "trie.h"
+
+// Free slots form a doubly linked list in index order, so base search never
+// walks the packed part of the array. A slot that fails as a first-child
+// candidate too often is dropped from the list to bound build time.
+#define DA_MAX_FAILS 16
+
+struct da_builder {
+    struct da_node *nodes;
+    uint32_t *next, *prev;  // free list links
+    uint8_t *fails;
+    uint32_t cap;
+    uint32_t end;           // one past the highest used slot
+    uint32_t head, tail;    // free list, DA_NONE when empty
+};
+
+struct da_pending {
+    uint32_t node;
+    uint32_t lo, hi;      // range of sorted tokens sharing this prefix
+    uint32_t depth;
+};
+
+static int token_cmp(const void *a, const void *b) {
+    const struct vocab_token *x = a, *y = b;
+    uint32_t n = x->len < y->len ? x->len : y->len;
+    int c = memcmp(x->bytes, y->bytes, n);
+    if (c) return c;
+    return (x->len > y->len) - (x->len < y->len);
+}
+
+static void builder_unlink(struct da_builder *b, uint32_t i) {
+    if (b->prev[i] != DA_NONE) b->next[b->prev[i]] = b->next[i];
+    else b->head = b->next[i];
+    if (b->next[i] != DA_NONE) b->prev[b->next[i]] = b->prev[i];
+    else b->tail = b->prev[i];
+}
+
+static int builder_reserve(struct da_builder *b, uint32_t need) {
+    if (need <= b->cap) return 0;
+    uint32_t cap = b->cap ? b->cap : 1024;
+    while (cap < need) cap *= 2;
+    struct da_node *nodes = realloc(b->nodes, cap * sizeof(*nodes));
+    if (nodes) b->nodes = nodes;
+    uint32_t *next = realloc(b->next, cap * sizeof(*next));
+    if (next) b->next = next;
+    uint32_t *prev = realloc(b->prev, cap * sizeof(*prev));
+    if (prev) b->prev = prev;
+    uint8_t *fails = realloc(b->fails, cap);
+    if (fails) b->fails = fails;
+    if (!nodes || !next || !prev || !fails) return -1;
+    for (uint32_t i = b->cap; i < cap; i++) {
+        nodes[i].base = 0;
+        nodes[i].check = -1;
+        nodes[i].id = -1;
+        fails[i] = 0;
+        next[i] = DA_NONE;
+        prev[i] = b->tail;
+        if (b->tail != DA_NONE) next[b->tail] = i;
+        else b->head = i;
+        b->tail = i;
+    }
+    b->cap = cap;
+    return 0;
+}
+
+static void builder_use(struct da_builder *b, uint32_t i, uint32_t parent) {
+    b->nodes[i].check = parent;
+    if (i + 1 > b->end) b->end = i + 1;
+    if (b->fails[i] <= DA_MAX_FAILS) builder_unlink(b, i);
+}
+
+// Picks a base such that base + label is free for every label; the first
+// child is always placed on a listed free slot.
+static int32_t find_base(struct da_builder *b, const uint16_t *labels, int nb) {
+    uint32_t f = b->head;
+    for (;;) {
+        if (f == DA_NONE) {
+            // Grow and continue from the fresh tail.
+            uint32_t old = b->cap;
+            if (builder_reserve(b, b->cap * 2) < 0) return -1;
+            f = old;
+        }
+        if (f > labels[0]) {
+            uint32_t base = f - labels[0];
+            if (builder_reserve(b, base + 257) < 0) return -1;
+            int k = 1;
+            while (k < nb && b->nodes[base + labels[k]].check < 0) k++;
+            if (k == nb) return base;
+            if (++b->fails[f] > DA_MAX_FAILS) builder_unlink(b, f);
+        }
+        f = b->next[f];
+    }
+}
+
+struct da_trie *da_trie_build(const struct vocab_token *tokens, int count) {
+    struct vocab_token *sorted = malloc((count ? count : 1) * sizeof(*sorted));
+    struct da_pending *queue = malloc(sizeof(*queue) * 1024);
+    uint32_t queue_cap = 1024, head = 0, tail = 0;
+    struct da_builder b = { .head = DA_NONE, .tail = DA_NONE };
+    struct da_trie *trie = rte_zmalloc("da_trie", sizeof(*trie), 0);
+    if (!sorted || !queue || !trie || builder_reserve(&b, 1024) < 0) goto fail;
+
+    memcpy(sorted, tokens, count * sizeof(*sorted));
+    qsort(sorted, count, sizeof(*sorted), token_cmp);
+    for (int i = 0; i < count; i++) {
+        if (sorted[i].len > trie->max_len) trie->max_len = sorted[i].len;
+        if ((uint32_t)sorted[i].id >= trie->vocab_size) trie->vocab_size = sorted[i].id + 1;
+    }
+
+    builder_use(&b, DA_ROOT, DA_ROOT);
+    queue[tail++] = (struct da_pending){ DA_ROOT, 0, count, 0 };
+
+    while (head < tail) {
+        struct da_pending p = queue[head++];
+        uint32_t lo = p.lo;
+        while (lo < p.hi && sorted[lo].len == p.depth) {
+            b.nodes[p.node].id = sorted[lo].id;
+            trie->nb_keys++;
+            lo++;
+        }
+        if (lo == p.hi) continue;
+
+        uint16_t labels[256];
+        uint32_t starts[257];
+        int nb = 0;
+        for (uint32_t k = lo; k < p.hi; k++) {
+            uint16_t label = sorted[k].bytes[p.depth] + 1;
+            if (!nb || labels[nb - 1] != label) {
+                labels[nb] = label;
+                starts[nb++] = k;
+            }
+        }
+        starts[nb] = p.hi;
+
+        int32_t base = find_base(&b, labels, nb);
+        if (base < 0) goto fail;
+        b.nodes[p.node].base = base;
+        if (tail + nb > queue_cap) {
+            // Reclaim the consumed prefix before growing.
+            memmove(queue, queue + head, (tail - head) * sizeof(*queue));
+            tail -= head;
+            head = 0;
+            while (tail + nb > queue_cap) queue_cap *= 2;
+            struct da_pending *q = realloc(queue, queue_cap * sizeof(*queue));
+            if (!q) goto fail;
+            queue = q;
+        }
+        for (int k = 0; k < nb; k++) {
+            uint32_t child = base + labels[k];
+            builder_use(&b, child, p.node);
+            queue[tail++] = (struct da_pending){ child, starts[k], starts[k + 1], p.depth + 1 };
+        }
+    }
+
+    // Any base stays below b.end, so padding by 257 keeps da_trie_next in bounds.
+    trie->size = b.end + 257;
+    if (builder_reserve(&b, trie->size) < 0) goto fail;
+    trie->nodes = rte_malloc("da_trie_nodes", trie->size * sizeof(struct da_node), RTE_CACHE_LINE_SIZE);
+    if (!trie->nodes) goto fail;
+    memcpy(trie->nodes, b.nodes, trie->size * sizeof(struct da_node));
+
+    free(b.nodes);
+    free(b.next);
+    free(b.prev);
+    free(b.fails);
+    free(queue);
+    free(sorted);
+    return trie;
+
+fail:
+    printf("Error: Failed to build vocabulary trie\n");
+    free(b.nodes);
+    free(b.next);
+    free(b.prev);
+    free(b.fails);
+    free(queue);
+    free(sorted);
+    da_trie_free(trie);
+    return NULL;
+}
+
+struct da_trie *da_trie_from_image(const struct vocab_image_header *img) {
+    struct da_trie *trie = rte_zmalloc("da_trie", sizeof(*trie), 0);
+    if (!trie) return NULL;
+    trie->nodes = (struct da_node *)((const uint8_t *)img + img->trie_off);
+    trie->in_image = 1;
+    trie->size = img->trie_size;
+    trie->nb_keys = img->nb_keys;
+    trie->max_len = img->max_len;
+    trie->vocab_size = img->vocab_size;
+    return trie;
+}
+
+void da_trie_free(struct da_trie *trie) {
+    if (!trie) return;
+    if (!trie->in_image) rte_free(trie->nodes);
+    rte_free(trie);
+}
@@ -0,0 +1,73 @@
+#ifndef TRIE_H
+#define TRIE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "vocab.h"
+
+#define DA_ROOT 0
+#define DA_NONE UINT32_MAX
+
+// Double-array trie over raw token bytes. Child of node s on byte c lives at
+// base[s] + c + 1 and is valid when its check equals s, so base, check and
+// the token id share one 12-byte entry.
+struct da_node {
+    int32_t base;
+    int32_t check;
+    int32_t id;     // token id when a key ends here, -1 otherwise
+};
+
+struct da_trie {
+    struct da_node *nodes;  // hugepage memory (rte_malloc), or an image's
+    int in_image;
+    uint32_t size;
+    uint32_t nb_keys;
+    uint32_t max_len;
+    uint32_t vocab_size;
+};
+
+struct da_trie *da_trie_build(const struct vocab_token *tokens, int count);
+// Uses the node array of a loaded image in place; the image must outlive the trie.
+struct da_trie *da_trie_from_image(const struct vocab_image_header *img);
+void da_trie_free(struct da_trie *trie);
+
+// The array is sized so base + 256 never runs past the end.
+static inline uint32_t da_trie_next(const struct da_trie *trie, uint32_t s, uint8_t c) {
+    uint32_t n = (uint32_t)trie->nodes[s].base + c + 1;
+    return trie->nodes[n].check == (int32_t)s ? n : DA_NONE;
+}
+
+static inline uint32_t da_trie_walk(const struct da_trie *trie, uint32_t s, const uint8_t *key, size_t len) {
+    for (size_t i = 0; i < len && s != DA_NONE; i++) s = da_trie_next(trie, s, key[i]);
+    return s;
+}
+
+// Exact match; returns the token id or -1.
+static inline int da_trie_lookup(const struct da_trie *trie, const uint8_t *key, size_t len) {
+    uint32_t s = da_trie_walk(trie, DA_ROOT, key, len);
+    return s == DA_NONE ? -1 : trie->nodes[s].id;
+}
+
+// Longest key that prefixes s[0..len) starting from node `from`, in a single
+// forward scan. Returns its length (0 if none) and stores the id.
+static inline size_t da_trie_longest_from(const struct da_trie *trie, uint32_t from,
+                                          const uint8_t *s, size_t len, int *id) {
+    size_t best = 0;
+    uint32_t node = from;
+    for (size_t i = 0; i < len; i++) {
+        node = da_trie_next(trie, node, s[i]);
+        if (node == DA_NONE) break;
+        if (trie->nodes[node].id >= 0) {
+            best = i + 1;
+            *id = trie->nodes[node].id;
+        }
+    }
+    return best;
+}
+
+static inline size_t da_trie_longest(const struct da_trie *trie, const uint8_t *s, size_t len, int *id) {
+    return da_trie_longest_from(trie, DA_ROOT, s, len, id);
+}
+
+#endif
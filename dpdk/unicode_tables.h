@@ -0,0 +1,3428 @@
+// Generated by vocab/gen_unicode_tables.py (Unicode 14.0.0). Do not edit.
+#ifndef UNICODE_TABLES_H
+#define UNICODE_TABLES_H
+
+#include <stdint.h>
+
+static const uint32_t uc_letter_ranges[][2] __attribute__((unused)) = {
+    {0x000AA, 0x000AA}, {0x000B5, 0x000B5}, {0x000BA, 0x000BA}, {0x000C0, 0x000D6},
+    {0x000D8, 0x000F6}, {0x000F8, 0x002C1}, {0x002C6, 0x002D1}, {0x002E0, 0x002E4},
+    {0x002EC, 0x002EC}, {0x002EE, 0x002EE}, {0x00370, 0x00374}, {0x00376, 0x00377},
+    {0x0037A, 0x0037D}, {0x0037F, 0x0037F}, {0x00386, 0x00386}, {0x00388, 0x0038A},
+    {0x0038C, 0x0038C}, {0x0038E, 0x003A1}, {0x003A3, 0x003F5}, {0x003F7, 0x00481},
+    {0x0048A, 0x0052F}, {0x00531, 0x00556}, {0x00559, 0x00559}, {0x00560, 0x00588},
+    {0x005D0, 0x005EA}, {0x005EF, 0x005F2}, {0x00620, 0x0064A}, {0x0066E, 0x0066F},
+    {0x00671, 0x006D3}, {0x006D5, 0x006D5}, {0x006E5, 0x006E6}, {0x006EE, 0x006EF},
+    {0x006FA, 0x006FC}, {0x006FF, 0x006FF}, {0x00710, 0x00710}, {0x00712, 0x0072F},
+    {0x0074D, 0x007A5}, {0x007B1, 0x007B1}, {0x007CA, 0x007EA}, {0x007F4, 0x007F5},
+    {0x007FA, 0x007FA}, {0x00800, 0x00815}, {0x0081A, 0x0081A}, {0x00824, 0x00824},
+    {0x00828, 0x00828}, {0x00840, 0x00858}, {0x00860, 0x0086A}, {0x00870, 0x00887},
+    {0x00889, 0x0088E}, {0x008A0, 0x008C9}, {0x00904, 0x00939}, {0x0093D, 0x0093D},
+    {0x00950, 0x00950}, {0x00958, 0x00961}, {0x00971, 0x00980}, {0x00985, 0x0098C},
+    {0x0098F, 0x00990}, {0x00993, 0x009A8}, {0x009AA, 0x009B0}, {0x009B2, 0x009B2},
+    {0x009B6, 0x009B9}, {0x009BD, 0x009BD}, {0x009CE, 0x009CE}, {0x009DC, 0x009DD},
+    {0x009DF, 0x009E1}, {0x009F0, 0x009F1}, {0x009FC, 0x009FC}, {0x00A05, 0x00A0A},
+    {0x00A0F, 0x00A10}, {0x00A13, 0x00A28}, {0x00A2A, 0x00A30}, {0x00A32, 0x00A33},
+    {0x00A35, 0x00A36}, {0x00A38, 0x00A39}, {0x00A59, 0x00A5C}, {0x00A5E, 0x00A5E},
+    {0x00A72, 0x00A74}, {0x00A85, 0x00A8D}, {0x00A8F, 0x00A91}, {0x00A93, 0x00AA8},
+    {0x00AAA, 0x00AB0}, {0x00AB2, 0x00AB3}, {0x00AB5, 0x00AB9}, {0x00ABD, 0x00ABD},
+    {0x00AD0, 0x00AD0}, {0x00AE0, 0x00AE1}, {0x00AF9, 0x00AF9}, {0x00B05, 0x00B0C},
+    {0x00B0F, 0x00B10}, {0x00B13, 0x00B28}, {0x00B2A, 0x00B30}, {0x00B32, 0x00B33},
+    {0x00B35, 0x00B39}, {0x00B3D, 0x00B3D}, {0x00B5C, 0x00B5D}, {0x00B5F, 0x00B61},
+    {0x00B71, 0x00B71}, {0x00B83, 0x00B83}, {0x00B85, 0x00B8A}, {0x00B8E, 0x00B90},
+    {0x00B92, 0x00B95}, {0x00B99, 0x00B9A}, {0x00B9C, 0x00B9C}, {0x00B9E, 0x00B9F},
+    {0x00BA3, 0x00BA4}, {0x00BA8, 0x00BAA}, {0x00BAE, 0x00BB9}, {0x00BD0, 0x00BD0},
+    {0x00C05, 0x00C0C}, {0x00C0E, 0x00C10}, {0x00C12, 0x00C28}, {0x00C2A, 0x00C39},
+    {0x00C3D, 0x00C3D}, {0x00C58, 0x00C5A}, {0x00C5D, 0x00C5D}, {0x00C60, 0x00C61},
+    {0x00C80, 0x00C80}, {0x00C85, 0x00C8C}, {0x00C8E, 0x00C90}, {0x00C92, 0x00CA8},
+    {0x00CAA, 0x00CB3}, {0x00CB5, 0x00CB9}, {0x00CBD, 0x00CBD}, {0x00CDD, 0x00CDE},
+    {0x00CE0, 0x00CE1}, {0x00CF1, 0x00CF2}, {0x00D04, 0x00D0C}, {0x00D0E, 0x00D10},
+    {0x00D12, 0x00D3A}, {0x00D3D, 0x00D3D}, {0x00D4E, 0x00D4E}, {0x00D54, 0x00D56},
+    {0x00D5F, 0x00D61}, {0x00D7A, 0x00D7F}, {0x00D85, 0x00D96}, {0x00D9A, 0x00DB1},
+    {0x00DB3, 0x00DBB}, {0x00DBD, 0x00DBD}, {0x00DC0, 0x00DC6}, {0x00E01, 0x00E30},
+    {0x00E32, 0x00E33}, {0x00E40, 0x00E46}, {0x00E81, 0x00E82}, {0x00E84, 0x00E84},
+    {0x00E86, 0x00E8A}, {0x00E8C, 0x00EA3}, {0x00EA5, 0x00EA5}, {0x00EA7, 0x00EB0},
+    {0x00EB2, 0x00EB3}, {0x00EBD, 0x00EBD}, {0x00EC0, 0x00EC4}, {0x00EC6, 0x00EC6},
+    {0x00EDC, 0x00EDF}, {0x00F00, 0x00F00}, {0x00F40, 0x00F47}, {0x00F49, 0x00F6C},
+    {0x00F88, 0x00F8C}, {0x01000, 0x0102A}, {0x0103F, 0x0103F}, {0x01050, 0x01055},
+    {0x0105A, 0x0105D}, {0x01061, 0x01061}, {0x01065, 0x01066}, {0x0106E, 0x01070},
+    {0x01075, 0x01081}, {0x0108E, 0x0108E}, {0x010A0, 0x010C5}, {0x010C7, 0x010C7},
+    {0x010CD, 0x010CD}, {0x010D0, 0x010FA}, {0x010FC, 0x01248}, {0x0124A, 0x0124D},
+    {0x01250, 0x01256}, {0x01258, 0x01258}, {0x0125A, 0x0125D}, {0x01260, 0x01288},
+    {0x0128A, 0x0128D}, {0x01290, 0x012B0}, {0x012B2, 0x012B5}, {0x012B8, 0x012BE},
+    {0x012C0, 0x012C0}, {0x012C2, 0x012C5}, {0x012C8, 0x012D6}, {0x012D8, 0x01310},
+    {0x01312, 0x01315}, {0x01318, 0x0135A}, {0x01380, 0x0138F}, {0x013A0, 0x013F5},
+    {0x013F8, 0x013FD}, {0x01401, 0x0166C}, {0x0166F, 0x0167F}, {0x01681, 0x0169A},
+    {0x016A0, 0x016EA}, {0x016F1, 0x016F8}, {0x01700, 0x01711}, {0x0171F, 0x01731},
+    {0x01740, 0x01751}, {0x01760, 0x0176C}, {0x0176E, 0x01770}, {0x01780, 0x017B3},
+    {0x017D7, 0x017D7}, {0x017DC, 0x017DC}, {0x01820, 0x01878}, {0x01880, 0x01884},
+    {0x01887, 0x018A8}, {0x018AA, 0x018AA}, {0x018B0, 0x018F5}, {0x01900, 0x0191E},
+    {0x01950, 0x0196D}, {0x01970, 0x01974}, {0x01980, 0x019AB}, {0x019B0, 0x019C9},
+    {0x01A00, 0x01A16}, {0x01A20, 0x01A54}, {0x01AA7, 0x01AA7}, {0x01B05, 0x01B33},
+    {0x01B45, 0x01B4C}, {0x01B83, 0x01BA0}, {0x01BAE, 0x01BAF}, {0x01BBA, 0x01BE5},
+    {0x01C00, 0x01C23}, {0x01C4D, 0x01C4F}, {0x01C5A, 0x01C7D}, {0x01C80, 0x01C88},
+    {0x01C90, 0x01CBA}, {0x01CBD, 0x01CBF}, {0x01CE9, 0x01CEC}, {0x01CEE, 0x01CF3},
+    {0x01CF5, 0x01CF6}, {0x01CFA, 0x01CFA}, {0x01D00, 0x01DBF}, {0x01E00, 0x01F15},
+    {0x01F18, 0x01F1D}, {0x01F20, 0x01F45}, {0x01F48, 0x01F4D}, {0x01F50, 0x01F57},
+    {0x01F59, 0x01F59}, {0x01F5B, 0x01F5B}, {0x01F5D, 0x01F5D}, {0x01F5F, 0x01F7D},
+    {0x01F80, 0x01FB4}, {0x01FB6, 0x01FBC}, {0x01FBE, 0x01FBE}, {0x01FC2, 0x01FC4},
+    {0x01FC6, 0x01FCC}, {0x01FD0, 0x01FD3}, {0x01FD6, 0x01FDB}, {0x01FE0, 0x01FEC},
+    {0x01FF2, 0x01FF4}, {0x01FF6, 0x01FFC}, {0x02071, 0x02071}, {0x0207F, 0x0207F},
+    {0x02090, 0x0209C}, {0x02102, 0x02102}, {0x02107, 0x02107}, {0x0210A, 0x02113},
+    {0x02115, 0x02115}, {0x02119, 0x0211D}, {0x02124, 0x02124}, {0x02126, 0x02126},
+    {0x02128, 0x02128}, {0x0212A, 0x0212D}, {0x0212F, 0x02139}, {0x0213C, 0x0213F},
+    {0x02145, 0x02149}, {0x0214E, 0x0214E}, {0x02183, 0x02184}, {0x02C00, 0x02CE4},
+    {0x02CEB, 0x02CEE}, {0x02CF2, 0x02CF3}, {0x02D00, 0x02D25}, {0x02D27, 0x02D27},
+    {0x02D2D, 0x02D2D}, {0x02D30, 0x02D67}, {0x02D6F, 0x02D6F}, {0x02D80, 0x02D96},
+    {0x02DA0, 0x02DA6}, {0x02DA8, 0x02DAE}, {0x02DB0, 0x02DB6}, {0x02DB8, 0x02DBE},
+    {0x02DC0, 0x02DC6}, {0x02DC8, 0x02DCE}, {0x02DD0, 0x02DD6}, {0x02DD8, 0x02DDE},
+    {0x02E2F, 0x02E2F}, {0x03005, 0x03006}, {0x03031, 0x03035}, {0x0303B, 0x0303C},
+    {0x03041, 0x03096}, {0x0309D, 0x0309F}, {0x030A1, 0x030FA}, {0x030FC, 0x030FF},
+    {0x03105, 0x0312F}, {0x03131, 0x0318E}, {0x031A0, 0x031BF}, {0x031F0, 0x031FF},
+    {0x03400, 0x04DBF}, {0x04E00, 0x0A48C}, {0x0A4D0, 0x0A4FD}, {0x0A500, 0x0A60C},
+    {0x0A610, 0x0A61F}, {0x0A62A, 0x0A62B}, {0x0A640, 0x0A66E}, {0x0A67F, 0x0A69D},
+    {0x0A6A0, 0x0A6E5}, {0x0A717, 0x0A71F}, {0x0A722, 0x0A788}, {0x0A78B, 0x0A7CA},
+    {0x0A7D0, 0x0A7D1}, {0x0A7D3, 0x0A7D3}, {0x0A7D5, 0x0A7D9}, {0x0A7F2, 0x0A801},
+    {0x0A803, 0x0A805}, {0x0A807, 0x0A80A}, {0x0A80C, 0x0A822}, {0x0A840, 0x0A873},
+    {0x0A882, 0x0A8B3}, {0x0A8F2, 0x0A8F7}, {0x0A8FB, 0x0A8FB}, {0x0A8FD, 0x0A8FE},
+    {0x0A90A, 0x0A925}, {0x0A930, 0x0A946}, {0x0A960, 0x0A97C}, {0x0A984, 0x0A9B2},
+    {0x0A9CF, 0x0A9CF}, {0x0A9E0, 0x0A9E4}, {0x0A9E6, 0x0A9EF}, {0x0A9FA, 0x0A9FE},
+    {0x0AA00, 0x0AA28}, {0x0AA40, 0x0AA42}, {0x0AA44, 0x0AA4B}, {0x0AA60, 0x0AA76},
+    {0x0AA7A, 0x0AA7A}, {0x0AA7E, 0x0AAAF}, {0x0AAB1, 0x0AAB1}, {0x0AAB5, 0x0AAB6},
+    {0x0AAB9, 0x0AABD}, {0x0AAC0, 0x0AAC0}, {0x0AAC2, 0x0AAC2}, {0x0AADB, 0x0AADD},
+    {0x0AAE0, 0x0AAEA}, {0x0AAF2, 0x0AAF4}, {0x0AB01, 0x0AB06}, {0x0AB09, 0x0AB0E},
+    {0x0AB11, 0x0AB16}, {0x0AB20, 0x0AB26}, {0x0AB28, 0x0AB2E}, {0x0AB30, 0x0AB5A},
+    {0x0AB5C, 0x0AB69}, {0x0AB70, 0x0ABE2}, {0x0AC00, 0x0D7A3}, {0x0D7B0, 0x0D7C6},
+    {0x0D7CB, 0x0D7FB}, {0x0F900, 0x0FA6D}, {0x0FA70, 0x0FAD9}, {0x0FB00, 0x0FB06},
+    {0x0FB13, 0x0FB17}, {0x0FB1D, 0x0FB1D}, {0x0FB1F, 0x0FB28}, {0x0FB2A, 0x0FB36},
+    {0x0FB38, 0x0FB3C}, {0x0FB3E, 0x0FB3E}, {0x0FB40, 0x0FB41}, {0x0FB43, 0x0FB44},
+    {0x0FB46, 0x0FBB1}, {0x0FBD3, 0x0FD3D}, {0x0FD50, 0x0FD8F}, {0x0FD92, 0x0FDC7},
+    {0x0FDF0, 0x0FDFB}, {0x0FE70, 0x0FE74}, {0x0FE76, 0x0FEFC}, {0x0FF21, 0x0FF3A},
+    {0x0FF41, 0x0FF5A}, {0x0FF66, 0x0FFBE}, {0x0FFC2, 0x0FFC7}, {0x0FFCA, 0x0FFCF},
+    {0x0FFD2, 0x0FFD7}, {0x0FFDA, 0x0FFDC}, {0x10000, 0x1000B}, {0x1000D, 0x10026},
+    {0x10028, 0x1003A}, {0x1003C, 0x1003D}, {0x1003F, 0x1004D}, {0x10050, 0x1005D},
+    {0x10080, 0x100FA}, {0x10280, 0x1029C}, {0x102A0, 0x102D0}, {0x10300, 0x1031F},
+    {0x1032D, 0x10340}, {0x10342, 0x10349}, {0x10350, 0x10375}, {0x10380, 0x1039D},
+    {0x103A0, 0x103C3}, {0x103C8, 0x103CF}, {0x10400, 0x1049D}, {0x104B0, 0x104D3},
+    {0x104D8, 0x104FB}, {0x10500, 0x10527}, {0x10530, 0x10563}, {0x10570, 0x1057A},
+    {0x1057C, 0x1058A}, {0x1058C, 0x10592}, {0x10594, 0x10595}, {0x10597, 0x105A1},
+    {0x105A3, 0x105B1}, {0x105B3, 0x105B9}, {0x105BB, 0x105BC}, {0x10600, 0x10736},
+    {0x10740, 0x10755}, {0x10760, 0x10767}, {0x10780, 0x10785}, {0x10787, 0x107B0},
+    {0x107B2, 0x107BA}, {0x10800, 0x10805}, {0x10808, 0x10808}, {0x1080A, 0x10835},
+    {0x10837, 0x10838}, {0x1083C, 0x1083C}, {0x1083F, 0x10855}, {0x10860, 0x10876},
+    {0x10880, 0x1089E}, {0x108E0, 0x108F2}, {0x108F4, 0x108F5}, {0x10900, 0x10915},
+    {0x10920, 0x10939}, {0x10980, 0x109B7}, {0x109BE, 0x109BF}, {0x10A00, 0x10A00},
+    {0x10A10, 0x10A13}, {0x10A15, 0x10A17}, {0x10A19, 0x10A35}, {0x10A60, 0x10A7C},
+    {0x10A80, 0x10A9C}, {0x10AC0, 0x10AC7}, {0x10AC9, 0x10AE4}, {0x10B00, 0x10B35},
+    {0x10B40, 0x10B55}, {0x10B60, 0x10B72}, {0x10B80, 0x10B91}, {0x10C00, 0x10C48},
+    {0x10C80, 0x10CB2}, {0x10CC0, 0x10CF2}, {0x10D00, 0x10D23}, {0x10E80, 0x10EA9},
+    {0x10EB0, 0x10EB1}, {0x10F00, 0x10F1C}, {0x10F27, 0x10F27}, {0x10F30, 0x10F45},
+    {0x10F70, 0x10F81}, {0x10FB0, 0x10FC4}, {0x10FE0, 0x10FF6}, {0x11003, 0x11037},
+    {0x11071, 0x11072}, {0x11075, 0x11075}, {0x11083, 0x110AF}, {0x110D0, 0x110E8},
+    {0x11103, 0x11126}, {0x11144, 0x11144}, {0x11147, 0x11147}, {0x11150, 0x11172},
+    {0x11176, 0x11176}, {0x11183, 0x111B2}, {0x111C1, 0x111C4}, {0x111DA, 0x111DA},
+    {0x111DC, 0x111DC}, {0x11200, 0x11211}, {0x11213, 0x1122B}, {0x11280, 0x11286},
+    {0x11288, 0x11288}, {0x1128A, 0x1128D}, {0x1128F, 0x1129D}, {0x1129F, 0x112A8},
+    {0x112B0, 0x112DE}, {0x11305, 0x1130C}, {0x1130F, 0x11310}, {0x11313, 0x11328},
+    {0x1132A, 0x11330}, {0x11332, 0x11333}, {0x11335, 0x11339}, {0x1133D, 0x1133D},
+    {0x11350, 0x11350}, {0x1135D, 0x11361}, {0x11400, 0x11434}, {0x11447, 0x1144A},
+    {0x1145F, 0x11461}, {0x11480, 0x114AF}, {0x114C4, 0x114C5}, {0x114C7, 0x114C7},
+    {0x11580, 0x115AE}, {0x115D8, 0x115DB}, {0x11600, 0x1162F}, {0x11644, 0x11644},
+    {0x11680, 0x116AA}, {0x116B8, 0x116B8}, {0x11700, 0x1171A}, {0x11740, 0x11746},
+    {0x11800, 0x1182B}, {0x118A0, 0x118DF}, {0x118FF, 0x11906}, {0x11909, 0x11909},
+    {0x1190C, 0x11913}, {0x11915, 0x11916}, {0x11918, 0x1192F}, {0x1193F, 0x1193F},
+    {0x11941, 0x11941}, {0x119A0, 0x119A7}, {0x119AA, 0x119D0}, {0x119E1, 0x119E1},
+    {0x119E3, 0x119E3}, {0x11A00, 0x11A00}, {0x11A0B, 0x11A32}, {0x11A3A, 0x11A3A},
+    {0x11A50, 0x11A50}, {0x11A5C, 0x11A89}, {0x11A9D, 0x11A9D}, {0x11AB0, 0x11AF8},
+    {0x11C00, 0x11C08}, {0x11C0A, 0x11C2E}, {0x11C40, 0x11C40}, {0x11C72, 0x11C8F},
+    {0x11D00, 0x11D06}, {0x11D08, 0x11D09}, {0x11D0B, 0x11D30}, {0x11D46, 0x11D46},
+    {0x11D60, 0x11D65}, {0x11D67, 0x11D68}, {0x11D6A, 0x11D89}, {0x11D98, 0x11D98},
+    {0x11EE0, 0x11EF2}, {0x11FB0, 0x11FB0}, {0x12000, 0x12399}, {0x12480, 0x12543},
+    {0x12F90, 0x12FF0}, {0x13000, 0x1342E}, {0x14400, 0x14646}, {0x16800, 0x16A38},
+    {0x16A40, 0x16A5E}, {0x16A70, 0x16ABE}, {0x16AD0, 0x16AED}, {0x16B00, 0x16B2F},
+    {0x16B40, 0x16B43}, {0x16B63, 0x16B77}, {0x16B7D, 0x16B8F}, {0x16E40, 0x16E7F},
+    {0x16F00, 0x16F4A}, {0x16F50, 0x16F50}, {0x16F93, 0x16F9F}, {0x16FE0, 0x16FE1},
+    {0x16FE3, 0x16FE3}, {0x17000, 0x187F7}, {0x18800, 0x18CD5}, {0x18D00, 0x18D08},
+    {0x1AFF0, 0x1AFF3}, {0x1AFF5, 0x1AFFB}, {0x1AFFD, 0x1AFFE}, {0x1B000, 0x1B122},
+    {0x1B150, 0x1B152}, {0x1B164, 0x1B167}, {0x1B170, 0x1B2FB}, {0x1BC00, 0x1BC6A},
+    {0x1BC70, 0x1BC7C}, {0x1BC80, 0x1BC88}, {0x1BC90, 0x1BC99}, {0x1D400, 0x1D454},
+    {0x1D456, 0x1D49C}, {0x1D49E, 0x1D49F}, {0x1D4A2, 0x1D4A2}, {0x1D4A5, 0x1D4A6},
+    {0x1D4A9, 0x1D4AC}, {0x1D4AE, 0x1D4B9}, {0x1D4BB, 0x1D4BB}, {0x1D4BD, 0x1D4C3},
+    {0x1D4C5, 0x1D505}, {0x1D507, 0x1D50A}, {0x1D50D, 0x1D514}, {0x1D516, 0x1D51C},
+    {0x1D51E, 0x1D539}, {0x1D53B, 0x1D53E}, {0x1D540, 0x1D544}, {0x1D546, 0x1D546},
+    {0x1D54A, 0x1D550}, {0x1D552, 0x1D6A5}, {0x1D6A8, 0x1D6C0}, {0x1D6C2, 0x1D6DA},
+    {0x1D6DC, 0x1D6FA}, {0x1D6FC, 0x1D714}, {0x1D716, 0x1D734}, {0x1D736, 0x1D74E},
+    {0x1D750, 0x1D76E}, {0x1D770, 0x1D788}, {0x1D78A, 0x1D7A8}, {0x1D7AA, 0x1D7C2},
+    {0x1D7C4, 0x1D7CB}, {0x1DF00, 0x1DF1E}, {0x1E100, 0x1E12C}, {0x1E137, 0x1E13D},
+    {0x1E14E, 0x1E14E}, {0x1E290, 0x1E2AD}, {0x1E2C0, 0x1E2EB}, {0x1E7E0, 0x1E7E6},
+    {0x1E7E8, 0x1E7EB}, {0x1E7ED, 0x1E7EE}, {0x1E7F0, 0x1E7FE}, {0x1E800, 0x1E8C4},
+    {0x1E900, 0x1E943}, {0x1E94B, 0x1E94B}, {0x1EE00, 0x1EE03}, {0x1EE05, 0x1EE1F},
+    {0x1EE21, 0x1EE22}, {0x1EE24, 0x1EE24}, {0x1EE27, 0x1EE27}, {0x1EE29, 0x1EE32},
+    {0x1EE34, 0x1EE37}, {0x1EE39, 0x1EE39}, {0x1EE3B, 0x1EE3B}, {0x1EE42, 0x1EE42},
+    {0x1EE47, 0x1EE47}, {0x1EE49, 0x1EE49}, {0x1EE4B, 0x1EE4B}, {0x1EE4D, 0x1EE4F},
+    {0x1EE51, 0x1EE52}, {0x1EE54, 0x1EE54}, {0x1EE57, 0x1EE57}, {0x1EE59, 0x1EE59},
+    {0x1EE5B, 0x1EE5B}, {0x1EE5D, 0x1EE5D}, {0x1EE5F, 0x1EE5F}, {0x1EE61, 0x1EE62},
+    {0x1EE64, 0x1EE64}, {0x1EE67, 0x1EE6A}, {0x1EE6C, 0x1EE72}, {0x1EE74, 0x1EE77},
+    {0x1EE79, 0x1EE7C}, {0x1EE7E, 0x1EE7E}, {0x1EE80, 0x1EE89}, {0x1EE8B, 0x1EE9B},
+    {0x1EEA1, 0x1EEA3}, {0x1EEA5, 0x1EEA9}, {0x1EEAB, 0x1EEBB}, {0x20000, 0x2A6DF},
+    {0x2A700, 0x2B738}, {0x2B740, 0x2B81D}, {0x2B820, 0x2CEA1}, {0x2CEB0, 0x2EBE0},
+    {0x2F800, 0x2FA1D}, {0x30000, 0x3134A},
+};
+
+static const uint32_t uc_number_ranges[][2] __attribute__((unused)) = {
+    {0x000B2, 0x000B3}, {0x000B9, 0x000B9}, {0x000BC, 0x000BE}, {0x00660, 0x00669},
+    {0x006F0, 0x006F9}, {0x007C0, 0x007C9}, {0x00966, 0x0096F}, {0x009E6, 0x009EF},
+    {0x009F4, 0x009F9}, {0x00A66, 0x00A6F}, {0x00AE6, 0x00AEF}, {0x00B66, 0x00B6F},
+    {0x00B72, 0x00B77}, {0x00BE6, 0x00BF2}, {0x00C66, 0x00C6F}, {0x00C78, 0x00C7E},
+    {0x00CE6, 0x00CEF}, {0x00D58, 0x00D5E}, {0x00D66, 0x00D78}, {0x00DE6, 0x00DEF},
+    {0x00E50, 0x00E59}, {0x00ED0, 0x00ED9}, {0x00F20, 0x00F33}, {0x01040, 0x01049},
+    {0x01090, 0x01099}, {0x01369, 0x0137C}, {0x016EE, 0x016F0}, {0x017E0, 0x017E9},
+    {0x017F0, 0x017F9}, {0x01810, 0x01819}, {0x01946, 0x0194F}, {0x019D0, 0x019DA},
+    {0x01A80, 0x01A89}, {0x01A90, 0x01A99}, {0x01B50, 0x01B59}, {0x01BB0, 0x01BB9},
+    {0x01C40, 0x01C49}, {0x01C50, 0x01C59}, {0x02070, 0x02070}, {0x02074, 0x02079},
+    {0x02080, 0x02089}, {0x02150, 0x02182}, {0x02185, 0x02189}, {0x02460, 0x0249B},
+    {0x024EA, 0x024FF}, {0x02776, 0x02793}, {0x02CFD, 0x02CFD}, {0x03007, 0x03007},
+    {0x03021, 0x03029}, {0x03038, 0x0303A}, {0x03192, 0x03195}, {0x03220, 0x03229},
+    {0x03248, 0x0324F}, {0x03251, 0x0325F}, {0x03280, 0x03289}, {0x032B1, 0x032BF},
+    {0x0A620, 0x0A629}, {0x0A6E6, 0x0A6EF}, {0x0A830, 0x0A835}, {0x0A8D0, 0x0A8D9},
+    {0x0A900, 0x0A909}, {0x0A9D0, 0x0A9D9}, {0x0A9F0, 0x0A9F9}, {0x0AA50, 0x0AA59},
+    {0x0ABF0, 0x0ABF9}, {0x0FF10, 0x0FF19}, {0x10107, 0x10133}, {0x10140, 0x10178},
+    {0x1018A, 0x1018B}, {0x102E1, 0x102FB}, {0x10320, 0x10323}, {0x10341, 0x10341},
+    {0x1034A, 0x1034A}, {0x103D1, 0x103D5}, {0x104A0, 0x104A9}, {0x10858, 0x1085F},
+    {0x10879, 0x1087F}, {0x108A7, 0x108AF}, {0x108FB, 0x108FF}, {0x10916, 0x1091B},
+    {0x109BC, 0x109BD}, {0x109C0, 0x109CF}, {0x109D2, 0x109FF}, {0x10A40, 0x10A48},
+    {0x10A7D, 0x10A7E}, {0x10A9D, 0x10A9F}, {0x10AEB, 0x10AEF}, {0x10B58, 0x10B5F},
+    {0x10B78, 0x10B7F}, {0x10BA9, 0x10BAF}, {0x10CFA, 0x10CFF}, {0x10D30, 0x10D39},
+    {0x10E60, 0x10E7E}, {0x10F1D, 0x10F26}, {0x10F51, 0x10F54}, {0x10FC5, 0x10FCB},
+    {0x11052, 0x1106F}, {0x110F0, 0x110F9}, {0x11136, 0x1113F}, {0x111D0, 0x111D9},
+    {0x111E1, 0x111F4}, {0x112F0, 0x112F9}, {0x11450, 0x11459}, {0x114D0, 0x114D9},
+    {0x11650, 0x11659}, {0x116C0, 0x116C9}, {0x11730, 0x1173B}, {0x118E0, 0x118F2},
+    {0x11950, 0x11959}, {0x11C50, 0x11C6C}, {0x11D50, 0x11D59}, {0x11DA0, 0x11DA9},
+    {0x11FC0, 0x11FD4}, {0x12400, 0x1246E}, {0x16A60, 0x16A69}, {0x16AC0, 0x16AC9},
+    {0x16B50, 0x16B59}, {0x16B5B, 0x16B61}, {0x16E80, 0x16E96}, {0x1D2E0, 0x1D2F3},
+    {0x1D360, 0x1D378}, {0x1D7CE, 0x1D7FF}, {0x1E140, 0x1E149}, {0x1E2F0, 0x1E2F9},
+    {0x1E8C7, 0x1E8CF}, {0x1E950, 0x1E959}, {0x1EC71, 0x1ECAB}, {0x1ECAD, 0x1ECAF},
+    {0x1ECB1, 0x1ECB4}, {0x1ED01, 0x1ED2D}, {0x1ED2F, 0x1ED3D}, {0x1F100, 0x1F10C},
+    {0x1FBF0, 0x1FBF9},
+};
+
+static const uint32_t uc_space_ranges[][2] __attribute__((unused)) = {
+    {0x00085, 0x00085}, {0x000A0, 0x000A0}, {0x01680, 0x01680}, {0x02000, 0x0200A},
+    {0x02028, 0x02029}, {0x0202F, 0x0202F}, {0x0205F, 0x0205F}, {0x03000, 0x03000},
+};
+
+static const uint32_t uc_punct_ranges[][2] __attribute__((unused)) = {
+    {0x000A1, 0x000A1}, {0x000A7, 0x000A7}, {0x000AB, 0x000AB}, {0x000B6, 0x000B7},
+    {0x000BB, 0x000BB}, {0x000BF, 0x000BF}, {0x0037E, 0x0037E}, {0x00387, 0x00387},
+    {0x0055A, 0x0055F}, {0x00589, 0x0058A}, {0x005BE, 0x005BE}, {0x005C0, 0x005C0},
+    {0x005C3, 0x005C3}, {0x005C6, 0x005C6}, {0x005F3, 0x005F4}, {0x00609, 0x0060A},
+    {0x0060C, 0x0060D}, {0x0061B, 0x0061B}, {0x0061D, 0x0061F}, {0x0066A, 0x0066D},
+    {0x006D4, 0x006D4}, {0x00700, 0x0070D}, {0x007F7, 0x007F9}, {0x00830, 0x0083E},
+    {0x0085E, 0x0085E}, {0x00964, 0x00965}, {0x00970, 0x00970}, {0x009FD, 0x009FD},
+    {0x00A76, 0x00A76}, {0x00AF0, 0x00AF0}, {0x00C77, 0x00C77}, {0x00C84, 0x00C84},
+    {0x00DF4, 0x00DF4}, {0x00E4F, 0x00E4F}, {0x00E5A, 0x00E5B}, {0x00F04, 0x00F12},
+    {0x00F14, 0x00F14}, {0x00F3A, 0x00F3D}, {0x00F85, 0x00F85}, {0x00FD0, 0x00FD4},
+    {0x00FD9, 0x00FDA}, {0x0104A, 0x0104F}, {0x010FB, 0x010FB}, {0x01360, 0x01368},
+    {0x01400, 0x01400}, {0x0166E, 0x0166E}, {0x0169B, 0x0169C}, {0x016EB, 0x016ED},
+    {0x01735, 0x01736}, {0x017D4, 0x017D6}, {0x017D8, 0x017DA}, {0x01800, 0x0180A},
+    {0x01944, 0x01945}, {0x01A1E, 0x01A1F}, {0x01AA0, 0x01AA6}, {0x01AA8, 0x01AAD},
+    {0x01B5A, 0x01B60}, {0x01B7D, 0x01B7E}, {0x01BFC, 0x01BFF}, {0x01C3B, 0x01C3F},
+    {0x01C7E, 0x01C7F}, {0x01CC0, 0x01CC7}, {0x01CD3, 0x01CD3}, {0x02010, 0x02027},
+    {0x02030, 0x02043}, {0x02045, 0x02051}, {0x02053, 0x0205E}, {0x0207D, 0x0207E},
+    {0x0208D, 0x0208E}, {0x02308, 0x0230B}, {0x02329, 0x0232A}, {0x02768, 0x02775},
+    {0x027C5, 0x027C6}, {0x027E6, 0x027EF}, {0x02983, 0x02998}, {0x029D8, 0x029DB},
+    {0x029FC, 0x029FD}, {0x02CF9, 0x02CFC}, {0x02CFE, 0x02CFF}, {0x02D70, 0x02D70},
+    {0x02E00, 0x02E2E}, {0x02E30, 0x02E4F}, {0x02E52, 0x02E5D}, {0x03001, 0x03003},
+    {0x03008, 0x03011}, {0x03014, 0x0301F}, {0x03030, 0x03030}, {0x0303D, 0x0303D},
+    {0x030A0, 0x030A0}, {0x030FB, 0x030FB}, {0x0A4FE, 0x0A4FF}, {0x0A60D, 0x0A60F},
+    {0x0A673, 0x0A673}, {0x0A67E, 0x0A67E}, {0x0A6F2, 0x0A6F7}, {0x0A874, 0x0A877},
+    {0x0A8CE, 0x0A8CF}, {0x0A8F8, 0x0A8FA}, {0x0A8FC, 0x0A8FC}, {0x0A92E, 0x0A92F},
+    {0x0A95F, 0x0A95F}, {0x0A9C1, 0x0A9CD}, {0x0A9DE, 0x0A9DF}, {0x0AA5C, 0x0AA5F},
+    {0x0AADE, 0x0AADF}, {0x0AAF0, 0x0AAF1}, {0x0ABEB, 0x0ABEB}, {0x0FD3E, 0x0FD3F},
+    {0x0FE10, 0x0FE19}, {0x0FE30, 0x0FE52}, {0x0FE54, 0x0FE61}, {0x0FE63, 0x0FE63},
+    {0x0FE68, 0x0FE68}, {0x0FE6A, 0x0FE6B}, {0x0FF01, 0x0FF03}, {0x0FF05, 0x0FF0A},
+    {0x0FF0C, 0x0FF0F}, {0x0FF1A, 0x0FF1B}, {0x0FF1F, 0x0FF20}, {0x0FF3B, 0x0FF3D},
+    {0x0FF3F, 0x0FF3F}, {0x0FF5B, 0x0FF5B}, {0x0FF5D, 0x0FF5D}, {0x0FF5F, 0x0FF65},
+    {0x10100, 0x10102}, {0x1039F, 0x1039F}, {0x103D0, 0x103D0}, {0x1056F, 0x1056F},
+    {0x10857, 0x10857}, {0x1091F, 0x1091F}, {0x1093F, 0x1093F}, {0x10A50, 0x10A58},
+    {0x10A7F, 0x10A7F}, {0x10AF0, 0x10AF6}, {0x10B39, 0x10B3F}, {0x10B99, 0x10B9C},
+    {0x10EAD, 0x10EAD}, {0x10F55, 0x10F59}, {0x10F86, 0x10F89}, {0x11047, 0x1104D},
+    {0x110BB, 0x110BC}, {0x110BE, 0x110C1}, {0x11140, 0x11143}, {0x11174, 0x11175},
+    {0x111C5, 0x111C8}, {0x111CD, 0x111CD}, {0x111DB, 0x111DB}, {0x111DD, 0x111DF},
+    {0x11238, 0x1123D}, {0x112A9, 0x112A9}, {0x1144B, 0x1144F}, {0x1145A, 0x1145B},
+    {0x1145D, 0x1145D}, {0x114C6, 0x114C6}, {0x115C1, 0x115D7}, {0x11641, 0x11643},
+    {0x11660, 0x1166C}, {0x116B9, 0x116B9}, {0x1173C, 0x1173E}, {0x1183B, 0x1183B},
+    {0x11944, 0x11946}, {0x119E2, 0x119E2}, {0x11A3F, 0x11A46}, {0x11A9A, 0x11A9C},
+    {0x11A9E, 0x11AA2}, {0x11C41, 0x11C45}, {0x11C70, 0x11C71}, {0x11EF7, 0x11EF8},
+    {0x11FFF, 0x11FFF}, {0x12470, 0x12474}, {0x12FF1, 0x12FF2}, {0x16A6E, 0x16A6F},
+    {0x16AF5, 0x16AF5}, {0x16B37, 0x16B3B}, {0x16B44, 0x16B44}, {0x16E97, 0x16E9A},
+    {0x16FE2, 0x16FE2}, {0x1BC9F, 0x1BC9F}, {0x1DA87, 0x1DA8B}, {0x1E95E, 0x1E95F},
+};
+
+static const uint32_t uc_control_ranges[][2] __attribute__((unused)) = {
+    {0x00000, 0x00008}, {0x0000B, 0x0000C}, {0x0000E, 0x0001F}, {0x0007F, 0x0009F},
+    {0x000AD, 0x000AD}, {0x00378, 0x00379}, {0x00380, 0x00383}, {0x0038B, 0x0038B},
+    {0x0038D, 0x0038D}, {0x003A2, 0x003A2}, {0x00530, 0x00530}, {0x00557, 0x00558},
+    {0x0058B, 0x0058C}, {0x00590, 0x00590}, {0x005C8, 0x005CF}, {0x005EB, 0x005EE},
+    {0x005F5, 0x00605}, {0x0061C, 0x0061C}, {0x006DD, 0x006DD}, {0x0070E, 0x0070F},
+    {0x0074B, 0x0074C}, {0x007B2, 0x007BF}, {0x007FB, 0x007FC}, {0x0082E, 0x0082F},
+    {0x0083F, 0x0083F}, {0x0085C, 0x0085D}, {0x0085F, 0x0085F}, {0x0086B, 0x0086F},
+    {0x0088F, 0x00897}, {0x008E2, 0x008E2}, {0x00984, 0x00984}, {0x0098D, 0x0098E},
+    {0x00991, 0x00992}, {0x009A9, 0x009A9}, {0x009B1, 0x009B1}, {0x009B3, 0x009B5},
+    {0x009BA, 0x009BB}, {0x009C5, 0x009C6}, {0x009C9, 0x009CA}, {0x009CF, 0x009D6},
+    {0x009D8, 0x009DB}, {0x009DE, 0x009DE}, {0x009E4, 0x009E5}, {0x009FF, 0x00A00},
+    {0x00A04, 0x00A04}, {0x00A0B, 0x00A0E}, {0x00A11, 0x00A12}, {0x00A29, 0x00A29},
+    {0x00A31, 0x00A31}, {0x00A34, 0x00A34}, {0x00A37, 0x00A37}, {0x00A3A, 0x00A3B},
+    {0x00A3D, 0x00A3D}, {0x00A43, 0x00A46}, {0x00A49, 0x00A4A}, {0x00A4E, 0x00A50},
+    {0x00A52, 0x00A58}, {0x00A5D, 0x00A5D}, {0x00A5F, 0x00A65}, {0x00A77, 0x00A80},
+    {0x00A84, 0x00A84}, {0x00A8E, 0x00A8E}, {0x00A92, 0x00A92}, {0x00AA9, 0x00AA9},
+    {0x00AB1, 0x00AB1}, {0x00AB4, 0x00AB4}, {0x00ABA, 0x00ABB}, {0x00AC6, 0x00AC6},
+    {0x00ACA, 0x00ACA}, {0x00ACE, 0x00ACF}, {0x00AD1, 0x00ADF}, {0x00AE4, 0x00AE5},
+    {0x00AF2, 0x00AF8}, {0x00B00, 0x00B00}, {0x00B04, 0x00B04}, {0x00B0D, 0x00B0E},
+    {0x00B11, 0x00B12}, {0x00B29, 0x00B29}, {0x00B31, 0x00B31}, {0x00B34, 0x00B34},
+    {0x00B3A, 0x00B3B}, {0x00B45, 0x00B46}, {0x00B49, 0x00B4A}, {0x00B4E, 0x00B54},
+    {0x00B58, 0x00B5B}, {0x00B5E, 0x00B5E}, {0x00B64, 0x00B65}, {0x00B78, 0x00B81},
+    {0x00B84, 0x00B84}, {0x00B8B, 0x00B8D}, {0x00B91, 0x00B91}, {0x00B96, 0x00B98},
+    {0x00B9B, 0x00B9B}, {0x00B9D, 0x00B9D}, {0x00BA0, 0x00BA2}, {0x00BA5, 0x00BA7},
+    {0x00BAB, 0x00BAD}, {0x00BBA, 0x00BBD}, {0x00BC3, 0x00BC5}, {0x00BC9, 0x00BC9},
+    {0x00BCE, 0x00BCF}, {0x00BD1, 0x00BD6}, {0x00BD8, 0x00BE5}, {0x00BFB, 0x00BFF},
+    {0x00C0D, 0x00C0D}, {0x00C11, 0x00C11}, {0x00C29, 0x00C29}, {0x00C3A, 0x00C3B},
+    {0x00C45, 0x00C45}, {0x00C49, 0x00C49}, {0x00C4E, 0x00C54}, {0x00C57, 0x00C57},
+    {0x00C5B, 0x00C5C}, {0x00C5E, 0x00C5F}, {0x00C64, 0x00C65}, {0x00C70, 0x00C76},
+    {0x00C8D, 0x00C8D}, {0x00C91, 0x00C91}, {0x00CA9, 0x00CA9}, {0x00CB4, 0x00CB4},
+    {0x00CBA, 0x00CBB}, {0x00CC5, 0x00CC5}, {0x00CC9, 0x00CC9}, {0x00CCE, 0x00CD4},
+    {0x00CD7, 0x00CDC}, {0x00CDF, 0x00CDF}, {0x00CE4, 0x00CE5}, {0x00CF0, 0x00CF0},
+    {0x00CF3, 0x00CFF}, {0x00D0D, 0x00D0D}, {0x00D11, 0x00D11}, {0x00D45, 0x00D45},
+    {0x00D49, 0x00D49}, {0x00D50, 0x00D53}, {0x00D64, 0x00D65}, {0x00D80, 0x00D80},
+    {0x00D84, 0x00D84}, {0x00D97, 0x00D99}, {0x00DB2, 0x00DB2}, {0x00DBC, 0x00DBC},
+    {0x00DBE, 0x00DBF}, {0x00DC7, 0x00DC9}, {0x00DCB, 0x00DCE}, {0x00DD5, 0x00DD5},
+    {0x00DD7, 0x00DD7}, {0x00DE0, 0x00DE5}, {0x00DF0, 0x00DF1}, {0x00DF5, 0x00E00},
+    {0x00E3B, 0x00E3E}, {0x00E5C, 0x00E80}, {0x00E83, 0x00E83}, {0x00E85, 0x00E85},
+    {0x00E8B, 0x00E8B}, {0x00EA4, 0x00EA4}, {0x00EA6, 0x00EA6}, {0x00EBE, 0x00EBF},
+    {0x00EC5, 0x00EC5}, {0x00EC7, 0x00EC7}, {0x00ECE, 0x00ECF}, {0x00EDA, 0x00EDB},
+    {0x00EE0, 0x00EFF}, {0x00F48, 0x00F48}, {0x00F6D, 0x00F70}, {0x00F98, 0x00F98},
+    {0x00FBD, 0x00FBD}, {0x00FCD, 0x00FCD}, {0x00FDB, 0x00FFF}, {0x010C6, 0x010C6},
+    {0x010C8, 0x010CC}, {0x010CE, 0x010CF}, {0x01249, 0x01249}, {0x0124E, 0x0124F},
+    {0x01257, 0x01257}, {0x01259, 0x01259}, {0x0125E, 0x0125F}, {0x01289, 0x01289},
+    {0x0128E, 0x0128F}, {0x012B1, 0x012B1}, {0x012B6, 0x012B7}, {0x012BF, 0x012BF},
+    {0x012C1, 0x012C1}, {0x012C6, 0x012C7}, {0x012D7, 0x012D7}, {0x01311, 0x01311},
+    {0x01316, 0x01317}, {0x0135B, 0x0135C}, {0x0137D, 0x0137F}, {0x0139A, 0x0139F},
+    {0x013F6, 0x013F7}, {0x013FE, 0x013FF}, {0x0169D, 0x0169F}, {0x016F9, 0x016FF},
+    {0x01716, 0x0171E}, {0x01737, 0x0173F}, {0x01754, 0x0175F}, {0x0176D, 0x0176D},
+    {0x01771, 0x01771}, {0x01774, 0x0177F}, {0x017DE, 0x017DF}, {0x017EA, 0x017EF},
+    {0x017FA, 0x017FF}, {0x0180E, 0x0180E}, {0x0181A, 0x0181F}, {0x01879, 0x0187F},
+    {0x018AB, 0x018AF}, {0x018F6, 0x018FF}, {0x0191F, 0x0191F}, {0x0192C, 0x0192F},
+    {0x0193C, 0x0193F}, {0x01941, 0x01943}, {0x0196E, 0x0196F}, {0x01975, 0x0197F},
+    {0x019AC, 0x019AF}, {0x019CA, 0x019CF}, {0x019DB, 0x019DD}, {0x01A1C, 0x01A1D},
+    {0x01A5F, 0x01A5F}, {0x01A7D, 0x01A7E}, {0x01A8A, 0x01A8F}, {0x01A9A, 0x01A9F},
+    {0x01AAE, 0x01AAF}, {0x01ACF, 0x01AFF}, {0x01B4D, 0x01B4F}, {0x01B7F, 0x01B7F},
+    {0x01BF4, 0x01BFB}, {0x01C38, 0x01C3A}, {0x01C4A, 0x01C4C}, {0x01C89, 0x01C8F},
+    {0x01CBB, 0x01CBC}, {0x01CC8, 0x01CCF}, {0x01CFB, 0x01CFF}, {0x01F16, 0x01F17},
+    {0x01F1E, 0x01F1F}, {0x01F46, 0x01F47}, {0x01F4E, 0x01F4F}, {0x01F58, 0x01F58},
+    {0x01F5A, 0x01F5A}, {0x01F5C, 0x01F5C}, {0x01F5E, 0x01F5E}, {0x01F7E, 0x01F7F},
+    {0x01FB5, 0x01FB5}, {0x01FC5, 0x01FC5}, {0x01FD4, 0x01FD5}, {0x01FDC, 0x01FDC},
+    {0x01FF0, 0x01FF1}, {0x01FF5, 0x01FF5}, {0x01FFF, 0x01FFF}, {0x0200B, 0x0200F},
+    {0x0202A, 0x0202E}, {0x02060, 0x0206F}, {0x02072, 0x02073}, {0x0208F, 0x0208F},
+    {0x0209D, 0x0209F}, {0x020C1, 0x020CF}, {0x020F1, 0x020FF}, {0x0218C, 0x0218F},
+    {0x02427, 0x0243F}, {0x0244B, 0x0245F}, {0x02B74, 0x02B75}, {0x02B96, 0x02B96},
+    {0x02CF4, 0x02CF8}, {0x02D26, 0x02D26}, {0x02D28, 0x02D2C}, {0x02D2E, 0x02D2F},
+    {0x02D68, 0x02D6E}, {0x02D71, 0x02D7E}, {0x02D97, 0x02D9F}, {0x02DA7, 0x02DA7},
+    {0x02DAF, 0x02DAF}, {0x02DB7, 0x02DB7}, {0x02DBF, 0x02DBF}, {0x02DC7, 0x02DC7},
+    {0x02DCF, 0x02DCF}, {0x02DD7, 0x02DD7}, {0x02DDF, 0x02DDF}, {0x02E5E, 0x02E7F},
+    {0x02E9A, 0x02E9A}, {0x02EF4, 0x02EFF}, {0x02FD6, 0x02FEF}, {0x02FFC, 0x02FFF},
+    {0x03040, 0x03040}, {0x03097, 0x03098}, {0x03100, 0x03104}, {0x03130, 0x03130},
+    {0x0318F, 0x0318F}, {0x031E4, 0x031EF}, {0x0321F, 0x0321F}, {0x0A48D, 0x0A48F},
+    {0x0A4C7, 0x0A4CF}, {0x0A62C, 0x0A63F}, {0x0A6F8, 0x0A6FF}, {0x0A7CB, 0x0A7CF},
+    {0x0A7D2, 0x0A7D2}, {0x0A7D4, 0x0A7D4}, {0x0A7DA, 0x0A7F1}, {0x0A82D, 0x0A82F},
+    {0x0A83A, 0x0A83F}, {0x0A878, 0x0A87F}, {0x0A8C6, 0x0A8CD}, {0x0A8DA, 0x0A8DF},
+    {0x0A954, 0x0A95E}, {0x0A97D, 0x0A97F}, {0x0A9CE, 0x0A9CE}, {0x0A9DA, 0x0A9DD},
+    {0x0A9FF, 0x0A9FF}, {0x0AA37, 0x0AA3F}, {0x0AA4E, 0x0AA4F}, {0x0AA5A, 0x0AA5B},
+    {0x0AAC3, 0x0AADA}, {0x0AAF7, 0x0AB00}, {0x0AB07, 0x0AB08}, {0x0AB0F, 0x0AB10},
+    {0x0AB17, 0x0AB1F}, {0x0AB27, 0x0AB27}, {0x0AB2F, 0x0AB2F}, {0x0AB6C, 0x0AB6F},
+    {0x0ABEE, 0x0ABEF}, {0x0ABFA, 0x0ABFF}, {0x0D7A4, 0x0D7AF}, {0x0D7C7, 0x0D7CA},
+    {0x0D7FC, 0x0F8FF}, {0x0FA6E, 0x0FA6F}, {0x0FADA, 0x0FAFF}, {0x0FB07, 0x0FB12},
+    {0x0FB18, 0x0FB1C}, {0x0FB37, 0x0FB37}, {0x0FB3D, 0x0FB3D}, {0x0FB3F, 0x0FB3F},
+    {0x0FB42, 0x0FB42}, {0x0FB45, 0x0FB45}, {0x0FBC3, 0x0FBD2}, {0x0FD90, 0x0FD91},
+    {0x0FDC8, 0x0FDCE}, {0x0FDD0, 0x0FDEF}, {0x0FE1A, 0x0FE1F}, {0x0FE53, 0x0FE53},
+    {0x0FE67, 0x0FE67}, {0x0FE6C, 0x0FE6F}, {0x0FE75, 0x0FE75}, {0x0FEFD, 0x0FF00},
+    {0x0FFBF, 0x0FFC1}, {0x0FFC8, 0x0FFC9}, {0x0FFD0, 0x0FFD1}, {0x0FFD8, 0x0FFD9},
+    {0x0FFDD, 0x0FFDF}, {0x0FFE7, 0x0FFE7}, {0x0FFEF, 0x0FFFB}, {0x0FFFE, 0x0FFFF},
+    {0x1000C, 0x1000C}, {0x10027, 0x10027}, {0x1003B, 0x1003B}, {0x1003E, 0x1003E},
+    {0x1004E, 0x1004F}, {0x1005E, 0x1007F}, {0x100FB, 0x100FF}, {0x10103, 0x10106},
+    {0x10134, 0x10136}, {0x1018F, 0x1018F}, {0x1019D, 0x1019F}, {0x101A1, 0x101CF},
+    {0x101FE, 0x1027F}, {0x1029D, 0x1029F}, {0x102D1, 0x102DF}, {0x102FC, 0x102FF},
+    {0x10324, 0x1032C}, {0x1034B, 0x1034F}, {0x1037B, 0x1037F}, {0x1039E, 0x1039E},
+    {0x103C4, 0x103C7}, {0x103D6, 0x103FF}, {0x1049E, 0x1049F}, {0x104AA, 0x104AF},
+    {0x104D4, 0x104D7}, {0x104FC, 0x104FF}, {0x10528, 0x1052F}, {0x10564, 0x1056E},
+    {0x1057B, 0x1057B}, {0x1058B, 0x1058B}, {0x10593, 0x10593}, {0x10596, 0x10596},
+    {0x105A2, 0x105A2}, {0x105B2, 0x105B2}, {0x105BA, 0x105BA}, {0x105BD, 0x105FF},
+    {0x10737, 0x1073F}, {0x10756, 0x1075F}, {0x10768, 0x1077F}, {0x10786, 0x10786},
+    {0x107B1, 0x107B1}, {0x107BB, 0x107FF}, {0x10806, 0x10807}, {0x10809, 0x10809},
+    {0x10836, 0x10836}, {0x10839, 0x1083B}, {0x1083D, 0x1083E}, {0x10856, 0x10856},
+    {0x1089F, 0x108A6}, {0x108B0, 0x108DF}, {0x108F3, 0x108F3}, {0x108F6, 0x108FA},
+    {0x1091C, 0x1091E}, {0x1093A, 0x1093E}, {0x10940, 0x1097F}, {0x109B8, 0x109BB},
+    {0x109D0, 0x109D1}, {0x10A04, 0x10A04}, {0x10A07, 0x10A0B}, {0x10A14, 0x10A14},
+    {0x10A18, 0x10A18}, {0x10A36, 0x10A37}, {0x10A3B, 0x10A3E}, {0x10A49, 0x10A4F},
+    {0x10A59, 0x10A5F}, {0x10AA0, 0x10ABF}, {0x10AE7, 0x10AEA}, {0x10AF7, 0x10AFF},
+    {0x10B36, 0x10B38}, {0x10B56, 0x10B57}, {0x10B73, 0x10B77}, {0x10B92, 0x10B98},
+    {0x10B9D, 0x10BA8}, {0x10BB0, 0x10BFF}, {0x10C49, 0x10C7F}, {0x10CB3, 0x10CBF},
+    {0x10CF3, 0x10CF9}, {0x10D28, 0x10D2F}, {0x10D3A, 0x10E5F}, {0x10E7F, 0x10E7F},
+    {0x10EAA, 0x10EAA}, {0x10EAE, 0x10EAF}, {0x10EB2, 0x10EFF}, {0x10F28, 0x10F2F},
+    {0x10F5A, 0x10F6F}, {0x10F8A, 0x10FAF}, {0x10FCC, 0x10FDF}, {0x10FF7, 0x10FFF},
+    {0x1104E, 0x11051}, {0x11076, 0x1107E}, {0x110BD, 0x110BD}, {0x110C3, 0x110CF},
+    {0x110E9, 0x110EF}, {0x110FA, 0x110FF}, {0x11135, 0x11135}, {0x11148, 0x1114F},
+    {0x11177, 0x1117F}, {0x111E0, 0x111E0}, {0x111F5, 0x111FF}, {0x11212, 0x11212},
+    {0x1123F, 0x1127F}, {0x11287, 0x11287}, {0x11289, 0x11289}, {0x1128E, 0x1128E},
+    {0x1129E, 0x1129E}, {0x112AA, 0x112AF}, {0x112EB, 0x112EF}, {0x112FA, 0x112FF},
+    {0x11304, 0x11304}, {0x1130D, 0x1130E}, {0x11311, 0x11312}, {0x11329, 0x11329},
+    {0x11331, 0x11331}, {0x11334, 0x11334}, {0x1133A, 0x1133A}, {0x11345, 0x11346},
+    {0x11349, 0x1134A}, {0x1134E, 0x1134F}, {0x11351, 0x11356}, {0x11358, 0x1135C},
+    {0x11364, 0x11365}, {0x1136D, 0x1136F}, {0x11375, 0x113FF}, {0x1145C, 0x1145C},
+    {0x11462, 0x1147F}, {0x114C8, 0x114CF}, {0x114DA, 0x1157F}, {0x115B6, 0x115B7},
+    {0x115DE, 0x115FF}, {0x11645, 0x1164F}, {0x1165A, 0x1165F}, {0x1166D, 0x1167F},
+    {0x116BA, 0x116BF}, {0x116CA, 0x116FF}, {0x1171B, 0x1171C}, {0x1172C, 0x1172F},
+    {0x11747, 0x117FF}, {0x1183C, 0x1189F}, {0x118F3, 0x118FE}, {0x11907, 0x11908},
+    {0x1190A, 0x1190B}, {0x11914, 0x11914}, {0x11917, 0x11917}, {0x11936, 0x11936},
+    {0x11939, 0x1193A}, {0x11947, 0x1194F}, {0x1195A, 0x1199F}, {0x119A8, 0x119A9},
+    {0x119D8, 0x119D9}, {0x119E5, 0x119FF}, {0x11A48, 0x11A4F}, {0x11AA3, 0x11AAF},
+    {0x11AF9, 0x11BFF}, {0x11C09, 0x11C09}, {0x11C37, 0x11C37}, {0x11C46, 0x11C4F},
+    {0x11C6D, 0x11C6F}, {0x11C90, 0x11C91}, {0x11CA8, 0x11CA8}, {0x11CB7, 0x11CFF},
+    {0x11D07, 0x11D07}, {0x11D0A, 0x11D0A}, {0x11D37, 0x11D39}, {0x11D3B, 0x11D3B},
+    {0x11D3E, 0x11D3E}, {0x11D48, 0x11D4F}, {0x11D5A, 0x11D5F}, {0x11D66, 0x11D66},
+    {0x11D69, 0x11D69}, {0x11D8F, 0x11D8F}, {0x11D92, 0x11D92}, {0x11D99, 0x11D9F},
+    {0x11DAA, 0x11EDF}, {0x11EF9, 0x11FAF}, {0x11FB1, 0x11FBF}, {0x11FF2, 0x11FFE},
+    {0x1239A, 0x123FF}, {0x1246F, 0x1246F}, {0x12475, 0x1247F}, {0x12544, 0x12F8F},
+    {0x12FF3, 0x12FFF}, {0x1342F, 0x143FF}, {0x14647, 0x167FF}, {0x16A39, 0x16A3F},
+    {0x16A5F, 0x16A5F}, {0x16A6A, 0x16A6D}, {0x16ABF, 0x16ABF}, {0x16ACA, 0x16ACF},
+    {0x16AEE, 0x16AEF}, {0x16AF6, 0x16AFF}, {0x16B46, 0x16B4F}, {0x16B5A, 0x16B5A},
+    {0x16B62, 0x16B62}, {0x16B78, 0x16B7C}, {0x16B90, 0x16E3F}, {0x16E9B, 0x16EFF},
+    {0x16F4B, 0x16F4E}, {0x16F88, 0x16F8E}, {0x16FA0, 0x16FDF}, {0x16FE5, 0x16FEF},
+    {0x16FF2, 0x16FFF}, {0x187F8, 0x187FF}, {0x18CD6, 0x18CFF}, {0x18D09, 0x1AFEF},
+    {0x1AFF4, 0x1AFF4}, {0x1AFFC, 0x1AFFC}, {0x1AFFF, 0x1AFFF}, {0x1B123, 0x1B14F},
+    {0x1B153, 0x1B163}, {0x1B168, 0x1B16F}, {0x1B2FC, 0x1BBFF}, {0x1BC6B, 0x1BC6F},
+    {0x1BC7D, 0x1BC7F}, {0x1BC89, 0x1BC8F}, {0x1BC9A, 0x1BC9B}, {0x1BCA0, 0x1CEFF},
+    {0x1CF2E, 0x1CF2F}, {0x1CF47, 0x1CF4F}, {0x1CFC4, 0x1CFFF}, {0x1D0F6, 0x1D0FF},
+    {0x1D127, 0x1D128}, {0x1D173, 0x1D17A}, {0x1D1EB, 0x1D1FF}, {0x1D246, 0x1D2DF},
+    {0x1D2F4, 0x1D2FF}, {0x1D357, 0x1D35F}, {0x1D379, 0x1D3FF}, {0x1D455, 0x1D455},
+    {0x1D49D, 0x1D49D}, {0x1D4A0, 0x1D4A1}, {0x1D4A3, 0x1D4A4}, {0x1D4A7, 0x1D4A8},
+    {0x1D4AD, 0x1D4AD}, {0x1D4BA, 0x1D4BA}, {0x1D4BC, 0x1D4BC}, {0x1D4C4, 0x1D4C4},
+    {0x1D506, 0x1D506}, {0x1D50B, 0x1D50C}, {0x1D515, 0x1D515}, {0x1D51D, 0x1D51D},
+    {0x1D53A, 0x1D53A}, {0x1D53F, 0x1D53F}, {0x1D545, 0x1D545}, {0x1D547, 0x1D549},
+    {0x1D551, 0x1D551}, {0x1D6A6, 0x1D6A7}, {0x1D7CC, 0x1D7CD}, {0x1DA8C, 0x1DA9A},
+    {0x1DAA0, 0x1DAA0}, {0x1DAB0, 0x1DEFF}, {0x1DF1F, 0x1DFFF}, {0x1E007, 0x1E007},
+    {0x1E019, 0x1E01A}, {0x1E022, 0x1E022}, {0x1E025, 0x1E025}, {0x1E02B, 0x1E0FF},
+    {0x1E12D, 0x1E12F}, {0x1E13E, 0x1E13F}, {0x1E14A, 0x1E14D}, {0x1E150, 0x1E28F},
+    {0x1E2AF, 0x1E2BF}, {0x1E2FA, 0x1E2FE}, {0x1E300, 0x1E7DF}, {0x1E7E7, 0x1E7E7},
+    {0x1E7EC, 0x1E7EC}, {0x1E7EF, 0x1E7EF}, {0x1E7FF, 0x1E7FF}, {0x1E8C5, 0x1E8C6},
+    {0x1E8D7, 0x1E8FF}, {0x1E94C, 0x1E94F}, {0x1E95A, 0x1E95D}, {0x1E960, 0x1EC70},
+    {0x1ECB5, 0x1ED00}, {0x1ED3E, 0x1EDFF}, {0x1EE04, 0x1EE04}, {0x1EE20, 0x1EE20},
+    {0x1EE23, 0x1EE23}, {0x1EE25, 0x1EE26}, {0x1EE28, 0x1EE28}, {0x1EE33, 0x1EE33},
+    {0x1EE38, 0x1EE38}, {0x1EE3A, 0x1EE3A}, {0x1EE3C, 0x1EE41}, {0x1EE43, 0x1EE46},
+    {0x1EE48, 0x1EE48}, {0x1EE4A, 0x1EE4A}, {0x1EE4C, 0x1EE4C}, {0x1EE50, 0x1EE50},
+    {0x1EE53, 0x1EE53}, {0x1EE55, 0x1EE56}, {0x1EE58, 0x1EE58}, {0x1EE5A, 0x1EE5A},
+    {0x1EE5C, 0x1EE5C}, {0x1EE5E, 0x1EE5E}, {0x1EE60, 0x1EE60}, {0x1EE63, 0x1EE63},
+    {0x1EE65, 0x1EE66}, {0x1EE6B, 0x1EE6B}, {0x1EE73, 0x1EE73}, {0x1EE78, 0x1EE78},
+    {0x1EE7D, 0x1EE7D}, {0x1EE7F, 0x1EE7F}, {0x1EE8A, 0x1EE8A}, {0x1EE9C, 0x1EEA0},
+    {0x1EEA4, 0x1EEA4}, {0x1EEAA, 0x1EEAA}, {0x1EEBC, 0x1EEEF}, {0x1EEF2, 0x1EFFF},
+    {0x1F02C, 0x1F02F}, {0x1F094, 0x1F09F}, {0x1F0AF, 0x1F0B0}, {0x1F0C0, 0x1F0C0},
+    {0x1F0D0, 0x1F0D0}, {0x1F0F6, 0x1F0FF}, {0x1F1AE, 0x1F1E5}, {0x1F203, 0x1F20F},
+    {0x1F23C, 0x1F23F}, {0x1F249, 0x1F24F}, {0x1F252, 0x1F25F}, {0x1F266, 0x1F2FF},
+    {0x1F6D8, 0x1F6DC}, {0x1F6ED, 0x1F6EF}, {0x1F6FD, 0x1F6FF}, {0x1F774, 0x1F77F},
+    {0x1F7D9, 0x1F7DF}, {0x1F7EC, 0x1F7EF}, {0x1F7F1, 0x1F7FF}, {0x1F80C, 0x1F80F},
+    {0x1F848, 0x1F84F}, {0x1F85A, 0x1F85F}, {0x1F888, 0x1F88F}, {0x1F8AE, 0x1F8AF},
+    {0x1F8B2, 0x1F8FF}, {0x1FA54, 0x1FA5F}, {0x1FA6E, 0x1FA6F}, {0x1FA75, 0x1FA77},
+    {0x1FA7D, 0x1FA7F}, {0x1FA87, 0x1FA8F}, {0x1FAAD, 0x1FAAF}, {0x1FABB, 0x1FABF},
+    {0x1FAC6, 0x1FACF}, {0x1FADA, 0x1FADF}, {0x1FAE8, 0x1FAEF}, {0x1FAF7, 0x1FAFF},
+    {0x1FB93, 0x1FB93}, {0x1FBCB, 0x1FBEF}, {0x1FBFA, 0x1FFFF}, {0x2A6E0, 0x2A6FF},
+    {0x2B739, 0x2B73F}, {0x2B81E, 0x2B81F}, {0x2CEA2, 0x2CEAF}, {0x2EBE1, 0x2F7FF},
+    {0x2FA1E, 0x2FFFF}, {0x3134B, 0xE00FF}, {0xE01F0, 0x10FFFF},
+};
+
+#define UC_FOLD_SHIFT 7
+#define UC_FOLD_END 0xE0200
+#define UC_FOLD_MULTI 0x80000000u
+
+// lower() + NFD + drop combining marks, by block of 1 << UC_FOLD_SHIFT code
+// points; 0 means no code point of the block changes
+static const uint8_t uc_fold_index[UC_FOLD_END >> UC_FOLD_SHIFT] __attribute__((unused)) = {
+    1, 2, 3, 4, 5, 0, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23,
+    24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 0, 0, 0, 0, 34, 35, 0, 0, 0, 0, 0, 0, 36, 37,
+    38, 39, 40, 0, 41, 42, 43, 44, 45, 46, 0, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 0,
+    0, 59, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 60, 0, 0, 61, 62, 63, 64, 0, 0, 0, 0,
+    65, 66, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 67, 68, 69, 70,
+    71, 72, 73, 74, 75, 76, 0, 77, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 78, 79, 80, 81, 82, 0,
+    0, 0, 0, 0, 83, 0, 84, 0, 0, 0, 0, 85, 0, 86, 87, 0, 88, 89, 90, 91, 0, 0, 0, 0,
+    0, 0, 0, 0, 92, 93, 0, 0, 0, 94, 95, 0, 0, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 0,
+    106, 107, 0, 108, 109, 110, 111, 0, 112, 113, 114, 115, 116, 117, 0, 0, 118, 119, 120, 121, 0, 122, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 123, 124, 0, 0, 0, 0, 0, 125, 0, 126, 127, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 128, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0, 0, 130, 131, 132, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 133, 134, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    135, 0, 136, 0, 0, 137, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 138, 139, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 140, 141, 142, 143, 144, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 145, 146,
+};
+
+// Row n - 1 is block n: the folded code point, 0 when it is dropped, or
+// UC_FOLD_MULTI | i for the several code points of uc_fold_multi[i]
+static const uint32_t uc_fold_blocks[][1 << UC_FOLD_SHIFT] __attribute__((unused)) = {
+    {
+        0x00000, 0x00001, 0x00002, 0x00003, 0x00004, 0x00005, 0x00006, 0x00007,
+        0x00008, 0x00009, 0x0000A, 0x0000B, 0x0000C, 0x0000D, 0x0000E, 0x0000F,
+        0x00010, 0x00011, 0x00012, 0x00013, 0x00014, 0x00015, 0x00016, 0x00017,
+        0x00018, 0x00019, 0x0001A, 0x0001B, 0x0001C, 0x0001D, 0x0001E, 0x0001F,
+        0x00020, 0x00021, 0x00022, 0x00023, 0x00024, 0x00025, 0x00026, 0x00027,
+        0x00028, 0x00029, 0x0002A, 0x0002B, 0x0002C, 0x0002D, 0x0002E, 0x0002F,
+        0x00030, 0x00031, 0x00032, 0x00033, 0x00034, 0x00035, 0x00036, 0x00037,
+        0x00038, 0x00039, 0x0003A, 0x0003B, 0x0003C, 0x0003D, 0x0003E, 0x0003F,
+        0x00040, 0x00061, 0x00062, 0x00063, 0x00064, 0x00065, 0x00066, 0x00067,
+        0x00068, 0x00069, 0x0006A, 0x0006B, 0x0006C, 0x0006D, 0x0006E, 0x0006F,
+        0x00070, 0x00071, 0x00072, 0x00073, 0x00074, 0x00075, 0x00076, 0x00077,
+        0x00078, 0x00079, 0x0007A, 0x0005B, 0x0005C, 0x0005D, 0x0005E, 0x0005F,
+        0x00060, 0x00061, 0x00062, 0x00063, 0x00064, 0x00065, 0x00066, 0x00067,
+        0x00068, 0x00069, 0x0006A, 0x0006B, 0x0006C, 0x0006D, 0x0006E, 0x0006F,
+        0x00070, 0x00071, 0x00072, 0x00073, 0x00074, 0x00075, 0x00076, 0x00077,
+        0x00078, 0x00079, 0x0007A, 0x0007B, 0x0007C, 0x0007D, 0x0007E, 0x0007F,
+    },
+    {
+        0x00080, 0x00081, 0x00082, 0x00083, 0x00084, 0x00085, 0x00086, 0x00087,
+        0x00088, 0x00089, 0x0008A, 0x0008B, 0x0008C, 0x0008D, 0x0008E, 0x0008F,
+        0x00090, 0x00091, 0x00092, 0x00093, 0x00094, 0x00095, 0x00096, 0x00097,
+        0x00098, 0x00099, 0x0009A, 0x0009B, 0x0009C, 0x0009D, 0x0009E, 0x0009F,
+        0x000A0, 0x000A1, 0x000A2, 0x000A3, 0x000A4, 0x000A5, 0x000A6, 0x000A7,
+        0x000A8, 0x000A9, 0x000AA, 0x000AB, 0x000AC, 0x000AD, 0x000AE, 0x000AF,
+        0x000B0, 0x000B1, 0x000B2, 0x000B3, 0x000B4, 0x000B5, 0x000B6, 0x000B7,
+        0x000B8, 0x000B9, 0x000BA, 0x000BB, 0x000BC, 0x000BD, 0x000BE, 0x000BF,
+        0x00061, 0x00061, 0x00061, 0x00061, 0x00061, 0x00061, 0x000E6, 0x00063,
+        0x00065, 0x00065, 0x00065, 0x00065, 0x00069, 0x00069, 0x00069, 0x00069,
+        0x000F0, 0x0006E, 0x0006F, 0x0006F, 0x0006F, 0x0006F, 0x0006F, 0x000D7,
+        0x000F8, 0x00075, 0x00075, 0x00075, 0x00075, 0x00079, 0x000FE, 0x000DF,
+        0x00061, 0x00061, 0x00061, 0x00061, 0x00061, 0x00061, 0x000E6, 0x00063,
+        0x00065, 0x00065, 0x00065, 0x00065, 0x00069, 0x00069, 0x00069, 0x00069,
+        0x000F0, 0x0006E, 0x0006F, 0x0006F, 0x0006F, 0x0006F, 0x0006F, 0x000F7,
+        0x000F8, 0x00075, 0x00075, 0x00075, 0x00075, 0x00079, 0x000FE, 0x00079,
+    },
+    {
+        0x00061, 0x00061, 0x00061, 0x00061, 0x00061, 0x00061, 0x00063, 0x00063,
+        0x00063, 0x00063, 0x00063, 0x00063, 0x00063, 0x00063, 0x00064, 0x00064,
+        0x00111, 0x00111, 0x00065, 0x00065, 0x00065, 0x00065, 0x00065, 0x00065,
+        0x00065, 0x00065, 0x00065, 0x00065, 0x00067, 0x00067, 0x00067, 0x00067,
+        0x00067, 0x00067, 0x00067, 0x00067, 0x00068, 0x00068, 0x00127, 0x00127,
+        0x00069, 0x00069, 0x00069, 0x00069, 0x00069, 0x00069, 0x00069, 0x00069,
+        0x00069, 0x00131, 0x00133, 0x00133, 0x0006A, 0x0006A, 0x0006B, 0x0006B,
+        0x00138, 0x0006C, 0x0006C, 0x0006C, 0x0006C, 0x0006C, 0x0006C, 0x00140,
+        0x00140, 0x00142, 0x00142, 0x0006E, 0x0006E, 0x0006E, 0x0006E, 0x0006E,
+        0x0006E, 0x00149, 0x0014B, 0x0014B, 0x0006F, 0x0006F, 0x0006F, 0x0006F,
+        0x0006F, 0x0006F, 0x00153, 0x00153, 0x00072, 0x00072, 0x00072, 0x00072,
+        0x00072, 0x00072, 0x00073, 0x00073, 0x00073, 0x00073, 0x00073, 0x00073,
+        0x00073, 0x00073, 0x00074, 0x00074, 0x00074, 0x00074, 0x00167, 0x00167,
+        0x00075, 0x00075, 0x00075, 0x00075, 0x00075, 0x00075, 0x00075, 0x00075,
+        0x00075, 0x00075, 0x00075, 0x00075, 0x00077, 0x00077, 0x00079, 0x00079,
+        0x00079, 0x0007A, 0x0007A, 0x0007A, 0x0007A, 0x0007A, 0x0007A, 0x0017F,
+    },
+    {
+        0x00180, 0x00253, 0x00183, 0x00183, 0x00185, 0x00185, 0x00254, 0x00188,
+        0x00188, 0x00256, 0x00257, 0x0018C, 0x0018C, 0x0018D, 0x001DD, 0x00259,
+        0x0025B, 0x00192, 0x00192, 0x00260, 0x00263, 0x00195, 0x00269, 0x00268,
+        0x00199, 0x00199, 0x0019A, 0x0019B, 0x0026F, 0x00272, 0x0019E, 0x00275,
+        0x0006F, 0x0006F, 0x001A3, 0x001A3, 0x001A5, 0x001A5, 0x00280, 0x001A8,
+        0x001A8, 0x00283, 0x001AA, 0x001AB, 0x001AD, 0x001AD, 0x00288, 0x00075,
+        0x00075, 0x0028A, 0x0028B, 0x001B4, 0x001B4, 0x001B6, 0x001B6, 0x00292,
+        0x001B9, 0x001B9, 0x001BA, 0x001BB, 0x001BD, 0x001BD, 0x001BE, 0x001BF,
+        0x001C0, 0x001C1, 0x001C2, 0x001C3, 0x001C6, 0x001C6, 0x001C6, 0x001C9,
+        0x001C9, 0x001C9, 0x001CC, 0x001CC, 0x001CC, 0x00061, 0x00061, 0x00069,
+        0x00069, 0x0006F, 0x0006F, 0x00075, 0x00075, 0x00075, 0x00075, 0x00075,
+        0x00075, 0x00075, 0x00075, 0x00075, 0x00075, 0x001DD, 0x00061, 0x00061,
+        0x00061, 0x00061, 0x000E6, 0x000E6, 0x001E5, 0x001E5, 0x00067, 0x00067,
+        0x0006B, 0x0006B, 0x0006F, 0x0006F, 0x0006F, 0x0006F, 0x00292, 0x00292,
+        0x0006A, 0x001F3, 0x001F3, 0x001F3, 0x00067, 0x00067, 0x00195, 0x001BF,
+        0x0006E, 0x0006E, 0x00061, 0x00061, 0x000E6, 0x000E6, 0x000F8, 0x000F8,
+    },
+    {
+        0x00061, 0x00061, 0x00061, 0x00061, 0x00065, 0x00065, 0x00065, 0x00065,
+        0x00069, 0x00069, 0x00069, 0x00069, 0x0006F, 0x0006F, 0x0006F, 0x0006F,
+        0x00072, 0x00072, 0x00072, 0x00072, 0x00075, 0x00075, 0x00075, 0x00075,
+        0x00073, 0x00073, 0x00074, 0x00074, 0x0021D, 0x0021D, 0x00068, 0x00068,
+        0x0019E, 0x00221, 0x00223, 0x00223, 0x00225, 0x00225, 0x00061, 0x00061,
+        0x00065, 0x00065, 0x0006F, 0x0006F, 0x0006F, 0x0006F, 0x0006F, 0x0006F,
+        0x0006F, 0x0006F, 0x00079, 0x00079, 0x00234, 0x00235, 0x00236, 0x00237,
+        0x00238, 0x00239, 0x02C65, 0x0023C, 0x0023C, 0x0019A, 0x02C66, 0x0023F,
+        0x00240, 0x00242, 0x00242, 0x00180, 0x00289, 0x0028C, 0x00247, 0x00247,
+        0x00249, 0x00249, 0x0024B, 0x0024B, 0x0024D, 0x0024D, 0x0024F, 0x0024F,
+        0x00250, 0x00251, 0x00252, 0x00253, 0x00254, 0x00255, 0x00256, 0x00257,
+        0x00258, 0x00259, 0x0025A, 0x0025B, 0x0025C, 0x0025D, 0x0025E, 0x0025F,
+        0x00260, 0x00261, 0x00262, 0x00263, 0x00264, 0x00265, 0x00266, 0x00267,
+        0x00268, 0x00269, 0x0026A, 0x0026B, 0x0026C, 0x0026D, 0x0026E, 0x0026F,
+        0x00270, 0x00271, 0x00272, 0x00273, 0x00274, 0x00275, 0x00276, 0x00277,
+        0x00278, 0x00279, 0x0027A, 0x0027B, 0x0027C, 0x0027D, 0x0027E, 0x0027F,
+    },
+    {
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00371, 0x00371, 0x00373, 0x00373, 0x002B9, 0x00375, 0x00377, 0x00377,
+        0x00378, 0x00379, 0x0037A, 0x0037B, 0x0037C, 0x0037D, 0x0003B, 0x003F3,
+    },
+    {
+        0x00380, 0x00381, 0x00382, 0x00383, 0x00384, 0x000A8, 0x003B1, 0x000B7,
+        0x003B5, 0x003B7, 0x003B9, 0x0038B, 0x003BF, 0x0038D, 0x003C5, 0x003C9,
+        0x003B9, 0x003B1, 0x003B2, 0x003B3, 0x003B4, 0x003B5, 0x003B6, 0x003B7,
+        0x003B8, 0x003B9, 0x003BA, 0x003BB, 0x003BC, 0x003BD, 0x003BE, 0x003BF,
+        0x003C0, 0x003C1, 0x003A2, 0x003C3, 0x003C4, 0x003C5, 0x003C6, 0x003C7,
+        0x003C8, 0x003C9, 0x003B9, 0x003C5, 0x003B1, 0x003B5, 0x003B7, 0x003B9,
+        0x003C5, 0x003B1, 0x003B2, 0x003B3, 0x003B4, 0x003B5, 0x003B6, 0x003B7,
+        0x003B8, 0x003B9, 0x003BA, 0x003BB, 0x003BC, 0x003BD, 0x003BE, 0x003BF,
+        0x003C0, 0x003C1, 0x003C2, 0x003C3, 0x003C4, 0x003C5, 0x003C6, 0x003C7,
+        0x003C8, 0x003C9, 0x003B9, 0x003C5, 0x003BF, 0x003C5, 0x003C9, 0x003D7,
+        0x003D0, 0x003D1, 0x003D2, 0x003D2, 0x003D2, 0x003D5, 0x003D6, 0x003D7,
+        0x003D9, 0x003D9, 0x003DB, 0x003DB, 0x003DD, 0x003DD, 0x003DF, 0x003DF,
+        0x003E1, 0x003E1, 0x003E3, 0x003E3, 0x003E5, 0x003E5, 0x003E7, 0x003E7,
+        0x003E9, 0x003E9, 0x003EB, 0x003EB, 0x003ED, 0x003ED, 0x003EF, 0x003EF,
+        0x003F0, 0x003F1, 0x003F2, 0x003F3, 0x003B8, 0x003F5, 0x003F6, 0x003F8,
+        0x003F8, 0x003F2, 0x003FB, 0x003FB, 0x003FC, 0x0037B, 0x0037C, 0x0037D,
+    },
+    {
+        0x00435, 0x00435, 0x00452, 0x00433, 0x00454, 0x00455, 0x00456, 0x00456,
+        0x00458, 0x00459, 0x0045A, 0x0045B, 0x0043A, 0x00438, 0x00443, 0x0045F,
+        0x00430, 0x00431, 0x00432, 0x00433, 0x00434, 0x00435, 0x00436, 0x00437,
+        0x00438, 0x00438, 0x0043A, 0x0043B, 0x0043C, 0x0043D, 0x0043E, 0x0043F,
+        0x00440, 0x00441, 0x00442, 0x00443, 0x00444, 0x00445, 0x00446, 0x00447,
+        0x00448, 0x00449, 0x0044A, 0x0044B, 0x0044C, 0x0044D, 0x0044E, 0x0044F,
+        0x00430, 0x00431, 0x00432, 0x00433, 0x00434, 0x00435, 0x00436, 0x00437,
+        0x00438, 0x00438, 0x0043A, 0x0043B, 0x0043C, 0x0043D, 0x0043E, 0x0043F,
+        0x00440, 0x00441, 0x00442, 0x00443, 0x00444, 0x00445, 0x00446, 0x00447,
+        0x00448, 0x00449, 0x0044A, 0x0044B, 0x0044C, 0x0044D, 0x0044E, 0x0044F,
+        0x00435, 0x00435, 0x00452, 0x00433, 0x00454, 0x00455, 0x00456, 0x00456,
+        0x00458, 0x00459, 0x0045A, 0x0045B, 0x0043A, 0x00438, 0x00443, 0x0045F,
+        0x00461, 0x00461, 0x00463, 0x00463, 0x00465, 0x00465, 0x00467, 0x00467,
+        0x00469, 0x00469, 0x0046B, 0x0046B, 0x0046D, 0x0046D, 0x0046F, 0x0046F,
+        0x00471, 0x00471, 0x00473, 0x00473, 0x00475, 0x00475, 0x00475, 0x00475,
+        0x00479, 0x00479, 0x0047B, 0x0047B, 0x0047D, 0x0047D, 0x0047F, 0x0047F,
+    },
+    {
+        0x00481, 0x00481, 0x00482, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00488, 0x00489, 0x0048B, 0x0048B, 0x0048D, 0x0048D, 0x0048F, 0x0048F,
+        0x00491, 0x00491, 0x00493, 0x00493, 0x00495, 0x00495, 0x00497, 0x00497,
+        0x00499, 0x00499, 0x0049B, 0x0049B, 0x0049D, 0x0049D, 0x0049F, 0x0049F,
+        0x004A1, 0x004A1, 0x004A3, 0x004A3, 0x004A5, 0x004A5, 0x004A7, 0x004A7,
+        0x004A9, 0x004A9, 0x004AB, 0x004AB, 0x004AD, 0x004AD, 0x004AF, 0x004AF,
+        0x004B1, 0x004B1, 0x004B3, 0x004B3, 0x004B5, 0x004B5, 0x004B7, 0x004B7,
+        0x004B9, 0x004B9, 0x004BB, 0x004BB, 0x004BD, 0x004BD, 0x004BF, 0x004BF,
+        0x004CF, 0x00436, 0x00436, 0x004C4, 0x004C4, 0x004C6, 0x004C6, 0x004C8,
+        0x004C8, 0x004CA, 0x004CA, 0x004CC, 0x004CC, 0x004CE, 0x004CE, 0x004CF,
+        0x00430, 0x00430, 0x00430, 0x00430, 0x004D5, 0x004D5, 0x00435, 0x00435,
+        0x004D9, 0x004D9, 0x004D9, 0x004D9, 0x00436, 0x00436, 0x00437, 0x00437,
+        0x004E1, 0x004E1, 0x00438, 0x00438, 0x00438, 0x00438, 0x0043E, 0x0043E,
+        0x004E9, 0x004E9, 0x004E9, 0x004E9, 0x0044D, 0x0044D, 0x00443, 0x00443,
+        0x00443, 0x00443, 0x00443, 0x00443, 0x00447, 0x00447, 0x004F7, 0x004F7,
+        0x0044B, 0x0044B, 0x004FB, 0x004FB, 0x004FD, 0x004FD, 0x004FF, 0x004FF,
+    },
+    {
+        0x00501, 0x00501, 0x00503, 0x00503, 0x00505, 0x00505, 0x00507, 0x00507,
+        0x00509, 0x00509, 0x0050B, 0x0050B, 0x0050D, 0x0050D, 0x0050F, 0x0050F,
+        0x00511, 0x00511, 0x00513, 0x00513, 0x00515, 0x00515, 0x00517, 0x00517,
+        0x00519, 0x00519, 0x0051B, 0x0051B, 0x0051D, 0x0051D, 0x0051F, 0x0051F,
+        0x00521, 0x00521, 0x00523, 0x00523, 0x00525, 0x00525, 0x00527, 0x00527,
+        0x00529, 0x00529, 0x0052B, 0x0052B, 0x0052D, 0x0052D, 0x0052F, 0x0052F,
+        0x00530, 0x00561, 0x00562, 0x00563, 0x00564, 0x00565, 0x00566, 0x00567,
+        0x00568, 0x00569, 0x0056A, 0x0056B, 0x0056C, 0x0056D, 0x0056E, 0x0056F,
+        0x00570, 0x00571, 0x00572, 0x00573, 0x00574, 0x00575, 0x00576, 0x00577,
+        0x00578, 0x00579, 0x0057A, 0x0057B, 0x0057C, 0x0057D, 0x0057E, 0x0057F,
+        0x00580, 0x00581, 0x00582, 0x00583, 0x00584, 0x00585, 0x00586, 0x00557,
+        0x00558, 0x00559, 0x0055A, 0x0055B, 0x0055C, 0x0055D, 0x0055E, 0x0055F,
+        0x00560, 0x00561, 0x00562, 0x00563, 0x00564, 0x00565, 0x00566, 0x00567,
+        0x00568, 0x00569, 0x0056A, 0x0056B, 0x0056C, 0x0056D, 0x0056E, 0x0056F,
+        0x00570, 0x00571, 0x00572, 0x00573, 0x00574, 0x00575, 0x00576, 0x00577,
+        0x00578, 0x00579, 0x0057A, 0x0057B, 0x0057C, 0x0057D, 0x0057E, 0x0057F,
+    },
+    {
+        0x00580, 0x00581, 0x00582, 0x00583, 0x00584, 0x00585, 0x00586, 0x00587,
+        0x00588, 0x00589, 0x0058A, 0x0058B, 0x0058C, 0x0058D, 0x0058E, 0x0058F,
+        0x00590, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x005BE, 0x00000,
+        0x005C0, 0x00000, 0x00000, 0x005C3, 0x00000, 0x00000, 0x005C6, 0x00000,
+        0x005C8, 0x005C9, 0x005CA, 0x005CB, 0x005CC, 0x005CD, 0x005CE, 0x005CF,
+        0x005D0, 0x005D1, 0x005D2, 0x005D3, 0x005D4, 0x005D5, 0x005D6, 0x005D7,
+        0x005D8, 0x005D9, 0x005DA, 0x005DB, 0x005DC, 0x005DD, 0x005DE, 0x005DF,
+        0x005E0, 0x005E1, 0x005E2, 0x005E3, 0x005E4, 0x005E5, 0x005E6, 0x005E7,
+        0x005E8, 0x005E9, 0x005EA, 0x005EB, 0x005EC, 0x005ED, 0x005EE, 0x005EF,
+        0x005F0, 0x005F1, 0x005F2, 0x005F3, 0x005F4, 0x005F5, 0x005F6, 0x005F7,
+        0x005F8, 0x005F9, 0x005FA, 0x005FB, 0x005FC, 0x005FD, 0x005FE, 0x005FF,
+    },
+    {
+        0x00600, 0x00601, 0x00602, 0x00603, 0x00604, 0x00605, 0x00606, 0x00607,
+        0x00608, 0x00609, 0x0060A, 0x0060B, 0x0060C, 0x0060D, 0x0060E, 0x0060F,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x0061B, 0x0061C, 0x0061D, 0x0061E, 0x0061F,
+        0x00620, 0x00621, 0x00627, 0x00627, 0x00648, 0x00627, 0x0064A, 0x00627,
+        0x00628, 0x00629, 0x0062A, 0x0062B, 0x0062C, 0x0062D, 0x0062E, 0x0062F,
+        0x00630, 0x00631, 0x00632, 0x00633, 0x00634, 0x00635, 0x00636, 0x00637,
+        0x00638, 0x00639, 0x0063A, 0x0063B, 0x0063C, 0x0063D, 0x0063E, 0x0063F,
+        0x00640, 0x00641, 0x00642, 0x00643, 0x00644, 0x00645, 0x00646, 0x00647,
+        0x00648, 0x00649, 0x0064A, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00660, 0x00661, 0x00662, 0x00663, 0x00664, 0x00665, 0x00666, 0x00667,
+        0x00668, 0x00669, 0x0066A, 0x0066B, 0x0066C, 0x0066D, 0x0066E, 0x0066F,
+        0x00000, 0x00671, 0x00672, 0x00673, 0x00674, 0x00675, 0x00676, 0x00677,
+        0x00678, 0x00679, 0x0067A, 0x0067B, 0x0067C, 0x0067D, 0x0067E, 0x0067F,
+    },
+    {
+        0x00680, 0x00681, 0x00682, 0x00683, 0x00684, 0x00685, 0x00686, 0x00687,
+        0x00688, 0x00689, 0x0068A, 0x0068B, 0x0068C, 0x0068D, 0x0068E, 0x0068F,
+        0x00690, 0x00691, 0x00692, 0x00693, 0x00694, 0x00695, 0x00696, 0x00697,
+        0x00698, 0x00699, 0x0069A, 0x0069B, 0x0069C, 0x0069D, 0x0069E, 0x0069F,
+        0x006A0, 0x006A1, 0x006A2, 0x006A3, 0x006A4, 0x006A5, 0x006A6, 0x006A7,
+        0x006A8, 0x006A9, 0x006AA, 0x006AB, 0x006AC, 0x006AD, 0x006AE, 0x006AF,
+        0x006B0, 0x006B1, 0x006B2, 0x006B3, 0x006B4, 0x006B5, 0x006B6, 0x006B7,
+        0x006B8, 0x006B9, 0x006BA, 0x006BB, 0x006BC, 0x006BD, 0x006BE, 0x006BF,
+        0x006D5, 0x006C1, 0x006C1, 0x006C3, 0x006C4, 0x006C5, 0x006C6, 0x006C7,
+        0x006C8, 0x006C9, 0x006CA, 0x006CB, 0x006CC, 0x006CD, 0x006CE, 0x006CF,
+        0x006D0, 0x006D1, 0x006D2, 0x006D2, 0x006D4, 0x006D5, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x006DD, 0x006DE, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x006E5, 0x006E6, 0x00000,
+        0x00000, 0x006E9, 0x00000, 0x00000, 0x00000, 0x00000, 0x006EE, 0x006EF,
+        0x006F0, 0x006F1, 0x006F2, 0x006F3, 0x006F4, 0x006F5, 0x006F6, 0x006F7,
+        0x006F8, 0x006F9, 0x006FA, 0x006FB, 0x006FC, 0x006FD, 0x006FE, 0x006FF,
+    },
+    {
+        0x00700, 0x00701, 0x00702, 0x00703, 0x00704, 0x00705, 0x00706, 0x00707,
+        0x00708, 0x00709, 0x0070A, 0x0070B, 0x0070C, 0x0070D, 0x0070E, 0x0070F,
+        0x00710, 0x00000, 0x00712, 0x00713, 0x00714, 0x00715, 0x00716, 0x00717,
+        0x00718, 0x00719, 0x0071A, 0x0071B, 0x0071C, 0x0071D, 0x0071E, 0x0071F,
+        0x00720, 0x00721, 0x00722, 0x00723, 0x00724, 0x00725, 0x00726, 0x00727,
+        0x00728, 0x00729, 0x0072A, 0x0072B, 0x0072C, 0x0072D, 0x0072E, 0x0072F,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x0074B, 0x0074C, 0x0074D, 0x0074E, 0x0074F,
+        0x00750, 0x00751, 0x00752, 0x00753, 0x00754, 0x00755, 0x00756, 0x00757,
+        0x00758, 0x00759, 0x0075A, 0x0075B, 0x0075C, 0x0075D, 0x0075E, 0x0075F,
+        0x00760, 0x00761, 0x00762, 0x00763, 0x00764, 0x00765, 0x00766, 0x00767,
+        0x00768, 0x00769, 0x0076A, 0x0076B, 0x0076C, 0x0076D, 0x0076E, 0x0076F,
+        0x00770, 0x00771, 0x00772, 0x00773, 0x00774, 0x00775, 0x00776, 0x00777,
+        0x00778, 0x00779, 0x0077A, 0x0077B, 0x0077C, 0x0077D, 0x0077E, 0x0077F,
+    },
+    {
+        0x00780, 0x00781, 0x00782, 0x00783, 0x00784, 0x00785, 0x00786, 0x00787,
+        0x00788, 0x00789, 0x0078A, 0x0078B, 0x0078C, 0x0078D, 0x0078E, 0x0078F,
+        0x00790, 0x00791, 0x00792, 0x00793, 0x00794, 0x00795, 0x00796, 0x00797,
+        0x00798, 0x00799, 0x0079A, 0x0079B, 0x0079C, 0x0079D, 0x0079E, 0x0079F,
+        0x007A0, 0x007A1, 0x007A2, 0x007A3, 0x007A4, 0x007A5, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x007B1, 0x007B2, 0x007B3, 0x007B4, 0x007B5, 0x007B6, 0x007B7,
+        0x007B8, 0x007B9, 0x007BA, 0x007BB, 0x007BC, 0x007BD, 0x007BE, 0x007BF,
+        0x007C0, 0x007C1, 0x007C2, 0x007C3, 0x007C4, 0x007C5, 0x007C6, 0x007C7,
+        0x007C8, 0x007C9, 0x007CA, 0x007CB, 0x007CC, 0x007CD, 0x007CE, 0x007CF,
+        0x007D0, 0x007D1, 0x007D2, 0x007D3, 0x007D4, 0x007D5, 0x007D6, 0x007D7,
+        0x007D8, 0x007D9, 0x007DA, 0x007DB, 0x007DC, 0x007DD, 0x007DE, 0x007DF,
+        0x007E0, 0x007E1, 0x007E2, 0x007E3, 0x007E4, 0x007E5, 0x007E6, 0x007E7,
+        0x007E8, 0x007E9, 0x007EA, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x007F4, 0x007F5, 0x007F6, 0x007F7,
+        0x007F8, 0x007F9, 0x007FA, 0x007FB, 0x007FC, 0x00000, 0x007FE, 0x007FF,
+    },
+    {
+        0x00800, 0x00801, 0x00802, 0x00803, 0x00804, 0x00805, 0x00806, 0x00807,
+        0x00808, 0x00809, 0x0080A, 0x0080B, 0x0080C, 0x0080D, 0x0080E, 0x0080F,
+        0x00810, 0x00811, 0x00812, 0x00813, 0x00814, 0x00815, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x0081A, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00824, 0x00000, 0x00000, 0x00000,
+        0x00828, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x0082E, 0x0082F,
+        0x00830, 0x00831, 0x00832, 0x00833, 0x00834, 0x00835, 0x00836, 0x00837,
+        0x00838, 0x00839, 0x0083A, 0x0083B, 0x0083C, 0x0083D, 0x0083E, 0x0083F,
+        0x00840, 0x00841, 0x00842, 0x00843, 0x00844, 0x00845, 0x00846, 0x00847,
+        0x00848, 0x00849, 0x0084A, 0x0084B, 0x0084C, 0x0084D, 0x0084E, 0x0084F,
+        0x00850, 0x00851, 0x00852, 0x00853, 0x00854, 0x00855, 0x00856, 0x00857,
+        0x00858, 0x00000, 0x00000, 0x00000, 0x0085C, 0x0085D, 0x0085E, 0x0085F,
+        0x00860, 0x00861, 0x00862, 0x00863, 0x00864, 0x00865, 0x00866, 0x00867,
+        0x00868, 0x00869, 0x0086A, 0x0086B, 0x0086C, 0x0086D, 0x0086E, 0x0086F,
+        0x00870, 0x00871, 0x00872, 0x00873, 0x00874, 0x00875, 0x00876, 0x00877,
+        0x00878, 0x00879, 0x0087A, 0x0087B, 0x0087C, 0x0087D, 0x0087E, 0x0087F,
+    },
+    {
+        0x00880, 0x00881, 0x00882, 0x00883, 0x00884, 0x00885, 0x00886, 0x00887,
+        0x00888, 0x00889, 0x0088A, 0x0088B, 0x0088C, 0x0088D, 0x0088E, 0x0088F,
+        0x00890, 0x00891, 0x00892, 0x00893, 0x00894, 0x00895, 0x00896, 0x00897,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x008A0, 0x008A1, 0x008A2, 0x008A3, 0x008A4, 0x008A5, 0x008A6, 0x008A7,
+        0x008A8, 0x008A9, 0x008AA, 0x008AB, 0x008AC, 0x008AD, 0x008AE, 0x008AF,
+        0x008B0, 0x008B1, 0x008B2, 0x008B3, 0x008B4, 0x008B5, 0x008B6, 0x008B7,
+        0x008B8, 0x008B9, 0x008BA, 0x008BB, 0x008BC, 0x008BD, 0x008BE, 0x008BF,
+        0x008C0, 0x008C1, 0x008C2, 0x008C3, 0x008C4, 0x008C5, 0x008C6, 0x008C7,
+        0x008C8, 0x008C9, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x008E2, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+    },
+    {
+        0x00000, 0x00000, 0x00000, 0x00903, 0x00904, 0x00905, 0x00906, 0x00907,
+        0x00908, 0x00909, 0x0090A, 0x0090B, 0x0090C, 0x0090D, 0x0090E, 0x0090F,
+        0x00910, 0x00911, 0x00912, 0x00913, 0x00914, 0x00915, 0x00916, 0x00917,
+        0x00918, 0x00919, 0x0091A, 0x0091B, 0x0091C, 0x0091D, 0x0091E, 0x0091F,
+        0x00920, 0x00921, 0x00922, 0x00923, 0x00924, 0x00925, 0x00926, 0x00927,
+        0x00928, 0x00928, 0x0092A, 0x0092B, 0x0092C, 0x0092D, 0x0092E, 0x0092F,
+        0x00930, 0x00930, 0x00932, 0x00933, 0x00933, 0x00935, 0x00936, 0x00937,
+        0x00938, 0x00939, 0x00000, 0x0093B, 0x00000, 0x0093D, 0x0093E, 0x0093F,
+        0x00940, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00949, 0x0094A, 0x0094B, 0x0094C, 0x00000, 0x0094E, 0x0094F,
+        0x00950, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00915, 0x00916, 0x00917, 0x0091C, 0x00921, 0x00922, 0x0092B, 0x0092F,
+        0x00960, 0x00961, 0x00000, 0x00000, 0x00964, 0x00965, 0x00966, 0x00967,
+        0x00968, 0x00969, 0x0096A, 0x0096B, 0x0096C, 0x0096D, 0x0096E, 0x0096F,
+        0x00970, 0x00971, 0x00972, 0x00973, 0x00974, 0x00975, 0x00976, 0x00977,
+        0x00978, 0x00979, 0x0097A, 0x0097B, 0x0097C, 0x0097D, 0x0097E, 0x0097F,
+    },
+    {
+        0x00980, 0x00000, 0x00982, 0x00983, 0x00984, 0x00985, 0x00986, 0x00987,
+        0x00988, 0x00989, 0x0098A, 0x0098B, 0x0098C, 0x0098D, 0x0098E, 0x0098F,
+        0x00990, 0x00991, 0x00992, 0x00993, 0x00994, 0x00995, 0x00996, 0x00997,
+        0x00998, 0x00999, 0x0099A, 0x0099B, 0x0099C, 0x0099D, 0x0099E, 0x0099F,
+        0x009A0, 0x009A1, 0x009A2, 0x009A3, 0x009A4, 0x009A5, 0x009A6, 0x009A7,
+        0x009A8, 0x009A9, 0x009AA, 0x009AB, 0x009AC, 0x009AD, 0x009AE, 0x009AF,
+        0x009B0, 0x009B1, 0x009B2, 0x009B3, 0x009B4, 0x009B5, 0x009B6, 0x009B7,
+        0x009B8, 0x009B9, 0x009BA, 0x009BB, 0x00000, 0x009BD, 0x009BE, 0x009BF,
+        0x009C0, 0x00000, 0x00000, 0x00000, 0x00000, 0x009C5, 0x009C6, 0x009C7,
+        0x009C8, 0x009C9, 0x009CA, 0x80000000, 0x80000001, 0x00000, 0x009CE, 0x009CF,
+        0x009D0, 0x009D1, 0x009D2, 0x009D3, 0x009D4, 0x009D5, 0x009D6, 0x009D7,
+        0x009D8, 0x009D9, 0x009DA, 0x009DB, 0x009A1, 0x009A2, 0x009DE, 0x009AF,
+        0x009E0, 0x009E1, 0x00000, 0x00000, 0x009E4, 0x009E5, 0x009E6, 0x009E7,
+        0x009E8, 0x009E9, 0x009EA, 0x009EB, 0x009EC, 0x009ED, 0x009EE, 0x009EF,
+        0x009F0, 0x009F1, 0x009F2, 0x009F3, 0x009F4, 0x009F5, 0x009F6, 0x009F7,
+        0x009F8, 0x009F9, 0x009FA, 0x009FB, 0x009FC, 0x009FD, 0x00000, 0x009FF,
+    },
+    {
+        0x00A00, 0x00000, 0x00000, 0x00A03, 0x00A04, 0x00A05, 0x00A06, 0x00A07,
+        0x00A08, 0x00A09, 0x00A0A, 0x00A0B, 0x00A0C, 0x00A0D, 0x00A0E, 0x00A0F,
+        0x00A10, 0x00A11, 0x00A12, 0x00A13, 0x00A14, 0x00A15, 0x00A16, 0x00A17,
+        0x00A18, 0x00A19, 0x00A1A, 0x00A1B, 0x00A1C, 0x00A1D, 0x00A1E, 0x00A1F,
+        0x00A20, 0x00A21, 0x00A22, 0x00A23, 0x00A24, 0x00A25, 0x00A26, 0x00A27,
+        0x00A28, 0x00A29, 0x00A2A, 0x00A2B, 0x00A2C, 0x00A2D, 0x00A2E, 0x00A2F,
+        0x00A30, 0x00A31, 0x00A32, 0x00A32, 0x00A34, 0x00A35, 0x00A38, 0x00A37,
+        0x00A38, 0x00A39, 0x00A3A, 0x00A3B, 0x00000, 0x00A3D, 0x00A3E, 0x00A3F,
+        0x00A40, 0x00000, 0x00000, 0x00A43, 0x00A44, 0x00A45, 0x00A46, 0x00000,
+        0x00000, 0x00A49, 0x00A4A, 0x00000, 0x00000, 0x00000, 0x00A4E, 0x00A4F,
+        0x00A50, 0x00000, 0x00A52, 0x00A53, 0x00A54, 0x00A55, 0x00A56, 0x00A57,
+        0x00A58, 0x00A16, 0x00A17, 0x00A1C, 0x00A5C, 0x00A5D, 0x00A2B, 0x00A5F,
+        0x00A60, 0x00A61, 0x00A62, 0x00A63, 0x00A64, 0x00A65, 0x00A66, 0x00A67,
+        0x00A68, 0x00A69, 0x00A6A, 0x00A6B, 0x00A6C, 0x00A6D, 0x00A6E, 0x00A6F,
+        0x00000, 0x00000, 0x00A72, 0x00A73, 0x00A74, 0x00000, 0x00A76, 0x00A77,
+        0x00A78, 0x00A79, 0x00A7A, 0x00A7B, 0x00A7C, 0x00A7D, 0x00A7E, 0x00A7F,
+    },
+    {
+        0x00A80, 0x00000, 0x00000, 0x00A83, 0x00A84, 0x00A85, 0x00A86, 0x00A87,
+        0x00A88, 0x00A89, 0x00A8A, 0x00A8B, 0x00A8C, 0x00A8D, 0x00A8E, 0x00A8F,
+        0x00A90, 0x00A91, 0x00A92, 0x00A93, 0x00A94, 0x00A95, 0x00A96, 0x00A97,
+        0x00A98, 0x00A99, 0x00A9A, 0x00A9B, 0x00A9C, 0x00A9D, 0x00A9E, 0x00A9F,
+        0x00AA0, 0x00AA1, 0x00AA2, 0x00AA3, 0x00AA4, 0x00AA5, 0x00AA6, 0x00AA7,
+        0x00AA8, 0x00AA9, 0x00AAA, 0x00AAB, 0x00AAC, 0x00AAD, 0x00AAE, 0x00AAF,
+        0x00AB0, 0x00AB1, 0x00AB2, 0x00AB3, 0x00AB4, 0x00AB5, 0x00AB6, 0x00AB7,
+        0x00AB8, 0x00AB9, 0x00ABA, 0x00ABB, 0x00000, 0x00ABD, 0x00ABE, 0x00ABF,
+        0x00AC0, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00AC6, 0x00000,
+        0x00000, 0x00AC9, 0x00ACA, 0x00ACB, 0x00ACC, 0x00000, 0x00ACE, 0x00ACF,
+        0x00AD0, 0x00AD1, 0x00AD2, 0x00AD3, 0x00AD4, 0x00AD5, 0x00AD6, 0x00AD7,
+        0x00AD8, 0x00AD9, 0x00ADA, 0x00ADB, 0x00ADC, 0x00ADD, 0x00ADE, 0x00ADF,
+        0x00AE0, 0x00AE1, 0x00000, 0x00000, 0x00AE4, 0x00AE5, 0x00AE6, 0x00AE7,
+        0x00AE8, 0x00AE9, 0x00AEA, 0x00AEB, 0x00AEC, 0x00AED, 0x00AEE, 0x00AEF,
+        0x00AF0, 0x00AF1, 0x00AF2, 0x00AF3, 0x00AF4, 0x00AF5, 0x00AF6, 0x00AF7,
+        0x00AF8, 0x00AF9, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+    },
+    {
+        0x00B00, 0x00000, 0x00B02, 0x00B03, 0x00B04, 0x00B05, 0x00B06, 0x00B07,
+        0x00B08, 0x00B09, 0x00B0A, 0x00B0B, 0x00B0C, 0x00B0D, 0x00B0E, 0x00B0F,
+        0x00B10, 0x00B11, 0x00B12, 0x00B13, 0x00B14, 0x00B15, 0x00B16, 0x00B17,
+        0x00B18, 0x00B19, 0x00B1A, 0x00B1B, 0x00B1C, 0x00B1D, 0x00B1E, 0x00B1F,
+        0x00B20, 0x00B21, 0x00B22, 0x00B23, 0x00B24, 0x00B25, 0x00B26, 0x00B27,
+        0x00B28, 0x00B29, 0x00B2A, 0x00B2B, 0x00B2C, 0x00B2D, 0x00B2E, 0x00B2F,
+        0x00B30, 0x00B31, 0x00B32, 0x00B33, 0x00B34, 0x00B35, 0x00B36, 0x00B37,
+        0x00B38, 0x00B39, 0x00B3A, 0x00B3B, 0x00000, 0x00B3D, 0x00B3E, 0x00000,
+        0x00B40, 0x00000, 0x00000, 0x00000, 0x00000, 0x00B45, 0x00B46, 0x00B47,
+        0x00B47, 0x00B49, 0x00B4A, 0x80000002, 0x80000003, 0x00000, 0x00B4E, 0x00B4F,
+        0x00B50, 0x00B51, 0x00B52, 0x00B53, 0x00B54, 0x00000, 0x00000, 0x00B57,
+        0x00B58, 0x00B59, 0x00B5A, 0x00B5B, 0x00B21, 0x00B22, 0x00B5E, 0x00B5F,
+        0x00B60, 0x00B61, 0x00000, 0x00000, 0x00B64, 0x00B65, 0x00B66, 0x00B67,
+        0x00B68, 0x00B69, 0x00B6A, 0x00B6B, 0x00B6C, 0x00B6D, 0x00B6E, 0x00B6F,
+        0x00B70, 0x00B71, 0x00B72, 0x00B73, 0x00B74, 0x00B75, 0x00B76, 0x00B77,
+        0x00B78, 0x00B79, 0x00B7A, 0x00B7B, 0x00B7C, 0x00B7D, 0x00B7E, 0x00B7F,
+    },
+    {
+        0x00B80, 0x00B81, 0x00000, 0x00B83, 0x00B84, 0x00B85, 0x00B86, 0x00B87,
+        0x00B88, 0x00B89, 0x00B8A, 0x00B8B, 0x00B8C, 0x00B8D, 0x00B8E, 0x00B8F,
+        0x00B90, 0x00B91, 0x00B92, 0x00B93, 0x80000004, 0x00B95, 0x00B96, 0x00B97,
+        0x00B98, 0x00B99, 0x00B9A, 0x00B9B, 0x00B9C, 0x00B9D, 0x00B9E, 0x00B9F,
+        0x00BA0, 0x00BA1, 0x00BA2, 0x00BA3, 0x00BA4, 0x00BA5, 0x00BA6, 0x00BA7,
+        0x00BA8, 0x00BA9, 0x00BAA, 0x00BAB, 0x00BAC, 0x00BAD, 0x00BAE, 0x00BAF,
+        0x00BB0, 0x00BB1, 0x00BB2, 0x00BB3, 0x00BB4, 0x00BB5, 0x00BB6, 0x00BB7,
+        0x00BB8, 0x00BB9, 0x00BBA, 0x00BBB, 0x00BBC, 0x00BBD, 0x00BBE, 0x00BBF,
+        0x00000, 0x00BC1, 0x00BC2, 0x00BC3, 0x00BC4, 0x00BC5, 0x00BC6, 0x00BC7,
+        0x00BC8, 0x00BC9, 0x80000005, 0x80000006, 0x80000007, 0x00000, 0x00BCE, 0x00BCF,
+        0x00BD0, 0x00BD1, 0x00BD2, 0x00BD3, 0x00BD4, 0x00BD5, 0x00BD6, 0x00BD7,
+        0x00BD8, 0x00BD9, 0x00BDA, 0x00BDB, 0x00BDC, 0x00BDD, 0x00BDE, 0x00BDF,
+        0x00BE0, 0x00BE1, 0x00BE2, 0x00BE3, 0x00BE4, 0x00BE5, 0x00BE6, 0x00BE7,
+        0x00BE8, 0x00BE9, 0x00BEA, 0x00BEB, 0x00BEC, 0x00BED, 0x00BEE, 0x00BEF,
+        0x00BF0, 0x00BF1, 0x00BF2, 0x00BF3, 0x00BF4, 0x00BF5, 0x00BF6, 0x00BF7,
+        0x00BF8, 0x00BF9, 0x00BFA, 0x00BFB, 0x00BFC, 0x00BFD, 0x00BFE, 0x00BFF,
+    },
+    {
+        0x00000, 0x00C01, 0x00C02, 0x00C03, 0x00000, 0x00C05, 0x00C06, 0x00C07,
+        0x00C08, 0x00C09, 0x00C0A, 0x00C0B, 0x00C0C, 0x00C0D, 0x00C0E, 0x00C0F,
+        0x00C10, 0x00C11, 0x00C12, 0x00C13, 0x00C14, 0x00C15, 0x00C16, 0x00C17,
+        0x00C18, 0x00C19, 0x00C1A, 0x00C1B, 0x00C1C, 0x00C1D, 0x00C1E, 0x00C1F,
+        0x00C20, 0x00C21, 0x00C22, 0x00C23, 0x00C24, 0x00C25, 0x00C26, 0x00C27,
+        0x00C28, 0x00C29, 0x00C2A, 0x00C2B, 0x00C2C, 0x00C2D, 0x00C2E, 0x00C2F,
+        0x00C30, 0x00C31, 0x00C32, 0x00C33, 0x00C34, 0x00C35, 0x00C36, 0x00C37,
+        0x00C38, 0x00C39, 0x00C3A, 0x00C3B, 0x00000, 0x00C3D, 0x00000, 0x00000,
+        0x00000, 0x00C41, 0x00C42, 0x00C43, 0x00C44, 0x00C45, 0x00000, 0x00000,
+        0x00000, 0x00C49, 0x00000, 0x00000, 0x00000, 0x00000, 0x00C4E, 0x00C4F,
+        0x00C50, 0x00C51, 0x00C52, 0x00C53, 0x00C54, 0x00000, 0x00000, 0x00C57,
+        0x00C58, 0x00C59, 0x00C5A, 0x00C5B, 0x00C5C, 0x00C5D, 0x00C5E, 0x00C5F,
+        0x00C60, 0x00C61, 0x00000, 0x00000, 0x00C64, 0x00C65, 0x00C66, 0x00C67,
+        0x00C68, 0x00C69, 0x00C6A, 0x00C6B, 0x00C6C, 0x00C6D, 0x00C6E, 0x00C6F,
+        0x00C70, 0x00C71, 0x00C72, 0x00C73, 0x00C74, 0x00C75, 0x00C76, 0x00C77,
+        0x00C78, 0x00C79, 0x00C7A, 0x00C7B, 0x00C7C, 0x00C7D, 0x00C7E, 0x00C7F,
+    },
+    {
+        0x00C80, 0x00000, 0x00C82, 0x00C83, 0x00C84, 0x00C85, 0x00C86, 0x00C87,
+        0x00C88, 0x00C89, 0x00C8A, 0x00C8B, 0x00C8C, 0x00C8D, 0x00C8E, 0x00C8F,
+        0x00C90, 0x00C91, 0x00C92, 0x00C93, 0x00C94, 0x00C95, 0x00C96, 0x00C97,
+        0x00C98, 0x00C99, 0x00C9A, 0x00C9B, 0x00C9C, 0x00C9D, 0x00C9E, 0x00C9F,
+        0x00CA0, 0x00CA1, 0x00CA2, 0x00CA3, 0x00CA4, 0x00CA5, 0x00CA6, 0x00CA7,
+        0x00CA8, 0x00CA9, 0x00CAA, 0x00CAB, 0x00CAC, 0x00CAD, 0x00CAE, 0x00CAF,
+        0x00CB0, 0x00CB1, 0x00CB2, 0x00CB3, 0x00CB4, 0x00CB5, 0x00CB6, 0x00CB7,
+        0x00CB8, 0x00CB9, 0x00CBA, 0x00CBB, 0x00000, 0x00CBD, 0x00CBE, 0x00000,
+        0x00CD5, 0x00CC1, 0x00CC2, 0x00CC3, 0x00CC4, 0x00CC5, 0x00000, 0x00CD5,
+        0x00CD6, 0x00CC9, 0x00CC2, 0x80000008, 0x00000, 0x00000, 0x00CCE, 0x00CCF,
+        0x00CD0, 0x00CD1, 0x00CD2, 0x00CD3, 0x00CD4, 0x00CD5, 0x00CD6, 0x00CD7,
+        0x00CD8, 0x00CD9, 0x00CDA, 0x00CDB, 0x00CDC, 0x00CDD, 0x00CDE, 0x00CDF,
+        0x00CE0, 0x00CE1, 0x00000, 0x00000, 0x00CE4, 0x00CE5, 0x00CE6, 0x00CE7,
+        0x00CE8, 0x00CE9, 0x00CEA, 0x00CEB, 0x00CEC, 0x00CED, 0x00CEE, 0x00CEF,
+        0x00CF0, 0x00CF1, 0x00CF2, 0x00CF3, 0x00CF4, 0x00CF5, 0x00CF6, 0x00CF7,
+        0x00CF8, 0x00CF9, 0x00CFA, 0x00CFB, 0x00CFC, 0x00CFD, 0x00CFE, 0x00CFF,
+    },
+    {
+        0x00000, 0x00000, 0x00D02, 0x00D03, 0x00D04, 0x00D05, 0x00D06, 0x00D07,
+        0x00D08, 0x00D09, 0x00D0A, 0x00D0B, 0x00D0C, 0x00D0D, 0x00D0E, 0x00D0F,
+        0x00D10, 0x00D11, 0x00D12, 0x00D13, 0x00D14, 0x00D15, 0x00D16, 0x00D17,
+        0x00D18, 0x00D19, 0x00D1A, 0x00D1B, 0x00D1C, 0x00D1D, 0x00D1E, 0x00D1F,
+        0x00D20, 0x00D21, 0x00D22, 0x00D23, 0x00D24, 0x00D25, 0x00D26, 0x00D27,
+        0x00D28, 0x00D29, 0x00D2A, 0x00D2B, 0x00D2C, 0x00D2D, 0x00D2E, 0x00D2F,
+        0x00D30, 0x00D31, 0x00D32, 0x00D33, 0x00D34, 0x00D35, 0x00D36, 0x00D37,
+        0x00D38, 0x00D39, 0x00D3A, 0x00000, 0x00000, 0x00D3D, 0x00D3E, 0x00D3F,
+        0x00D40, 0x00000, 0x00000, 0x00000, 0x00000, 0x00D45, 0x00D46, 0x00D47,
+        0x00D48, 0x00D49, 0x80000009, 0x8000000A, 0x8000000B, 0x00000, 0x00D4E, 0x00D4F,
+        0x00D50, 0x00D51, 0x00D52, 0x00D53, 0x00D54, 0x00D55, 0x00D56, 0x00D57,
+        0x00D58, 0x00D59, 0x00D5A, 0x00D5B, 0x00D5C, 0x00D5D, 0x00D5E, 0x00D5F,
+        0x00D60, 0x00D61, 0x00000, 0x00000, 0x00D64, 0x00D65, 0x00D66, 0x00D67,
+        0x00D68, 0x00D69, 0x00D6A, 0x00D6B, 0x00D6C, 0x00D6D, 0x00D6E, 0x00D6F,
+        0x00D70, 0x00D71, 0x00D72, 0x00D73, 0x00D74, 0x00D75, 0x00D76, 0x00D77,
+        0x00D78, 0x00D79, 0x00D7A, 0x00D7B, 0x00D7C, 0x00D7D, 0x00D7E, 0x00D7F,
+    },
+    {
+        0x00D80, 0x00000, 0x00D82, 0x00D83, 0x00D84, 0x00D85, 0x00D86, 0x00D87,
+        0x00D88, 0x00D89, 0x00D8A, 0x00D8B, 0x00D8C, 0x00D8D, 0x00D8E, 0x00D8F,
+        0x00D90, 0x00D91, 0x00D92, 0x00D93, 0x00D94, 0x00D95, 0x00D96, 0x00D97,
+        0x00D98, 0x00D99, 0x00D9A, 0x00D9B, 0x00D9C, 0x00D9D, 0x00D9E, 0x00D9F,
+        0x00DA0, 0x00DA1, 0x00DA2, 0x00DA3, 0x00DA4, 0x00DA5, 0x00DA6, 0x00DA7,
+        0x00DA8, 0x00DA9, 0x00DAA, 0x00DAB, 0x00DAC, 0x00DAD, 0x00DAE, 0x00DAF,
+        0x00DB0, 0x00DB1, 0x00DB2, 0x00DB3, 0x00DB4, 0x00DB5, 0x00DB6, 0x00DB7,
+        0x00DB8, 0x00DB9, 0x00DBA, 0x00DBB, 0x00DBC, 0x00DBD, 0x00DBE, 0x00DBF,
+        0x00DC0, 0x00DC1, 0x00DC2, 0x00DC3, 0x00DC4, 0x00DC5, 0x00DC6, 0x00DC7,
+        0x00DC8, 0x00DC9, 0x00000, 0x00DCB, 0x00DCC, 0x00DCD, 0x00DCE, 0x00DCF,
+        0x00DD0, 0x00DD1, 0x00000, 0x00000, 0x00000, 0x00DD5, 0x00000, 0x00DD7,
+        0x00DD8, 0x00DD9, 0x00DD9, 0x00DDB, 0x8000000C, 0x8000000C, 0x8000000D, 0x00DDF,
+        0x00DE0, 0x00DE1, 0x00DE2, 0x00DE3, 0x00DE4, 0x00DE5, 0x00DE6, 0x00DE7,
+        0x00DE8, 0x00DE9, 0x00DEA, 0x00DEB, 0x00DEC, 0x00DED, 0x00DEE, 0x00DEF,
+        0x00DF0, 0x00DF1, 0x00DF2, 0x00DF3, 0x00DF4, 0x00DF5, 0x00DF6, 0x00DF7,
+        0x00DF8, 0x00DF9, 0x00DFA, 0x00DFB, 0x00DFC, 0x00DFD, 0x00DFE, 0x00DFF,
+    },
+    {
+        0x00E00, 0x00E01, 0x00E02, 0x00E03, 0x00E04, 0x00E05, 0x00E06, 0x00E07,
+        0x00E08, 0x00E09, 0x00E0A, 0x00E0B, 0x00E0C, 0x00E0D, 0x00E0E, 0x00E0F,
+        0x00E10, 0x00E11, 0x00E12, 0x00E13, 0x00E14, 0x00E15, 0x00E16, 0x00E17,
+        0x00E18, 0x00E19, 0x00E1A, 0x00E1B, 0x00E1C, 0x00E1D, 0x00E1E, 0x00E1F,
+        0x00E20, 0x00E21, 0x00E22, 0x00E23, 0x00E24, 0x00E25, 0x00E26, 0x00E27,
+        0x00E28, 0x00E29, 0x00E2A, 0x00E2B, 0x00E2C, 0x00E2D, 0x00E2E, 0x00E2F,
+        0x00E30, 0x00000, 0x00E32, 0x00E33, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00E3B, 0x00E3C, 0x00E3D, 0x00E3E, 0x00E3F,
+        0x00E40, 0x00E41, 0x00E42, 0x00E43, 0x00E44, 0x00E45, 0x00E46, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00E4F,
+        0x00E50, 0x00E51, 0x00E52, 0x00E53, 0x00E54, 0x00E55, 0x00E56, 0x00E57,
+        0x00E58, 0x00E59, 0x00E5A, 0x00E5B, 0x00E5C, 0x00E5D, 0x00E5E, 0x00E5F,
+        0x00E60, 0x00E61, 0x00E62, 0x00E63, 0x00E64, 0x00E65, 0x00E66, 0x00E67,
+        0x00E68, 0x00E69, 0x00E6A, 0x00E6B, 0x00E6C, 0x00E6D, 0x00E6E, 0x00E6F,
+        0x00E70, 0x00E71, 0x00E72, 0x00E73, 0x00E74, 0x00E75, 0x00E76, 0x00E77,
+        0x00E78, 0x00E79, 0x00E7A, 0x00E7B, 0x00E7C, 0x00E7D, 0x00E7E, 0x00E7F,
+    },
+    {
+        0x00E80, 0x00E81, 0x00E82, 0x00E83, 0x00E84, 0x00E85, 0x00E86, 0x00E87,
+        0x00E88, 0x00E89, 0x00E8A, 0x00E8B, 0x00E8C, 0x00E8D, 0x00E8E, 0x00E8F,
+        0x00E90, 0x00E91, 0x00E92, 0x00E93, 0x00E94, 0x00E95, 0x00E96, 0x00E97,
+        0x00E98, 0x00E99, 0x00E9A, 0x00E9B, 0x00E9C, 0x00E9D, 0x00E9E, 0x00E9F,
+        0x00EA0, 0x00EA1, 0x00EA2, 0x00EA3, 0x00EA4, 0x00EA5, 0x00EA6, 0x00EA7,
+        0x00EA8, 0x00EA9, 0x00EAA, 0x00EAB, 0x00EAC, 0x00EAD, 0x00EAE, 0x00EAF,
+        0x00EB0, 0x00000, 0x00EB2, 0x00EB3, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00EBD, 0x00EBE, 0x00EBF,
+        0x00EC0, 0x00EC1, 0x00EC2, 0x00EC3, 0x00EC4, 0x00EC5, 0x00EC6, 0x00EC7,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00ECE, 0x00ECF,
+        0x00ED0, 0x00ED1, 0x00ED2, 0x00ED3, 0x00ED4, 0x00ED5, 0x00ED6, 0x00ED7,
+        0x00ED8, 0x00ED9, 0x00EDA, 0x00EDB, 0x00EDC, 0x00EDD, 0x00EDE, 0x00EDF,
+        0x00EE0, 0x00EE1, 0x00EE2, 0x00EE3, 0x00EE4, 0x00EE5, 0x00EE6, 0x00EE7,
+        0x00EE8, 0x00EE9, 0x00EEA, 0x00EEB, 0x00EEC, 0x00EED, 0x00EEE, 0x00EEF,
+        0x00EF0, 0x00EF1, 0x00EF2, 0x00EF3, 0x00EF4, 0x00EF5, 0x00EF6, 0x00EF7,
+        0x00EF8, 0x00EF9, 0x00EFA, 0x00EFB, 0x00EFC, 0x00EFD, 0x00EFE, 0x00EFF,
+    },
+    {
+        0x00F00, 0x00F01, 0x00F02, 0x00F03, 0x00F04, 0x00F05, 0x00F06, 0x00F07,
+        0x00F08, 0x00F09, 0x00F0A, 0x00F0B, 0x00F0C, 0x00F0D, 0x00F0E, 0x00F0F,
+        0x00F10, 0x00F11, 0x00F12, 0x00F13, 0x00F14, 0x00F15, 0x00F16, 0x00F17,
+        0x00000, 0x00000, 0x00F1A, 0x00F1B, 0x00F1C, 0x00F1D, 0x00F1E, 0x00F1F,
+        0x00F20, 0x00F21, 0x00F22, 0x00F23, 0x00F24, 0x00F25, 0x00F26, 0x00F27,
+        0x00F28, 0x00F29, 0x00F2A, 0x00F2B, 0x00F2C, 0x00F2D, 0x00F2E, 0x00F2F,
+        0x00F30, 0x00F31, 0x00F32, 0x00F33, 0x00F34, 0x00000, 0x00F36, 0x00000,
+        0x00F38, 0x00000, 0x00F3A, 0x00F3B, 0x00F3C, 0x00F3D, 0x00F3E, 0x00F3F,
+        0x00F40, 0x00F41, 0x00F42, 0x00F42, 0x00F44, 0x00F45, 0x00F46, 0x00F47,
+        0x00F48, 0x00F49, 0x00F4A, 0x00F4B, 0x00F4C, 0x00F4C, 0x00F4E, 0x00F4F,
+        0x00F50, 0x00F51, 0x00F51, 0x00F53, 0x00F54, 0x00F55, 0x00F56, 0x00F56,
+        0x00F58, 0x00F59, 0x00F5A, 0x00F5B, 0x00F5B, 0x00F5D, 0x00F5E, 0x00F5F,
+        0x00F60, 0x00F61, 0x00F62, 0x00F63, 0x00F64, 0x00F65, 0x00F66, 0x00F67,
+        0x00F68, 0x00F40, 0x00F6A, 0x00F6B, 0x00F6C, 0x00F6D, 0x00F6E, 0x00F6F,
+        0x00F70, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00F7F,
+    },
+    {
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00F85, 0x00000, 0x00000,
+        0x00F88, 0x00F89, 0x00F8A, 0x00F8B, 0x00F8C, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00F98, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00FBD, 0x00FBE, 0x00FBF,
+        0x00FC0, 0x00FC1, 0x00FC2, 0x00FC3, 0x00FC4, 0x00FC5, 0x00000, 0x00FC7,
+        0x00FC8, 0x00FC9, 0x00FCA, 0x00FCB, 0x00FCC, 0x00FCD, 0x00FCE, 0x00FCF,
+        0x00FD0, 0x00FD1, 0x00FD2, 0x00FD3, 0x00FD4, 0x00FD5, 0x00FD6, 0x00FD7,
+        0x00FD8, 0x00FD9, 0x00FDA, 0x00FDB, 0x00FDC, 0x00FDD, 0x00FDE, 0x00FDF,
+        0x00FE0, 0x00FE1, 0x00FE2, 0x00FE3, 0x00FE4, 0x00FE5, 0x00FE6, 0x00FE7,
+        0x00FE8, 0x00FE9, 0x00FEA, 0x00FEB, 0x00FEC, 0x00FED, 0x00FEE, 0x00FEF,
+        0x00FF0, 0x00FF1, 0x00FF2, 0x00FF3, 0x00FF4, 0x00FF5, 0x00FF6, 0x00FF7,
+        0x00FF8, 0x00FF9, 0x00FFA, 0x00FFB, 0x00FFC, 0x00FFD, 0x00FFE, 0x00FFF,
+    },
+    {
+        0x01000, 0x01001, 0x01002, 0x01003, 0x01004, 0x01005, 0x01006, 0x01007,
+        0x01008, 0x01009, 0x0100A, 0x0100B, 0x0100C, 0x0100D, 0x0100E, 0x0100F,
+        0x01010, 0x01011, 0x01012, 0x01013, 0x01014, 0x01015, 0x01016, 0x01017,
+        0x01018, 0x01019, 0x0101A, 0x0101B, 0x0101C, 0x0101D, 0x0101E, 0x0101F,
+        0x01020, 0x01021, 0x01022, 0x01023, 0x01024, 0x01025, 0x01025, 0x01027,
+        0x01028, 0x01029, 0x0102A, 0x0102B, 0x0102C, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x01031, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x01038, 0x00000, 0x00000, 0x0103B, 0x0103C, 0x00000, 0x00000, 0x0103F,
+        0x01040, 0x01041, 0x01042, 0x01043, 0x01044, 0x01045, 0x01046, 0x01047,
+        0x01048, 0x01049, 0x0104A, 0x0104B, 0x0104C, 0x0104D, 0x0104E, 0x0104F,
+        0x01050, 0x01051, 0x01052, 0x01053, 0x01054, 0x01055, 0x01056, 0x01057,
+        0x00000, 0x00000, 0x0105A, 0x0105B, 0x0105C, 0x0105D, 0x00000, 0x00000,
+        0x00000, 0x01061, 0x01062, 0x01063, 0x01064, 0x01065, 0x01066, 0x01067,
+        0x01068, 0x01069, 0x0106A, 0x0106B, 0x0106C, 0x0106D, 0x0106E, 0x0106F,
+        0x01070, 0x00000, 0x00000, 0x00000, 0x00000, 0x01075, 0x01076, 0x01077,
+        0x01078, 0x01079, 0x0107A, 0x0107B, 0x0107C, 0x0107D, 0x0107E, 0x0107F,
+    },
+    {
+        0x01080, 0x01081, 0x00000, 0x01083, 0x01084, 0x00000, 0x00000, 0x01087,
+        0x01088, 0x01089, 0x0108A, 0x0108B, 0x0108C, 0x00000, 0x0108E, 0x0108F,
+        0x01090, 0x01091, 0x01092, 0x01093, 0x01094, 0x01095, 0x01096, 0x01097,
+        0x01098, 0x01099, 0x0109A, 0x0109B, 0x0109C, 0x00000, 0x0109E, 0x0109F,
+        0x02D00, 0x02D01, 0x02D02, 0x02D03, 0x02D04, 0x02D05, 0x02D06, 0x02D07,
+        0x02D08, 0x02D09, 0x02D0A, 0x02D0B, 0x02D0C, 0x02D0D, 0x02D0E, 0x02D0F,
+        0x02D10, 0x02D11, 0x02D12, 0x02D13, 0x02D14, 0x02D15, 0x02D16, 0x02D17,
+        0x02D18, 0x02D19, 0x02D1A, 0x02D1B, 0x02D1C, 0x02D1D, 0x02D1E, 0x02D1F,
+        0x02D20, 0x02D21, 0x02D22, 0x02D23, 0x02D24, 0x02D25, 0x010C6, 0x02D27,
+        0x010C8, 0x010C9, 0x010CA, 0x010CB, 0x010CC, 0x02D2D, 0x010CE, 0x010CF,
+        0x010D0, 0x010D1, 0x010D2, 0x010D3, 0x010D4, 0x010D5, 0x010D6, 0x010D7,
+        0x010D8, 0x010D9, 0x010DA, 0x010DB, 0x010DC, 0x010DD, 0x010DE, 0x010DF,
+        0x010E0, 0x010E1, 0x010E2, 0x010E3, 0x010E4, 0x010E5, 0x010E6, 0x010E7,
+        0x010E8, 0x010E9, 0x010EA, 0x010EB, 0x010EC, 0x010ED, 0x010EE, 0x010EF,
+        0x010F0, 0x010F1, 0x010F2, 0x010F3, 0x010F4, 0x010F5, 0x010F6, 0x010F7,
+        0x010F8, 0x010F9, 0x010FA, 0x010FB, 0x010FC, 0x010FD, 0x010FE, 0x010FF,
+    },
+    {
+        0x01300, 0x01301, 0x01302, 0x01303, 0x01304, 0x01305, 0x01306, 0x01307,
+        0x01308, 0x01309, 0x0130A, 0x0130B, 0x0130C, 0x0130D, 0x0130E, 0x0130F,
+        0x01310, 0x01311, 0x01312, 0x01313, 0x01314, 0x01315, 0x01316, 0x01317,
+        0x01318, 0x01319, 0x0131A, 0x0131B, 0x0131C, 0x0131D, 0x0131E, 0x0131F,
+        0x01320, 0x01321, 0x01322, 0x01323, 0x01324, 0x01325, 0x01326, 0x01327,
+        0x01328, 0x01329, 0x0132A, 0x0132B, 0x0132C, 0x0132D, 0x0132E, 0x0132F,
+        0x01330, 0x01331, 0x01332, 0x01333, 0x01334, 0x01335, 0x01336, 0x01337,
+        0x01338, 0x01339, 0x0133A, 0x0133B, 0x0133C, 0x0133D, 0x0133E, 0x0133F,
+        0x01340, 0x01341, 0x01342, 0x01343, 0x01344, 0x01345, 0x01346, 0x01347,
+        0x01348, 0x01349, 0x0134A, 0x0134B, 0x0134C, 0x0134D, 0x0134E, 0x0134F,
+        0x01350, 0x01351, 0x01352, 0x01353, 0x01354, 0x01355, 0x01356, 0x01357,
+        0x01358, 0x01359, 0x0135A, 0x0135B, 0x0135C, 0x00000, 0x00000, 0x00000,
+        0x01360, 0x01361, 0x01362, 0x01363, 0x01364, 0x01365, 0x01366, 0x01367,
+        0x01368, 0x01369, 0x0136A, 0x0136B, 0x0136C, 0x0136D, 0x0136E, 0x0136F,
+        0x01370, 0x01371, 0x01372, 0x01373, 0x01374, 0x01375, 0x01376, 0x01377,
+        0x01378, 0x01379, 0x0137A, 0x0137B, 0x0137C, 0x0137D, 0x0137E, 0x0137F,
+    },
+    {
+        0x01380, 0x01381, 0x01382, 0x01383, 0x01384, 0x01385, 0x01386, 0x01387,
+        0x01388, 0x01389, 0x0138A, 0x0138B, 0x0138C, 0x0138D, 0x0138E, 0x0138F,
+        0x01390, 0x01391, 0x01392, 0x01393, 0x01394, 0x01395, 0x01396, 0x01397,
+        0x01398, 0x01399, 0x0139A, 0x0139B, 0x0139C, 0x0139D, 0x0139E, 0x0139F,
+        0x0AB70, 0x0AB71, 0x0AB72, 0x0AB73, 0x0AB74, 0x0AB75, 0x0AB76, 0x0AB77,
+        0x0AB78, 0x0AB79, 0x0AB7A, 0x0AB7B, 0x0AB7C, 0x0AB7D, 0x0AB7E, 0x0AB7F,
+        0x0AB80, 0x0AB81, 0x0AB82, 0x0AB83, 0x0AB84, 0x0AB85, 0x0AB86, 0x0AB87,
+        0x0AB88, 0x0AB89, 0x0AB8A, 0x0AB8B, 0x0AB8C, 0x0AB8D, 0x0AB8E, 0x0AB8F,
+        0x0AB90, 0x0AB91, 0x0AB92, 0x0AB93, 0x0AB94, 0x0AB95, 0x0AB96, 0x0AB97,
+        0x0AB98, 0x0AB99, 0x0AB9A, 0x0AB9B, 0x0AB9C, 0x0AB9D, 0x0AB9E, 0x0AB9F,
+        0x0ABA0, 0x0ABA1, 0x0ABA2, 0x0ABA3, 0x0ABA4, 0x0ABA5, 0x0ABA6, 0x0ABA7,
+        0x0ABA8, 0x0ABA9, 0x0ABAA, 0x0ABAB, 0x0ABAC, 0x0ABAD, 0x0ABAE, 0x0ABAF,
+        0x0ABB0, 0x0ABB1, 0x0ABB2, 0x0ABB3, 0x0ABB4, 0x0ABB5, 0x0ABB6, 0x0ABB7,
+        0x0ABB8, 0x0ABB9, 0x0ABBA, 0x0ABBB, 0x0ABBC, 0x0ABBD, 0x0ABBE, 0x0ABBF,
+        0x013F8, 0x013F9, 0x013FA, 0x013FB, 0x013FC, 0x013FD, 0x013F6, 0x013F7,
+        0x013F8, 0x013F9, 0x013FA, 0x013FB, 0x013FC, 0x013FD, 0x013FE, 0x013FF,
+    },
+    {
+        0x01700, 0x01701, 0x01702, 0x01703, 0x01704, 0x01705, 0x01706, 0x01707,
+        0x01708, 0x01709, 0x0170A, 0x0170B, 0x0170C, 0x0170D, 0x0170E, 0x0170F,
+        0x01710, 0x01711, 0x00000, 0x00000, 0x00000, 0x01715, 0x01716, 0x01717,
+        0x01718, 0x01719, 0x0171A, 0x0171B, 0x0171C, 0x0171D, 0x0171E, 0x0171F,
+        0x01720, 0x01721, 0x01722, 0x01723, 0x01724, 0x01725, 0x01726, 0x01727,
+        0x01728, 0x01729, 0x0172A, 0x0172B, 0x0172C, 0x0172D, 0x0172E, 0x0172F,
+        0x01730, 0x01731, 0x00000, 0x00000, 0x01734, 0x01735, 0x01736, 0x01737,
+        0x01738, 0x01739, 0x0173A, 0x0173B, 0x0173C, 0x0173D, 0x0173E, 0x0173F,
+        0x01740, 0x01741, 0x01742, 0x01743, 0x01744, 0x01745, 0x01746, 0x01747,
+        0x01748, 0x01749, 0x0174A, 0x0174B, 0x0174C, 0x0174D, 0x0174E, 0x0174F,
+        0x01750, 0x01751, 0x00000, 0x00000, 0x01754, 0x01755, 0x01756, 0x01757,
+        0x01758, 0x01759, 0x0175A, 0x0175B, 0x0175C, 0x0175D, 0x0175E, 0x0175F,
+        0x01760, 0x01761, 0x01762, 0x01763, 0x01764, 0x01765, 0x01766, 0x01767,
+        0x01768, 0x01769, 0x0176A, 0x0176B, 0x0176C, 0x0176D, 0x0176E, 0x0176F,
+        0x01770, 0x01771, 0x00000, 0x00000, 0x01774, 0x01775, 0x01776, 0x01777,
+        0x01778, 0x01779, 0x0177A, 0x0177B, 0x0177C, 0x0177D, 0x0177E, 0x0177F,
+    },
+    {
+        0x01780, 0x01781, 0x01782, 0x01783, 0x01784, 0x01785, 0x01786, 0x01787,
+        0x01788, 0x01789, 0x0178A, 0x0178B, 0x0178C, 0x0178D, 0x0178E, 0x0178F,
+        0x01790, 0x01791, 0x01792, 0x01793, 0x01794, 0x01795, 0x01796, 0x01797,
+        0x01798, 0x01799, 0x0179A, 0x0179B, 0x0179C, 0x0179D, 0x0179E, 0x0179F,
+        0x017A0, 0x017A1, 0x017A2, 0x017A3, 0x017A4, 0x017A5, 0x017A6, 0x017A7,
+        0x017A8, 0x017A9, 0x017AA, 0x017AB, 0x017AC, 0x017AD, 0x017AE, 0x017AF,
+        0x017B0, 0x017B1, 0x017B2, 0x017B3, 0x00000, 0x00000, 0x017B6, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x017BE, 0x017BF,
+        0x017C0, 0x017C1, 0x017C2, 0x017C3, 0x017C4, 0x017C5, 0x00000, 0x017C7,
+        0x017C8, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x017D4, 0x017D5, 0x017D6, 0x017D7,
+        0x017D8, 0x017D9, 0x017DA, 0x017DB, 0x017DC, 0x00000, 0x017DE, 0x017DF,
+        0x017E0, 0x017E1, 0x017E2, 0x017E3, 0x017E4, 0x017E5, 0x017E6, 0x017E7,
+        0x017E8, 0x017E9, 0x017EA, 0x017EB, 0x017EC, 0x017ED, 0x017EE, 0x017EF,
+        0x017F0, 0x017F1, 0x017F2, 0x017F3, 0x017F4, 0x017F5, 0x017F6, 0x017F7,
+        0x017F8, 0x017F9, 0x017FA, 0x017FB, 0x017FC, 0x017FD, 0x017FE, 0x017FF,
+    },
+    {
+        0x01800, 0x01801, 0x01802, 0x01803, 0x01804, 0x01805, 0x01806, 0x01807,
+        0x01808, 0x01809, 0x0180A, 0x00000, 0x00000, 0x00000, 0x0180E, 0x00000,
+        0x01810, 0x01811, 0x01812, 0x01813, 0x01814, 0x01815, 0x01816, 0x01817,
+        0x01818, 0x01819, 0x0181A, 0x0181B, 0x0181C, 0x0181D, 0x0181E, 0x0181F,
+        0x01820, 0x01821, 0x01822, 0x01823, 0x01824, 0x01825, 0x01826, 0x01827,
+        0x01828, 0x01829, 0x0182A, 0x0182B, 0x0182C, 0x0182D, 0x0182E, 0x0182F,
+        0x01830, 0x01831, 0x01832, 0x01833, 0x01834, 0x01835, 0x01836, 0x01837,
+        0x01838, 0x01839, 0x0183A, 0x0183B, 0x0183C, 0x0183D, 0x0183E, 0x0183F,
+        0x01840, 0x01841, 0x01842, 0x01843, 0x01844, 0x01845, 0x01846, 0x01847,
+        0x01848, 0x01849, 0x0184A, 0x0184B, 0x0184C, 0x0184D, 0x0184E, 0x0184F,
+        0x01850, 0x01851, 0x01852, 0x01853, 0x01854, 0x01855, 0x01856, 0x01857,
+        0x01858, 0x01859, 0x0185A, 0x0185B, 0x0185C, 0x0185D, 0x0185E, 0x0185F,
+        0x01860, 0x01861, 0x01862, 0x01863, 0x01864, 0x01865, 0x01866, 0x01867,
+        0x01868, 0x01869, 0x0186A, 0x0186B, 0x0186C, 0x0186D, 0x0186E, 0x0186F,
+        0x01870, 0x01871, 0x01872, 0x01873, 0x01874, 0x01875, 0x01876, 0x01877,
+        0x01878, 0x01879, 0x0187A, 0x0187B, 0x0187C, 0x0187D, 0x0187E, 0x0187F,
+    },
+    {
+        0x01880, 0x01881, 0x01882, 0x01883, 0x01884, 0x00000, 0x00000, 0x01887,
+        0x01888, 0x01889, 0x0188A, 0x0188B, 0x0188C, 0x0188D, 0x0188E, 0x0188F,
+        0x01890, 0x01891, 0x01892, 0x01893, 0x01894, 0x01895, 0x01896, 0x01897,
+        0x01898, 0x01899, 0x0189A, 0x0189B, 0x0189C, 0x0189D, 0x0189E, 0x0189F,
+        0x018A0, 0x018A1, 0x018A2, 0x018A3, 0x018A4, 0x018A5, 0x018A6, 0x018A7,
+        0x018A8, 0x00000, 0x018AA, 0x018AB, 0x018AC, 0x018AD, 0x018AE, 0x018AF,
+        0x018B0, 0x018B1, 0x018B2, 0x018B3, 0x018B4, 0x018B5, 0x018B6, 0x018B7,
+        0x018B8, 0x018B9, 0x018BA, 0x018BB, 0x018BC, 0x018BD, 0x018BE, 0x018BF,
+        0x018C0, 0x018C1, 0x018C2, 0x018C3, 0x018C4, 0x018C5, 0x018C6, 0x018C7,
+        0x018C8, 0x018C9, 0x018CA, 0x018CB, 0x018CC, 0x018CD, 0x018CE, 0x018CF,
+        0x018D0, 0x018D1, 0x018D2, 0x018D3, 0x018D4, 0x018D5, 0x018D6, 0x018D7,
+        0x018D8, 0x018D9, 0x018DA, 0x018DB, 0x018DC, 0x018DD, 0x018DE, 0x018DF,
+        0x018E0, 0x018E1, 0x018E2, 0x018E3, 0x018E4, 0x018E5, 0x018E6, 0x018E7,
+        0x018E8, 0x018E9, 0x018EA, 0x018EB, 0x018EC, 0x018ED, 0x018EE, 0x018EF,
+        0x018F0, 0x018F1, 0x018F2, 0x018F3, 0x018F4, 0x018F5, 0x018F6, 0x018F7,
+        0x018F8, 0x018F9, 0x018FA, 0x018FB, 0x018FC, 0x018FD, 0x018FE, 0x018FF,
+    },
+    {
+        0x01900, 0x01901, 0x01902, 0x01903, 0x01904, 0x01905, 0x01906, 0x01907,
+        0x01908, 0x01909, 0x0190A, 0x0190B, 0x0190C, 0x0190D, 0x0190E, 0x0190F,
+        0x01910, 0x01911, 0x01912, 0x01913, 0x01914, 0x01915, 0x01916, 0x01917,
+        0x01918, 0x01919, 0x0191A, 0x0191B, 0x0191C, 0x0191D, 0x0191E, 0x0191F,
+        0x00000, 0x00000, 0x00000, 0x01923, 0x01924, 0x01925, 0x01926, 0x00000,
+        0x00000, 0x01929, 0x0192A, 0x0192B, 0x0192C, 0x0192D, 0x0192E, 0x0192F,
+        0x01930, 0x01931, 0x00000, 0x01933, 0x01934, 0x01935, 0x01936, 0x01937,
+        0x01938, 0x00000, 0x00000, 0x00000, 0x0193C, 0x0193D, 0x0193E, 0x0193F,
+        0x01940, 0x01941, 0x01942, 0x01943, 0x01944, 0x01945, 0x01946, 0x01947,
+        0x01948, 0x01949, 0x0194A, 0x0194B, 0x0194C, 0x0194D, 0x0194E, 0x0194F,
+        0x01950, 0x01951, 0x01952, 0x01953, 0x01954, 0x01955, 0x01956, 0x01957,
+        0x01958, 0x01959, 0x0195A, 0x0195B, 0x0195C, 0x0195D, 0x0195E, 0x0195F,
+        0x01960, 0x01961, 0x01962, 0x01963, 0x01964, 0x01965, 0x01966, 0x01967,
+        0x01968, 0x01969, 0x0196A, 0x0196B, 0x0196C, 0x0196D, 0x0196E, 0x0196F,
+        0x01970, 0x01971, 0x01972, 0x01973, 0x01974, 0x01975, 0x01976, 0x01977,
+        0x01978, 0x01979, 0x0197A, 0x0197B, 0x0197C, 0x0197D, 0x0197E, 0x0197F,
+    },
+    {
+        0x01A00, 0x01A01, 0x01A02, 0x01A03, 0x01A04, 0x01A05, 0x01A06, 0x01A07,
+        0x01A08, 0x01A09, 0x01A0A, 0x01A0B, 0x01A0C, 0x01A0D, 0x01A0E, 0x01A0F,
+        0x01A10, 0x01A11, 0x01A12, 0x01A13, 0x01A14, 0x01A15, 0x01A16, 0x00000,
+        0x00000, 0x01A19, 0x01A1A, 0x00000, 0x01A1C, 0x01A1D, 0x01A1E, 0x01A1F,
+        0x01A20, 0x01A21, 0x01A22, 0x01A23, 0x01A24, 0x01A25, 0x01A26, 0x01A27,
+        0x01A28, 0x01A29, 0x01A2A, 0x01A2B, 0x01A2C, 0x01A2D, 0x01A2E, 0x01A2F,
+        0x01A30, 0x01A31, 0x01A32, 0x01A33, 0x01A34, 0x01A35, 0x01A36, 0x01A37,
+        0x01A38, 0x01A39, 0x01A3A, 0x01A3B, 0x01A3C, 0x01A3D, 0x01A3E, 0x01A3F,
+        0x01A40, 0x01A41, 0x01A42, 0x01A43, 0x01A44, 0x01A45, 0x01A46, 0x01A47,
+        0x01A48, 0x01A49, 0x01A4A, 0x01A4B, 0x01A4C, 0x01A4D, 0x01A4E, 0x01A4F,
+        0x01A50, 0x01A51, 0x01A52, 0x01A53, 0x01A54, 0x01A55, 0x00000, 0x01A57,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x01A5F,
+        0x00000, 0x01A61, 0x00000, 0x01A63, 0x01A64, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x01A6D, 0x01A6E, 0x01A6F,
+        0x01A70, 0x01A71, 0x01A72, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x01A7D, 0x01A7E, 0x00000,
+    },
+    {
+        0x01A80, 0x01A81, 0x01A82, 0x01A83, 0x01A84, 0x01A85, 0x01A86, 0x01A87,
+        0x01A88, 0x01A89, 0x01A8A, 0x01A8B, 0x01A8C, 0x01A8D, 0x01A8E, 0x01A8F,
+        0x01A90, 0x01A91, 0x01A92, 0x01A93, 0x01A94, 0x01A95, 0x01A96, 0x01A97,
+        0x01A98, 0x01A99, 0x01A9A, 0x01A9B, 0x01A9C, 0x01A9D, 0x01A9E, 0x01A9F,
+        0x01AA0, 0x01AA1, 0x01AA2, 0x01AA3, 0x01AA4, 0x01AA5, 0x01AA6, 0x01AA7,
+        0x01AA8, 0x01AA9, 0x01AAA, 0x01AAB, 0x01AAC, 0x01AAD, 0x01AAE, 0x01AAF,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x01ABE, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x01ACF,
+        0x01AD0, 0x01AD1, 0x01AD2, 0x01AD3, 0x01AD4, 0x01AD5, 0x01AD6, 0x01AD7,
+        0x01AD8, 0x01AD9, 0x01ADA, 0x01ADB, 0x01ADC, 0x01ADD, 0x01ADE, 0x01ADF,
+        0x01AE0, 0x01AE1, 0x01AE2, 0x01AE3, 0x01AE4, 0x01AE5, 0x01AE6, 0x01AE7,
+        0x01AE8, 0x01AE9, 0x01AEA, 0x01AEB, 0x01AEC, 0x01AED, 0x01AEE, 0x01AEF,
+        0x01AF0, 0x01AF1, 0x01AF2, 0x01AF3, 0x01AF4, 0x01AF5, 0x01AF6, 0x01AF7,
+        0x01AF8, 0x01AF9, 0x01AFA, 0x01AFB, 0x01AFC, 0x01AFD, 0x01AFE, 0x01AFF,
+    },
+    {
+        0x00000, 0x00000, 0x00000, 0x00000, 0x01B04, 0x01B05, 0x8000000E, 0x01B07,
+        0x8000000F, 0x01B09, 0x80000010, 0x01B0B, 0x80000011, 0x01B0D, 0x80000012, 0x01B0F,
+        0x01B10, 0x01B11, 0x80000013, 0x01B13, 0x01B14, 0x01B15, 0x01B16, 0x01B17,
+        0x01B18, 0x01B19, 0x01B1A, 0x01B1B, 0x01B1C, 0x01B1D, 0x01B1E, 0x01B1F,
+        0x01B20, 0x01B21, 0x01B22, 0x01B23, 0x01B24, 0x01B25, 0x01B26, 0x01B27,
+        0x01B28, 0x01B29, 0x01B2A, 0x01B2B, 0x01B2C, 0x01B2D, 0x01B2E, 0x01B2F,
+        0x01B30, 0x01B31, 0x01B32, 0x01B33, 0x00000, 0x01B35, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x01B35, 0x00000, 0x01B35, 0x01B3E, 0x01B3F,
+        0x80000014, 0x80000015, 0x00000, 0x01B35, 0x01B44, 0x01B45, 0x01B46, 0x01B47,
+        0x01B48, 0x01B49, 0x01B4A, 0x01B4B, 0x01B4C, 0x01B4D, 0x01B4E, 0x01B4F,
+        0x01B50, 0x01B51, 0x01B52, 0x01B53, 0x01B54, 0x01B55, 0x01B56, 0x01B57,
+        0x01B58, 0x01B59, 0x01B5A, 0x01B5B, 0x01B5C, 0x01B5D, 0x01B5E, 0x01B5F,
+        0x01B60, 0x01B61, 0x01B62, 0x01B63, 0x01B64, 0x01B65, 0x01B66, 0x01B67,
+        0x01B68, 0x01B69, 0x01B6A, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x01B74, 0x01B75, 0x01B76, 0x01B77,
+        0x01B78, 0x01B79, 0x01B7A, 0x01B7B, 0x01B7C, 0x01B7D, 0x01B7E, 0x01B7F,
+    },
+    {
+        0x00000, 0x00000, 0x01B82, 0x01B83, 0x01B84, 0x01B85, 0x01B86, 0x01B87,
+        0x01B88, 0x01B89, 0x01B8A, 0x01B8B, 0x01B8C, 0x01B8D, 0x01B8E, 0x01B8F,
+        0x01B90, 0x01B91, 0x01B92, 0x01B93, 0x01B94, 0x01B95, 0x01B96, 0x01B97,
+        0x01B98, 0x01B99, 0x01B9A, 0x01B9B, 0x01B9C, 0x01B9D, 0x01B9E, 0x01B9F,
+        0x01BA0, 0x01BA1, 0x00000, 0x00000, 0x00000, 0x00000, 0x01BA6, 0x01BA7,
+        0x00000, 0x00000, 0x01BAA, 0x00000, 0x00000, 0x00000, 0x01BAE, 0x01BAF,
+        0x01BB0, 0x01BB1, 0x01BB2, 0x01BB3, 0x01BB4, 0x01BB5, 0x01BB6, 0x01BB7,
+        0x01BB8, 0x01BB9, 0x01BBA, 0x01BBB, 0x01BBC, 0x01BBD, 0x01BBE, 0x01BBF,
+        0x01BC0, 0x01BC1, 0x01BC2, 0x01BC3, 0x01BC4, 0x01BC5, 0x01BC6, 0x01BC7,
+        0x01BC8, 0x01BC9, 0x01BCA, 0x01BCB, 0x01BCC, 0x01BCD, 0x01BCE, 0x01BCF,
+        0x01BD0, 0x01BD1, 0x01BD2, 0x01BD3, 0x01BD4, 0x01BD5, 0x01BD6, 0x01BD7,
+        0x01BD8, 0x01BD9, 0x01BDA, 0x01BDB, 0x01BDC, 0x01BDD, 0x01BDE, 0x01BDF,
+        0x01BE0, 0x01BE1, 0x01BE2, 0x01BE3, 0x01BE4, 0x01BE5, 0x00000, 0x01BE7,
+        0x00000, 0x00000, 0x01BEA, 0x01BEB, 0x01BEC, 0x00000, 0x01BEE, 0x00000,
+        0x00000, 0x00000, 0x01BF2, 0x01BF3, 0x01BF4, 0x01BF5, 0x01BF6, 0x01BF7,
+        0x01BF8, 0x01BF9, 0x01BFA, 0x01BFB, 0x01BFC, 0x01BFD, 0x01BFE, 0x01BFF,
+    },
+    {
+        0x01C00, 0x01C01, 0x01C02, 0x01C03, 0x01C04, 0x01C05, 0x01C06, 0x01C07,
+        0x01C08, 0x01C09, 0x01C0A, 0x01C0B, 0x01C0C, 0x01C0D, 0x01C0E, 0x01C0F,
+        0x01C10, 0x01C11, 0x01C12, 0x01C13, 0x01C14, 0x01C15, 0x01C16, 0x01C17,
+        0x01C18, 0x01C19, 0x01C1A, 0x01C1B, 0x01C1C, 0x01C1D, 0x01C1E, 0x01C1F,
+        0x01C20, 0x01C21, 0x01C22, 0x01C23, 0x01C24, 0x01C25, 0x01C26, 0x01C27,
+        0x01C28, 0x01C29, 0x01C2A, 0x01C2B, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x01C34, 0x01C35, 0x00000, 0x00000,
+        0x01C38, 0x01C39, 0x01C3A, 0x01C3B, 0x01C3C, 0x01C3D, 0x01C3E, 0x01C3F,
+        0x01C40, 0x01C41, 0x01C42, 0x01C43, 0x01C44, 0x01C45, 0x01C46, 0x01C47,
+        0x01C48, 0x01C49, 0x01C4A, 0x01C4B, 0x01C4C, 0x01C4D, 0x01C4E, 0x01C4F,
+        0x01C50, 0x01C51, 0x01C52, 0x01C53, 0x01C54, 0x01C55, 0x01C56, 0x01C57,
+        0x01C58, 0x01C59, 0x01C5A, 0x01C5B, 0x01C5C, 0x01C5D, 0x01C5E, 0x01C5F,
+        0x01C60, 0x01C61, 0x01C62, 0x01C63, 0x01C64, 0x01C65, 0x01C66, 0x01C67,
+        0x01C68, 0x01C69, 0x01C6A, 0x01C6B, 0x01C6C, 0x01C6D, 0x01C6E, 0x01C6F,
+        0x01C70, 0x01C71, 0x01C72, 0x01C73, 0x01C74, 0x01C75, 0x01C76, 0x01C77,
+        0x01C78, 0x01C79, 0x01C7A, 0x01C7B, 0x01C7C, 0x01C7D, 0x01C7E, 0x01C7F,
+    },
+    {
+        0x01C80, 0x01C81, 0x01C82, 0x01C83, 0x01C84, 0x01C85, 0x01C86, 0x01C87,
+        0x01C88, 0x01C89, 0x01C8A, 0x01C8B, 0x01C8C, 0x01C8D, 0x01C8E, 0x01C8F,
+        0x010D0, 0x010D1, 0x010D2, 0x010D3, 0x010D4, 0x010D5, 0x010D6, 0x010D7,
+        0x010D8, 0x010D9, 0x010DA, 0x010DB, 0x010DC, 0x010DD, 0x010DE, 0x010DF,
+        0x010E0, 0x010E1, 0x010E2, 0x010E3, 0x010E4, 0x010E5, 0x010E6, 0x010E7,
+        0x010E8, 0x010E9, 0x010EA, 0x010EB, 0x010EC, 0x010ED, 0x010EE, 0x010EF,
+        0x010F0, 0x010F1, 0x010F2, 0x010F3, 0x010F4, 0x010F5, 0x010F6, 0x010F7,
+        0x010F8, 0x010F9, 0x010FA, 0x01CBB, 0x01CBC, 0x010FD, 0x010FE, 0x010FF,
+        0x01CC0, 0x01CC1, 0x01CC2, 0x01CC3, 0x01CC4, 0x01CC5, 0x01CC6, 0x01CC7,
+        0x01CC8, 0x01CC9, 0x01CCA, 0x01CCB, 0x01CCC, 0x01CCD, 0x01CCE, 0x01CCF,
+        0x00000, 0x00000, 0x00000, 0x01CD3, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x01CE1, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x01CE9, 0x01CEA, 0x01CEB, 0x01CEC, 0x00000, 0x01CEE, 0x01CEF,
+        0x01CF0, 0x01CF1, 0x01CF2, 0x01CF3, 0x00000, 0x01CF5, 0x01CF6, 0x01CF7,
+        0x00000, 0x00000, 0x01CFA, 0x01CFB, 0x01CFC, 0x01CFD, 0x01CFE, 0x01CFF,
+    },
+    {
+        0x01D80, 0x01D81, 0x01D82, 0x01D83, 0x01D84, 0x01D85, 0x01D86, 0x01D87,
+        0x01D88, 0x01D89, 0x01D8A, 0x01D8B, 0x01D8C, 0x01D8D, 0x01D8E, 0x01D8F,
+        0x01D90, 0x01D91, 0x01D92, 0x01D93, 0x01D94, 0x01D95, 0x01D96, 0x01D97,
+        0x01D98, 0x01D99, 0x01D9A, 0x01D9B, 0x01D9C, 0x01D9D, 0x01D9E, 0x01D9F,
+        0x01DA0, 0x01DA1, 0x01DA2, 0x01DA3, 0x01DA4, 0x01DA5, 0x01DA6, 0x01DA7,
+        0x01DA8, 0x01DA9, 0x01DAA, 0x01DAB, 0x01DAC, 0x01DAD, 0x01DAE, 0x01DAF,
+        0x01DB0, 0x01DB1, 0x01DB2, 0x01DB3, 0x01DB4, 0x01DB5, 0x01DB6, 0x01DB7,
+        0x01DB8, 0x01DB9, 0x01DBA, 0x01DBB, 0x01DBC, 0x01DBD, 0x01DBE, 0x01DBF,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+    },
+    {
+        0x00061, 0x00061, 0x00062, 0x00062, 0x00062, 0x00062, 0x00062, 0x00062,
+        0x00063, 0x00063, 0x00064, 0x00064, 0x00064, 0x00064, 0x00064, 0x00064,
+        0x00064, 0x00064, 0x00064, 0x00064, 0x00065, 0x00065, 0x00065, 0x00065,
+        0x00065, 0x00065, 0x00065, 0x00065, 0x00065, 0x00065, 0x00066, 0x00066,
+        0x00067, 0x00067, 0x00068, 0x00068, 0x00068, 0x00068, 0x00068, 0x00068,
+        0x00068, 0x00068, 0x00068, 0x00068, 0x00069, 0x00069, 0x00069, 0x00069,
+        0x0006B, 0x0006B, 0x0006B, 0x0006B, 0x0006B, 0x0006B, 0x0006C, 0x0006C,
+        0x0006C, 0x0006C, 0x0006C, 0x0006C, 0x0006C, 0x0006C, 0x0006D, 0x0006D,
+        0x0006D, 0x0006D, 0x0006D, 0x0006D, 0x0006E, 0x0006E, 0x0006E, 0x0006E,
+        0x0006E, 0x0006E, 0x0006E, 0x0006E, 0x0006F, 0x0006F, 0x0006F, 0x0006F,
+        0x0006F, 0x0006F, 0x0006F, 0x0006F, 0x00070, 0x00070, 0x00070, 0x00070,
+        0x00072, 0x00072, 0x00072, 0x00072, 0x00072, 0x00072, 0x00072, 0x00072,
+        0x00073, 0x00073, 0x00073, 0x00073, 0x00073, 0x00073, 0x00073, 0x00073,
+        0x00073, 0x00073, 0x00074, 0x00074, 0x00074, 0x00074, 0x00074, 0x00074,
+        0x00074, 0x00074, 0x00075, 0x00075, 0x00075, 0x00075, 0x00075, 0x00075,
+        0x00075, 0x00075, 0x00075, 0x00075, 0x00076, 0x00076, 0x00076, 0x00076,
+    },
+    {
+        0x00077, 0x00077, 0x00077, 0x00077, 0x00077, 0x00077, 0x00077, 0x00077,
+        0x00077, 0x00077, 0x00078, 0x00078, 0x00078, 0x00078, 0x00079, 0x00079,
+        0x0007A, 0x0007A, 0x0007A, 0x0007A, 0x0007A, 0x0007A, 0x00068, 0x00074,
+        0x00077, 0x00079, 0x01E9A, 0x0017F, 0x01E9C, 0x01E9D, 0x000DF, 0x01E9F,
+        0x00061, 0x00061, 0x00061, 0x00061, 0x00061, 0x00061, 0x00061, 0x00061,
+        0x00061, 0x00061, 0x00061, 0x00061, 0x00061, 0x00061, 0x00061, 0x00061,
+        0x00061, 0x00061, 0x00061, 0x00061, 0x00061, 0x00061, 0x00061, 0x00061,
+        0x00065, 0x00065, 0x00065, 0x00065, 0x00065, 0x00065, 0x00065, 0x00065,
+        0x00065, 0x00065, 0x00065, 0x00065, 0x00065, 0x00065, 0x00065, 0x00065,
+        0x00069, 0x00069, 0x00069, 0x00069, 0x0006F, 0x0006F, 0x0006F, 0x0006F,
+        0x0006F, 0x0006F, 0x0006F, 0x0006F, 0x0006F, 0x0006F, 0x0006F, 0x0006F,
+        0x0006F, 0x0006F, 0x0006F, 0x0006F, 0x0006F, 0x0006F, 0x0006F, 0x0006F,
+        0x0006F, 0x0006F, 0x0006F, 0x0006F, 0x00075, 0x00075, 0x00075, 0x00075,
+        0x00075, 0x00075, 0x00075, 0x00075, 0x00075, 0x00075, 0x00075, 0x00075,
+        0x00075, 0x00075, 0x00079, 0x00079, 0x00079, 0x00079, 0x00079, 0x00079,
+        0x00079, 0x00079, 0x01EFB, 0x01EFB, 0x01EFD, 0x01EFD, 0x01EFF, 0x01EFF,
+    },
+    {
+        0x003B1, 0x003B1, 0x003B1, 0x003B1, 0x003B1, 0x003B1, 0x003B1, 0x003B1,
+        0x003B1, 0x003B1, 0x003B1, 0x003B1, 0x003B1, 0x003B1, 0x003B1, 0x003B1,
+        0x003B5, 0x003B5, 0x003B5, 0x003B5, 0x003B5, 0x003B5, 0x01F16, 0x01F17,
+        0x003B5, 0x003B5, 0x003B5, 0x003B5, 0x003B5, 0x003B5, 0x01F1E, 0x01F1F,
+        0x003B7, 0x003B7, 0x003B7, 0x003B7, 0x003B7, 0x003B7, 0x003B7, 0x003B7,
+        0x003B7, 0x003B7, 0x003B7, 0x003B7, 0x003B7, 0x003B7, 0x003B7, 0x003B7,
+        0x003B9, 0x003B9, 0x003B9, 0x003B9, 0x003B9, 0x003B9, 0x003B9, 0x003B9,
+        0x003B9, 0x003B9, 0x003B9, 0x003B9, 0x003B9, 0x003B9, 0x003B9, 0x003B9,
+        0x003BF, 0x003BF, 0x003BF, 0x003BF, 0x003BF, 0x003BF, 0x01F46, 0x01F47,
+        0x003BF, 0x003BF, 0x003BF, 0x003BF, 0x003BF, 0x003BF, 0x01F4E, 0x01F4F,
+        0x003C5, 0x003C5, 0x003C5, 0x003C5, 0x003C5, 0x003C5, 0x003C5, 0x003C5,
+        0x01F58, 0x003C5, 0x01F5A, 0x003C5, 0x01F5C, 0x003C5, 0x01F5E, 0x003C5,
+        0x003C9, 0x003C9, 0x003C9, 0x003C9, 0x003C9, 0x003C9, 0x003C9, 0x003C9,
+        0x003C9, 0x003C9, 0x003C9, 0x003C9, 0x003C9, 0x003C9, 0x003C9, 0x003C9,
+        0x003B1, 0x003B1, 0x003B5, 0x003B5, 0x003B7, 0x003B7, 0x003B9, 0x003B9,
+        0x003BF, 0x003BF, 0x003C5, 0x003C5, 0x003C9, 0x003C9, 0x01F7E, 0x01F7F,
+    },
+    {
+        0x003B1, 0x003B1, 0x003B1, 0x003B1, 0x003B1, 0x003B1, 0x003B1, 0x003B1,
+        0x003B1, 0x003B1, 0x003B1, 0x003B1, 0x003B1, 0x003B1, 0x003B1, 0x003B1,
+        0x003B7, 0x003B7, 0x003B7, 0x003B7, 0x003B7, 0x003B7, 0x003B7, 0x003B7,
+        0x003B7, 0x003B7, 0x003B7, 0x003B7, 0x003B7, 0x003B7, 0x003B7, 0x003B7,
+        0x003C9, 0x003C9, 0x003C9, 0x003C9, 0x003C9, 0x003C9, 0x003C9, 0x003C9,
+        0x003C9, 0x003C9, 0x003C9, 0x003C9, 0x003C9, 0x003C9, 0x003C9, 0x003C9,
+        0x003B1, 0x003B1, 0x003B1, 0x003B1, 0x003B1, 0x01FB5, 0x003B1, 0x003B1,
+        0x003B1, 0x003B1, 0x003B1, 0x003B1, 0x003B1, 0x01FBD, 0x003B9, 0x01FBF,
+        0x01FC0, 0x000A8, 0x003B7, 0x003B7, 0x003B7, 0x01FC5, 0x003B7, 0x003B7,
+        0x003B5, 0x003B5, 0x003B7, 0x003B7, 0x003B7, 0x01FBF, 0x01FBF, 0x01FBF,
+        0x003B9, 0x003B9, 0x003B9, 0x003B9, 0x01FD4, 0x01FD5, 0x003B9, 0x003B9,
+        0x003B9, 0x003B9, 0x003B9, 0x003B9, 0x01FDC, 0x01FFE, 0x01FFE, 0x01FFE,
+        0x003C5, 0x003C5, 0x003C5, 0x003C5, 0x003C1, 0x003C1, 0x003C5, 0x003C5,
+        0x003C5, 0x003C5, 0x003C5, 0x003C5, 0x003C1, 0x000A8, 0x000A8, 0x00060,
+        0x01FF0, 0x01FF1, 0x003C9, 0x003C9, 0x003C9, 0x01FF5, 0x003C9, 0x003C9,
+        0x003BF, 0x003BF, 0x003C9, 0x003C9, 0x003C9, 0x000B4, 0x01FFE, 0x01FFF,
+    },
+    {
+        0x02002, 0x02003, 0x02002, 0x02003, 0x02004, 0x02005, 0x02006, 0x02007,
+        0x02008, 0x02009, 0x0200A, 0x0200B, 0x0200C, 0x0200D, 0x0200E, 0x0200F,
+        0x02010, 0x02011, 0x02012, 0x02013, 0x02014, 0x02015, 0x02016, 0x02017,
+        0x02018, 0x02019, 0x0201A, 0x0201B, 0x0201C, 0x0201D, 0x0201E, 0x0201F,
+        0x02020, 0x02021, 0x02022, 0x02023, 0x02024, 0x02025, 0x02026, 0x02027,
+        0x02028, 0x02029, 0x0202A, 0x0202B, 0x0202C, 0x0202D, 0x0202E, 0x0202F,
+        0x02030, 0x02031, 0x02032, 0x02033, 0x02034, 0x02035, 0x02036, 0x02037,
+        0x02038, 0x02039, 0x0203A, 0x0203B, 0x0203C, 0x0203D, 0x0203E, 0x0203F,
+        0x02040, 0x02041, 0x02042, 0x02043, 0x02044, 0x02045, 0x02046, 0x02047,
+        0x02048, 0x02049, 0x0204A, 0x0204B, 0x0204C, 0x0204D, 0x0204E, 0x0204F,
+        0x02050, 0x02051, 0x02052, 0x02053, 0x02054, 0x02055, 0x02056, 0x02057,
+        0x02058, 0x02059, 0x0205A, 0x0205B, 0x0205C, 0x0205D, 0x0205E, 0x0205F,
+        0x02060, 0x02061, 0x02062, 0x02063, 0x02064, 0x02065, 0x02066, 0x02067,
+        0x02068, 0x02069, 0x0206A, 0x0206B, 0x0206C, 0x0206D, 0x0206E, 0x0206F,
+        0x02070, 0x02071, 0x02072, 0x02073, 0x02074, 0x02075, 0x02076, 0x02077,
+        0x02078, 0x02079, 0x0207A, 0x0207B, 0x0207C, 0x0207D, 0x0207E, 0x0207F,
+    },
+    {
+        0x02080, 0x02081, 0x02082, 0x02083, 0x02084, 0x02085, 0x02086, 0x02087,
+        0x02088, 0x02089, 0x0208A, 0x0208B, 0x0208C, 0x0208D, 0x0208E, 0x0208F,
+        0x02090, 0x02091, 0x02092, 0x02093, 0x02094, 0x02095, 0x02096, 0x02097,
+        0x02098, 0x02099, 0x0209A, 0x0209B, 0x0209C, 0x0209D, 0x0209E, 0x0209F,
+        0x020A0, 0x020A1, 0x020A2, 0x020A3, 0x020A4, 0x020A5, 0x020A6, 0x020A7,
+        0x020A8, 0x020A9, 0x020AA, 0x020AB, 0x020AC, 0x020AD, 0x020AE, 0x020AF,
+        0x020B0, 0x020B1, 0x020B2, 0x020B3, 0x020B4, 0x020B5, 0x020B6, 0x020B7,
+        0x020B8, 0x020B9, 0x020BA, 0x020BB, 0x020BC, 0x020BD, 0x020BE, 0x020BF,
+        0x020C0, 0x020C1, 0x020C2, 0x020C3, 0x020C4, 0x020C5, 0x020C6, 0x020C7,
+        0x020C8, 0x020C9, 0x020CA, 0x020CB, 0x020CC, 0x020CD, 0x020CE, 0x020CF,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x020DD, 0x020DE, 0x020DF,
+        0x020E0, 0x00000, 0x020E2, 0x020E3, 0x020E4, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x020F1, 0x020F2, 0x020F3, 0x020F4, 0x020F5, 0x020F6, 0x020F7,
+        0x020F8, 0x020F9, 0x020FA, 0x020FB, 0x020FC, 0x020FD, 0x020FE, 0x020FF,
+    },
+    {
+        0x02100, 0x02101, 0x02102, 0x02103, 0x02104, 0x02105, 0x02106, 0x02107,
+        0x02108, 0x02109, 0x0210A, 0x0210B, 0x0210C, 0x0210D, 0x0210E, 0x0210F,
+        0x02110, 0x02111, 0x02112, 0x02113, 0x02114, 0x02115, 0x02116, 0x02117,
+        0x02118, 0x02119, 0x0211A, 0x0211B, 0x0211C, 0x0211D, 0x0211E, 0x0211F,
+        0x02120, 0x02121, 0x02122, 0x02123, 0x02124, 0x02125, 0x003C9, 0x02127,
+        0x02128, 0x02129, 0x0006B, 0x00061, 0x0212C, 0x0212D, 0x0212E, 0x0212F,
+        0x02130, 0x02131, 0x0214E, 0x02133, 0x02134, 0x02135, 0x02136, 0x02137,
+        0x02138, 0x02139, 0x0213A, 0x0213B, 0x0213C, 0x0213D, 0x0213E, 0x0213F,
+        0x02140, 0x02141, 0x02142, 0x02143, 0x02144, 0x02145, 0x02146, 0x02147,
+        0x02148, 0x02149, 0x0214A, 0x0214B, 0x0214C, 0x0214D, 0x0214E, 0x0214F,
+        0x02150, 0x02151, 0x02152, 0x02153, 0x02154, 0x02155, 0x02156, 0x02157,
+        0x02158, 0x02159, 0x0215A, 0x0215B, 0x0215C, 0x0215D, 0x0215E, 0x0215F,
+        0x02170, 0x02171, 0x02172, 0x02173, 0x02174, 0x02175, 0x02176, 0x02177,
+        0x02178, 0x02179, 0x0217A, 0x0217B, 0x0217C, 0x0217D, 0x0217E, 0x0217F,
+        0x02170, 0x02171, 0x02172, 0x02173, 0x02174, 0x02175, 0x02176, 0x02177,
+        0x02178, 0x02179, 0x0217A, 0x0217B, 0x0217C, 0x0217D, 0x0217E, 0x0217F,
+    },
+    {
+        0x02180, 0x02181, 0x02182, 0x02184, 0x02184, 0x02185, 0x02186, 0x02187,
+        0x02188, 0x02189, 0x0218A, 0x0218B, 0x0218C, 0x0218D, 0x0218E, 0x0218F,
+        0x02190, 0x02191, 0x02192, 0x02193, 0x02194, 0x02195, 0x02196, 0x02197,
+        0x02198, 0x02199, 0x02190, 0x02192, 0x0219C, 0x0219D, 0x0219E, 0x0219F,
+        0x021A0, 0x021A1, 0x021A2, 0x021A3, 0x021A4, 0x021A5, 0x021A6, 0x021A7,
+        0x021A8, 0x021A9, 0x021AA, 0x021AB, 0x021AC, 0x021AD, 0x02194, 0x021AF,
+        0x021B0, 0x021B1, 0x021B2, 0x021B3, 0x021B4, 0x021B5, 0x021B6, 0x021B7,
+        0x021B8, 0x021B9, 0x021BA, 0x021BB, 0x021BC, 0x021BD, 0x021BE, 0x021BF,
+        0x021C0, 0x021C1, 0x021C2, 0x021C3, 0x021C4, 0x021C5, 0x021C6, 0x021C7,
+        0x021C8, 0x021C9, 0x021CA, 0x021CB, 0x021CC, 0x021D0, 0x021D4, 0x021D2,
+        0x021D0, 0x021D1, 0x021D2, 0x021D3, 0x021D4, 0x021D5, 0x021D6, 0x021D7,
+        0x021D8, 0x021D9, 0x021DA, 0x021DB, 0x021DC, 0x021DD, 0x021DE, 0x021DF,
+        0x021E0, 0x021E1, 0x021E2, 0x021E3, 0x021E4, 0x021E5, 0x021E6, 0x021E7,
+        0x021E8, 0x021E9, 0x021EA, 0x021EB, 0x021EC, 0x021ED, 0x021EE, 0x021EF,
+        0x021F0, 0x021F1, 0x021F2, 0x021F3, 0x021F4, 0x021F5, 0x021F6, 0x021F7,
+        0x021F8, 0x021F9, 0x021FA, 0x021FB, 0x021FC, 0x021FD, 0x021FE, 0x021FF,
+    },
+    {
+        0x02200, 0x02201, 0x02202, 0x02203, 0x02203, 0x02205, 0x02206, 0x02207,
+        0x02208, 0x02208, 0x0220A, 0x0220B, 0x0220B, 0x0220D, 0x0220E, 0x0220F,
+        0x02210, 0x02211, 0x02212, 0x02213, 0x02214, 0x02215, 0x02216, 0x02217,
+        0x02218, 0x02219, 0x0221A, 0x0221B, 0x0221C, 0x0221D, 0x0221E, 0x0221F,
+        0x02220, 0x02221, 0x02222, 0x02223, 0x02223, 0x02225, 0x02225, 0x02227,
+        0x02228, 0x02229, 0x0222A, 0x0222B, 0x0222C, 0x0222D, 0x0222E, 0x0222F,
+        0x02230, 0x02231, 0x02232, 0x02233, 0x02234, 0x02235, 0x02236, 0x02237,
+        0x02238, 0x02239, 0x0223A, 0x0223B, 0x0223C, 0x0223D, 0x0223E, 0x0223F,
+        0x02240, 0x0223C, 0x02242, 0x02243, 0x02243, 0x02245, 0x02246, 0x02245,
+        0x02248, 0x02248, 0x0224A, 0x0224B, 0x0224C, 0x0224D, 0x0224E, 0x0224F,
+        0x02250, 0x02251, 0x02252, 0x02253, 0x02254, 0x02255, 0x02256, 0x02257,
+        0x02258, 0x02259, 0x0225A, 0x0225B, 0x0225C, 0x0225D, 0x0225E, 0x0225F,
+        0x0003D, 0x02261, 0x02261, 0x02263, 0x02264, 0x02265, 0x02266, 0x02267,
+        0x02268, 0x02269, 0x0226A, 0x0226B, 0x0226C, 0x0224D, 0x0003C, 0x0003E,
+        0x02264, 0x02265, 0x02272, 0x02273, 0x02272, 0x02273, 0x02276, 0x02277,
+        0x02276, 0x02277, 0x0227A, 0x0227B, 0x0227C, 0x0227D, 0x0227E, 0x0227F,
+    },
+    {
+        0x0227A, 0x0227B, 0x02282, 0x02283, 0x02282, 0x02283, 0x02286, 0x02287,
+        0x02286, 0x02287, 0x0228A, 0x0228B, 0x0228C, 0x0228D, 0x0228E, 0x0228F,
+        0x02290, 0x02291, 0x02292, 0x02293, 0x02294, 0x02295, 0x02296, 0x02297,
+        0x02298, 0x02299, 0x0229A, 0x0229B, 0x0229C, 0x0229D, 0x0229E, 0x0229F,
+        0x022A0, 0x022A1, 0x022A2, 0x022A3, 0x022A4, 0x022A5, 0x022A6, 0x022A7,
+        0x022A8, 0x022A9, 0x022AA, 0x022AB, 0x022A2, 0x022A8, 0x022A9, 0x022AB,
+        0x022B0, 0x022B1, 0x022B2, 0x022B3, 0x022B4, 0x022B5, 0x022B6, 0x022B7,
+        0x022B8, 0x022B9, 0x022BA, 0x022BB, 0x022BC, 0x022BD, 0x022BE, 0x022BF,
+        0x022C0, 0x022C1, 0x022C2, 0x022C3, 0x022C4, 0x022C5, 0x022C6, 0x022C7,
+        0x022C8, 0x022C9, 0x022CA, 0x022CB, 0x022CC, 0x022CD, 0x022CE, 0x022CF,
+        0x022D0, 0x022D1, 0x022D2, 0x022D3, 0x022D4, 0x022D5, 0x022D6, 0x022D7,
+        0x022D8, 0x022D9, 0x022DA, 0x022DB, 0x022DC, 0x022DD, 0x022DE, 0x022DF,
+        0x0227C, 0x0227D, 0x02291, 0x02292, 0x022E4, 0x022E5, 0x022E6, 0x022E7,
+        0x022E8, 0x022E9, 0x022B2, 0x022B3, 0x022B4, 0x022B5, 0x022EE, 0x022EF,
+        0x022F0, 0x022F1, 0x022F2, 0x022F3, 0x022F4, 0x022F5, 0x022F6, 0x022F7,
+        0x022F8, 0x022F9, 0x022FA, 0x022FB, 0x022FC, 0x022FD, 0x022FE, 0x022FF,
+    },
+    {
+        0x02300, 0x02301, 0x02302, 0x02303, 0x02304, 0x02305, 0x02306, 0x02307,
+        0x02308, 0x02309, 0x0230A, 0x0230B, 0x0230C, 0x0230D, 0x0230E, 0x0230F,
+        0x02310, 0x02311, 0x02312, 0x02313, 0x02314, 0x02315, 0x02316, 0x02317,
+        0x02318, 0x02319, 0x0231A, 0x0231B, 0x0231C, 0x0231D, 0x0231E, 0x0231F,
+        0x02320, 0x02321, 0x02322, 0x02323, 0x02324, 0x02325, 0x02326, 0x02327,
+        0x02328, 0x03008, 0x03009, 0x0232B, 0x0232C, 0x0232D, 0x0232E, 0x0232F,
+        0x02330, 0x02331, 0x02332, 0x02333, 0x02334, 0x02335, 0x02336, 0x02337,
+        0x02338, 0x02339, 0x0233A, 0x0233B, 0x0233C, 0x0233D, 0x0233E, 0x0233F,
+        0x02340, 0x02341, 0x02342, 0x02343, 0x02344, 0x02345, 0x02346, 0x02347,
+        0x02348, 0x02349, 0x0234A, 0x0234B, 0x0234C, 0x0234D, 0x0234E, 0x0234F,
+        0x02350, 0x02351, 0x02352, 0x02353, 0x02354, 0x02355, 0x02356, 0x02357,
+        0x02358, 0x02359, 0x0235A, 0x0235B, 0x0235C, 0x0235D, 0x0235E, 0x0235F,
+        0x02360, 0x02361, 0x02362, 0x02363, 0x02364, 0x02365, 0x02366, 0x02367,
+        0x02368, 0x02369, 0x0236A, 0x0236B, 0x0236C, 0x0236D, 0x0236E, 0x0236F,
+        0x02370, 0x02371, 0x02372, 0x02373, 0x02374, 0x02375, 0x02376, 0x02377,
+        0x02378, 0x02379, 0x0237A, 0x0237B, 0x0237C, 0x0237D, 0x0237E, 0x0237F,
+    },
+    {
+        0x02480, 0x02481, 0x02482, 0x02483, 0x02484, 0x02485, 0x02486, 0x02487,
+        0x02488, 0x02489, 0x0248A, 0x0248B, 0x0248C, 0x0248D, 0x0248E, 0x0248F,
+        0x02490, 0x02491, 0x02492, 0x02493, 0x02494, 0x02495, 0x02496, 0x02497,
+        0x02498, 0x02499, 0x0249A, 0x0249B, 0x0249C, 0x0249D, 0x0249E, 0x0249F,
+        0x024A0, 0x024A1, 0x024A2, 0x024A3, 0x024A4, 0x024A5, 0x024A6, 0x024A7,
+        0x024A8, 0x024A9, 0x024AA, 0x024AB, 0x024AC, 0x024AD, 0x024AE, 0x024AF,
+        0x024B0, 0x024B1, 0x024B2, 0x024B3, 0x024B4, 0x024B5, 0x024D0, 0x024D1,
+        0x024D2, 0x024D3, 0x024D4, 0x024D5, 0x024D6, 0x024D7, 0x024D8, 0x024D9,
+        0x024DA, 0x024DB, 0x024DC, 0x024DD, 0x024DE, 0x024DF, 0x024E0, 0x024E1,
+        0x024E2, 0x024E3, 0x024E4, 0x024E5, 0x024E6, 0x024E7, 0x024E8, 0x024E9,
+        0x024D0, 0x024D1, 0x024D2, 0x024D3, 0x024D4, 0x024D5, 0x024D6, 0x024D7,
+        0x024D8, 0x024D9, 0x024DA, 0x024DB, 0x024DC, 0x024DD, 0x024DE, 0x024DF,
+        0x024E0, 0x024E1, 0x024E2, 0x024E3, 0x024E4, 0x024E5, 0x024E6, 0x024E7,
+        0x024E8, 0x024E9, 0x024EA, 0x024EB, 0x024EC, 0x024ED, 0x024EE, 0x024EF,
+        0x024F0, 0x024F1, 0x024F2, 0x024F3, 0x024F4, 0x024F5, 0x024F6, 0x024F7,
+        0x024F8, 0x024F9, 0x024FA, 0x024FB, 0x024FC, 0x024FD, 0x024FE, 0x024FF,
+    },
+    {
+        0x02A80, 0x02A81, 0x02A82, 0x02A83, 0x02A84, 0x02A85, 0x02A86, 0x02A87,
+        0x02A88, 0x02A89, 0x02A8A, 0x02A8B, 0x02A8C, 0x02A8D, 0x02A8E, 0x02A8F,
+        0x02A90, 0x02A91, 0x02A92, 0x02A93, 0x02A94, 0x02A95, 0x02A96, 0x02A97,
+        0x02A98, 0x02A99, 0x02A9A, 0x02A9B, 0x02A9C, 0x02A9D, 0x02A9E, 0x02A9F,
+        0x02AA0, 0x02AA1, 0x02AA2, 0x02AA3, 0x02AA4, 0x02AA5, 0x02AA6, 0x02AA7,
+        0x02AA8, 0x02AA9, 0x02AAA, 0x02AAB, 0x02AAC, 0x02AAD, 0x02AAE, 0x02AAF,
+        0x02AB0, 0x02AB1, 0x02AB2, 0x02AB3, 0x02AB4, 0x02AB5, 0x02AB6, 0x02AB7,
+        0x02AB8, 0x02AB9, 0x02ABA, 0x02ABB, 0x02ABC, 0x02ABD, 0x02ABE, 0x02ABF,
+        0x02AC0, 0x02AC1, 0x02AC2, 0x02AC3, 0x02AC4, 0x02AC5, 0x02AC6, 0x02AC7,
+        0x02AC8, 0x02AC9, 0x02ACA, 0x02ACB, 0x02ACC, 0x02ACD, 0x02ACE, 0x02ACF,
+        0x02AD0, 0x02AD1, 0x02AD2, 0x02AD3, 0x02AD4, 0x02AD5, 0x02AD6, 0x02AD7,
+        0x02AD8, 0x02AD9, 0x02ADA, 0x02ADB, 0x02ADD, 0x02ADD, 0x02ADE, 0x02ADF,
+        0x02AE0, 0x02AE1, 0x02AE2, 0x02AE3, 0x02AE4, 0x02AE5, 0x02AE6, 0x02AE7,
+        0x02AE8, 0x02AE9, 0x02AEA, 0x02AEB, 0x02AEC, 0x02AED, 0x02AEE, 0x02AEF,
+        0x02AF0, 0x02AF1, 0x02AF2, 0x02AF3, 0x02AF4, 0x02AF5, 0x02AF6, 0x02AF7,
+        0x02AF8, 0x02AF9, 0x02AFA, 0x02AFB, 0x02AFC, 0x02AFD, 0x02AFE, 0x02AFF,
+    },
+    {
+        0x02C30, 0x02C31, 0x02C32, 0x02C33, 0x02C34, 0x02C35, 0x02C36, 0x02C37,
+        0x02C38, 0x02C39, 0x02C3A, 0x02C3B, 0x02C3C, 0x02C3D, 0x02C3E, 0x02C3F,
+        0x02C40, 0x02C41, 0x02C42, 0x02C43, 0x02C44, 0x02C45, 0x02C46, 0x02C47,
+        0x02C48, 0x02C49, 0x02C4A, 0x02C4B, 0x02C4C, 0x02C4D, 0x02C4E, 0x02C4F,
+        0x02C50, 0x02C51, 0x02C52, 0x02C53, 0x02C54, 0x02C55, 0x02C56, 0x02C57,
+        0x02C58, 0x02C59, 0x02C5A, 0x02C5B, 0x02C5C, 0x02C5D, 0x02C5E, 0x02C5F,
+        0x02C30, 0x02C31, 0x02C32, 0x02C33, 0x02C34, 0x02C35, 0x02C36, 0x02C37,
+        0x02C38, 0x02C39, 0x02C3A, 0x02C3B, 0x02C3C, 0x02C3D, 0x02C3E, 0x02C3F,
+        0x02C40, 0x02C41, 0x02C42, 0x02C43, 0x02C44, 0x02C45, 0x02C46, 0x02C47,
+        0x02C48, 0x02C49, 0x02C4A, 0x02C4B, 0x02C4C, 0x02C4D, 0x02C4E, 0x02C4F,
+        0x02C50, 0x02C51, 0x02C52, 0x02C53, 0x02C54, 0x02C55, 0x02C56, 0x02C57,
+        0x02C58, 0x02C59, 0x02C5A, 0x02C5B, 0x02C5C, 0x02C5D, 0x02C5E, 0x02C5F,
+        0x02C61, 0x02C61, 0x0026B, 0x01D7D, 0x0027D, 0x02C65, 0x02C66, 0x02C68,
+        0x02C68, 0x02C6A, 0x02C6A, 0x02C6C, 0x02C6C, 0x00251, 0x00271, 0x00250,
+        0x00252, 0x02C71, 0x02C73, 0x02C73, 0x02C74, 0x02C76, 0x02C76, 0x02C77,
+        0x02C78, 0x02C79, 0x02C7A, 0x02C7B, 0x02C7C, 0x02C7D, 0x0023F, 0x00240,
+    },
+    {
+        0x02C81, 0x02C81, 0x02C83, 0x02C83, 0x02C85, 0x02C85, 0x02C87, 0x02C87,
+        0x02C89, 0x02C89, 0x02C8B, 0x02C8B, 0x02C8D, 0x02C8D, 0x02C8F, 0x02C8F,
+        0x02C91, 0x02C91, 0x02C93, 0x02C93, 0x02C95, 0x02C95, 0x02C97, 0x02C97,
+        0x02C99, 0x02C99, 0x02C9B, 0x02C9B, 0x02C9D, 0x02C9D, 0x02C9F, 0x02C9F,
+        0x02CA1, 0x02CA1, 0x02CA3, 0x02CA3, 0x02CA5, 0x02CA5, 0x02CA7, 0x02CA7,
+        0x02CA9, 0x02CA9, 0x02CAB, 0x02CAB, 0x02CAD, 0x02CAD, 0x02CAF, 0x02CAF,
+        0x02CB1, 0x02CB1, 0x02CB3, 0x02CB3, 0x02CB5, 0x02CB5, 0x02CB7, 0x02CB7,
+        0x02CB9, 0x02CB9, 0x02CBB, 0x02CBB, 0x02CBD, 0x02CBD, 0x02CBF, 0x02CBF,
+        0x02CC1, 0x02CC1, 0x02CC3, 0x02CC3, 0x02CC5, 0x02CC5, 0x02CC7, 0x02CC7,
+        0x02CC9, 0x02CC9, 0x02CCB, 0x02CCB, 0x02CCD, 0x02CCD, 0x02CCF, 0x02CCF,
+        0x02CD1, 0x02CD1, 0x02CD3, 0x02CD3, 0x02CD5, 0x02CD5, 0x02CD7, 0x02CD7,
+        0x02CD9, 0x02CD9, 0x02CDB, 0x02CDB, 0x02CDD, 0x02CDD, 0x02CDF, 0x02CDF,
+        0x02CE1, 0x02CE1, 0x02CE3, 0x02CE3, 0x02CE4, 0x02CE5, 0x02CE6, 0x02CE7,
+        0x02CE8, 0x02CE9, 0x02CEA, 0x02CEC, 0x02CEC, 0x02CEE, 0x02CEE, 0x00000,
+        0x00000, 0x00000, 0x02CF3, 0x02CF3, 0x02CF4, 0x02CF5, 0x02CF6, 0x02CF7,
+        0x02CF8, 0x02CF9, 0x02CFA, 0x02CFB, 0x02CFC, 0x02CFD, 0x02CFE, 0x02CFF,
+    },
+    {
+        0x02D00, 0x02D01, 0x02D02, 0x02D03, 0x02D04, 0x02D05, 0x02D06, 0x02D07,
+        0x02D08, 0x02D09, 0x02D0A, 0x02D0B, 0x02D0C, 0x02D0D, 0x02D0E, 0x02D0F,
+        0x02D10, 0x02D11, 0x02D12, 0x02D13, 0x02D14, 0x02D15, 0x02D16, 0x02D17,
+        0x02D18, 0x02D19, 0x02D1A, 0x02D1B, 0x02D1C, 0x02D1D, 0x02D1E, 0x02D1F,
+        0x02D20, 0x02D21, 0x02D22, 0x02D23, 0x02D24, 0x02D25, 0x02D26, 0x02D27,
+        0x02D28, 0x02D29, 0x02D2A, 0x02D2B, 0x02D2C, 0x02D2D, 0x02D2E, 0x02D2F,
+        0x02D30, 0x02D31, 0x02D32, 0x02D33, 0x02D34, 0x02D35, 0x02D36, 0x02D37,
+        0x02D38, 0x02D39, 0x02D3A, 0x02D3B, 0x02D3C, 0x02D3D, 0x02D3E, 0x02D3F,
+        0x02D40, 0x02D41, 0x02D42, 0x02D43, 0x02D44, 0x02D45, 0x02D46, 0x02D47,
+        0x02D48, 0x02D49, 0x02D4A, 0x02D4B, 0x02D4C, 0x02D4D, 0x02D4E, 0x02D4F,
+        0x02D50, 0x02D51, 0x02D52, 0x02D53, 0x02D54, 0x02D55, 0x02D56, 0x02D57,
+        0x02D58, 0x02D59, 0x02D5A, 0x02D5B, 0x02D5C, 0x02D5D, 0x02D5E, 0x02D5F,
+        0x02D60, 0x02D61, 0x02D62, 0x02D63, 0x02D64, 0x02D65, 0x02D66, 0x02D67,
+        0x02D68, 0x02D69, 0x02D6A, 0x02D6B, 0x02D6C, 0x02D6D, 0x02D6E, 0x02D6F,
+        0x02D70, 0x02D71, 0x02D72, 0x02D73, 0x02D74, 0x02D75, 0x02D76, 0x02D77,
+        0x02D78, 0x02D79, 0x02D7A, 0x02D7B, 0x02D7C, 0x02D7D, 0x02D7E, 0x00000,
+    },
+    {
+        0x02D80, 0x02D81, 0x02D82, 0x02D83, 0x02D84, 0x02D85, 0x02D86, 0x02D87,
+        0x02D88, 0x02D89, 0x02D8A, 0x02D8B, 0x02D8C, 0x02D8D, 0x02D8E, 0x02D8F,
+        0x02D90, 0x02D91, 0x02D92, 0x02D93, 0x02D94, 0x02D95, 0x02D96, 0x02D97,
+        0x02D98, 0x02D99, 0x02D9A, 0x02D9B, 0x02D9C, 0x02D9D, 0x02D9E, 0x02D9F,
+        0x02DA0, 0x02DA1, 0x02DA2, 0x02DA3, 0x02DA4, 0x02DA5, 0x02DA6, 0x02DA7,
+        0x02DA8, 0x02DA9, 0x02DAA, 0x02DAB, 0x02DAC, 0x02DAD, 0x02DAE, 0x02DAF,
+        0x02DB0, 0x02DB1, 0x02DB2, 0x02DB3, 0x02DB4, 0x02DB5, 0x02DB6, 0x02DB7,
+        0x02DB8, 0x02DB9, 0x02DBA, 0x02DBB, 0x02DBC, 0x02DBD, 0x02DBE, 0x02DBF,
+        0x02DC0, 0x02DC1, 0x02DC2, 0x02DC3, 0x02DC4, 0x02DC5, 0x02DC6, 0x02DC7,
+        0x02DC8, 0x02DC9, 0x02DCA, 0x02DCB, 0x02DCC, 0x02DCD, 0x02DCE, 0x02DCF,
+        0x02DD0, 0x02DD1, 0x02DD2, 0x02DD3, 0x02DD4, 0x02DD5, 0x02DD6, 0x02DD7,
+        0x02DD8, 0x02DD9, 0x02DDA, 0x02DDB, 0x02DDC, 0x02DDD, 0x02DDE, 0x02DDF,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+    },
+    {
+        0x03000, 0x03001, 0x03002, 0x03003, 0x03004, 0x03005, 0x03006, 0x03007,
+        0x03008, 0x03009, 0x0300A, 0x0300B, 0x0300C, 0x0300D, 0x0300E, 0x0300F,
+        0x03010, 0x03011, 0x03012, 0x03013, 0x03014, 0x03015, 0x03016, 0x03017,
+        0x03018, 0x03019, 0x0301A, 0x0301B, 0x0301C, 0x0301D, 0x0301E, 0x0301F,
+        0x03020, 0x03021, 0x03022, 0x03023, 0x03024, 0x03025, 0x03026, 0x03027,
+        0x03028, 0x03029, 0x00000, 0x00000, 0x00000, 0x00000, 0x0302E, 0x0302F,
+        0x03030, 0x03031, 0x03032, 0x03033, 0x03034, 0x03035, 0x03036, 0x03037,
+        0x03038, 0x03039, 0x0303A, 0x0303B, 0x0303C, 0x0303D, 0x0303E, 0x0303F,
+        0x03040, 0x03041, 0x03042, 0x03043, 0x03044, 0x03045, 0x03046, 0x03047,
+        0x03048, 0x03049, 0x0304A, 0x0304B, 0x0304B, 0x0304D, 0x0304D, 0x0304F,
+        0x0304F, 0x03051, 0x03051, 0x03053, 0x03053, 0x03055, 0x03055, 0x03057,
+        0x03057, 0x03059, 0x03059, 0x0305B, 0x0305B, 0x0305D, 0x0305D, 0x0305F,
+        0x0305F, 0x03061, 0x03061, 0x03063, 0x03064, 0x03064, 0x03066, 0x03066,
+        0x03068, 0x03068, 0x0306A, 0x0306B, 0x0306C, 0x0306D, 0x0306E, 0x0306F,
+        0x0306F, 0x0306F, 0x03072, 0x03072, 0x03072, 0x03075, 0x03075, 0x03075,
+        0x03078, 0x03078, 0x03078, 0x0307B, 0x0307B, 0x0307B, 0x0307E, 0x0307F,
+    },
+    {
+        0x03080, 0x03081, 0x03082, 0x03083, 0x03084, 0x03085, 0x03086, 0x03087,
+        0x03088, 0x03089, 0x0308A, 0x0308B, 0x0308C, 0x0308D, 0x0308E, 0x0308F,
+        0x03090, 0x03091, 0x03092, 0x03093, 0x03046, 0x03095, 0x03096, 0x03097,
+        0x03098, 0x00000, 0x00000, 0x0309B, 0x0309C, 0x0309D, 0x0309D, 0x0309F,
+        0x030A0, 0x030A1, 0x030A2, 0x030A3, 0x030A4, 0x030A5, 0x030A6, 0x030A7,
+        0x030A8, 0x030A9, 0x030AA, 0x030AB, 0x030AB, 0x030AD, 0x030AD, 0x030AF,
+        0x030AF, 0x030B1, 0x030B1, 0x030B3, 0x030B3, 0x030B5, 0x030B5, 0x030B7,
+        0x030B7, 0x030B9, 0x030B9, 0x030BB, 0x030BB, 0x030BD, 0x030BD, 0x030BF,
+        0x030BF, 0x030C1, 0x030C1, 0x030C3, 0x030C4, 0x030C4, 0x030C6, 0x030C6,
+        0x030C8, 0x030C8, 0x030CA, 0x030CB, 0x030CC, 0x030CD, 0x030CE, 0x030CF,
+        0x030CF, 0x030CF, 0x030D2, 0x030D2, 0x030D2, 0x030D5, 0x030D5, 0x030D5,
+        0x030D8, 0x030D8, 0x030D8, 0x030DB, 0x030DB, 0x030DB, 0x030DE, 0x030DF,
+        0x030E0, 0x030E1, 0x030E2, 0x030E3, 0x030E4, 0x030E5, 0x030E6, 0x030E7,
+        0x030E8, 0x030E9, 0x030EA, 0x030EB, 0x030EC, 0x030ED, 0x030EE, 0x030EF,
+        0x030F0, 0x030F1, 0x030F2, 0x030F3, 0x030A6, 0x030F5, 0x030F6, 0x030EF,
+        0x030F0, 0x030F1, 0x030F2, 0x030FB, 0x030FC, 0x030FD, 0x030FD, 0x030FF,
+    },
+    {
+        0x0A600, 0x0A601, 0x0A602, 0x0A603, 0x0A604, 0x0A605, 0x0A606, 0x0A607,
+        0x0A608, 0x0A609, 0x0A60A, 0x0A60B, 0x0A60C, 0x0A60D, 0x0A60E, 0x0A60F,
+        0x0A610, 0x0A611, 0x0A612, 0x0A613, 0x0A614, 0x0A615, 0x0A616, 0x0A617,
+        0x0A618, 0x0A619, 0x0A61A, 0x0A61B, 0x0A61C, 0x0A61D, 0x0A61E, 0x0A61F,
+        0x0A620, 0x0A621, 0x0A622, 0x0A623, 0x0A624, 0x0A625, 0x0A626, 0x0A627,
+        0x0A628, 0x0A629, 0x0A62A, 0x0A62B, 0x0A62C, 0x0A62D, 0x0A62E, 0x0A62F,
+        0x0A630, 0x0A631, 0x0A632, 0x0A633, 0x0A634, 0x0A635, 0x0A636, 0x0A637,
+        0x0A638, 0x0A639, 0x0A63A, 0x0A63B, 0x0A63C, 0x0A63D, 0x0A63E, 0x0A63F,
+        0x0A641, 0x0A641, 0x0A643, 0x0A643, 0x0A645, 0x0A645, 0x0A647, 0x0A647,
+        0x0A649, 0x0A649, 0x0A64B, 0x0A64B, 0x0A64D, 0x0A64D, 0x0A64F, 0x0A64F,
+        0x0A651, 0x0A651, 0x0A653, 0x0A653, 0x0A655, 0x0A655, 0x0A657, 0x0A657,
+        0x0A659, 0x0A659, 0x0A65B, 0x0A65B, 0x0A65D, 0x0A65D, 0x0A65F, 0x0A65F,
+        0x0A661, 0x0A661, 0x0A663, 0x0A663, 0x0A665, 0x0A665, 0x0A667, 0x0A667,
+        0x0A669, 0x0A669, 0x0A66B, 0x0A66B, 0x0A66D, 0x0A66D, 0x0A66E, 0x00000,
+        0x0A670, 0x0A671, 0x0A672, 0x0A673, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x0A67E, 0x0A67F,
+    },
+    {
+        0x0A681, 0x0A681, 0x0A683, 0x0A683, 0x0A685, 0x0A685, 0x0A687, 0x0A687,
+        0x0A689, 0x0A689, 0x0A68B, 0x0A68B, 0x0A68D, 0x0A68D, 0x0A68F, 0x0A68F,
+        0x0A691, 0x0A691, 0x0A693, 0x0A693, 0x0A695, 0x0A695, 0x0A697, 0x0A697,
+        0x0A699, 0x0A699, 0x0A69B, 0x0A69B, 0x0A69C, 0x0A69D, 0x00000, 0x00000,
+        0x0A6A0, 0x0A6A1, 0x0A6A2, 0x0A6A3, 0x0A6A4, 0x0A6A5, 0x0A6A6, 0x0A6A7,
+        0x0A6A8, 0x0A6A9, 0x0A6AA, 0x0A6AB, 0x0A6AC, 0x0A6AD, 0x0A6AE, 0x0A6AF,
+        0x0A6B0, 0x0A6B1, 0x0A6B2, 0x0A6B3, 0x0A6B4, 0x0A6B5, 0x0A6B6, 0x0A6B7,
+        0x0A6B8, 0x0A6B9, 0x0A6BA, 0x0A6BB, 0x0A6BC, 0x0A6BD, 0x0A6BE, 0x0A6BF,
+        0x0A6C0, 0x0A6C1, 0x0A6C2, 0x0A6C3, 0x0A6C4, 0x0A6C5, 0x0A6C6, 0x0A6C7,
+        0x0A6C8, 0x0A6C9, 0x0A6CA, 0x0A6CB, 0x0A6CC, 0x0A6CD, 0x0A6CE, 0x0A6CF,
+        0x0A6D0, 0x0A6D1, 0x0A6D2, 0x0A6D3, 0x0A6D4, 0x0A6D5, 0x0A6D6, 0x0A6D7,
+        0x0A6D8, 0x0A6D9, 0x0A6DA, 0x0A6DB, 0x0A6DC, 0x0A6DD, 0x0A6DE, 0x0A6DF,
+        0x0A6E0, 0x0A6E1, 0x0A6E2, 0x0A6E3, 0x0A6E4, 0x0A6E5, 0x0A6E6, 0x0A6E7,
+        0x0A6E8, 0x0A6E9, 0x0A6EA, 0x0A6EB, 0x0A6EC, 0x0A6ED, 0x0A6EE, 0x0A6EF,
+        0x00000, 0x00000, 0x0A6F2, 0x0A6F3, 0x0A6F4, 0x0A6F5, 0x0A6F6, 0x0A6F7,
+        0x0A6F8, 0x0A6F9, 0x0A6FA, 0x0A6FB, 0x0A6FC, 0x0A6FD, 0x0A6FE, 0x0A6FF,
+    },
+    {
+        0x0A700, 0x0A701, 0x0A702, 0x0A703, 0x0A704, 0x0A705, 0x0A706, 0x0A707,
+        0x0A708, 0x0A709, 0x0A70A, 0x0A70B, 0x0A70C, 0x0A70D, 0x0A70E, 0x0A70F,
+        0x0A710, 0x0A711, 0x0A712, 0x0A713, 0x0A714, 0x0A715, 0x0A716, 0x0A717,
+        0x0A718, 0x0A719, 0x0A71A, 0x0A71B, 0x0A71C, 0x0A71D, 0x0A71E, 0x0A71F,
+        0x0A720, 0x0A721, 0x0A723, 0x0A723, 0x0A725, 0x0A725, 0x0A727, 0x0A727,
+        0x0A729, 0x0A729, 0x0A72B, 0x0A72B, 0x0A72D, 0x0A72D, 0x0A72F, 0x0A72F,
+        0x0A730, 0x0A731, 0x0A733, 0x0A733, 0x0A735, 0x0A735, 0x0A737, 0x0A737,
+        0x0A739, 0x0A739, 0x0A73B, 0x0A73B, 0x0A73D, 0x0A73D, 0x0A73F, 0x0A73F,
+        0x0A741, 0x0A741, 0x0A743, 0x0A743, 0x0A745, 0x0A745, 0x0A747, 0x0A747,
+        0x0A749, 0x0A749, 0x0A74B, 0x0A74B, 0x0A74D, 0x0A74D, 0x0A74F, 0x0A74F,
+        0x0A751, 0x0A751, 0x0A753, 0x0A753, 0x0A755, 0x0A755, 0x0A757, 0x0A757,
+        0x0A759, 0x0A759, 0x0A75B, 0x0A75B, 0x0A75D, 0x0A75D, 0x0A75F, 0x0A75F,
+        0x0A761, 0x0A761, 0x0A763, 0x0A763, 0x0A765, 0x0A765, 0x0A767, 0x0A767,
+        0x0A769, 0x0A769, 0x0A76B, 0x0A76B, 0x0A76D, 0x0A76D, 0x0A76F, 0x0A76F,
+        0x0A770, 0x0A771, 0x0A772, 0x0A773, 0x0A774, 0x0A775, 0x0A776, 0x0A777,
+        0x0A778, 0x0A77A, 0x0A77A, 0x0A77C, 0x0A77C, 0x01D79, 0x0A77F, 0x0A77F,
+    },
+    {
+        0x0A781, 0x0A781, 0x0A783, 0x0A783, 0x0A785, 0x0A785, 0x0A787, 0x0A787,
+        0x0A788, 0x0A789, 0x0A78A, 0x0A78C, 0x0A78C, 0x00265, 0x0A78E, 0x0A78F,
+        0x0A791, 0x0A791, 0x0A793, 0x0A793, 0x0A794, 0x0A795, 0x0A797, 0x0A797,
+        0x0A799, 0x0A799, 0x0A79B, 0x0A79B, 0x0A79D, 0x0A79D, 0x0A79F, 0x0A79F,
+        0x0A7A1, 0x0A7A1, 0x0A7A3, 0x0A7A3, 0x0A7A5, 0x0A7A5, 0x0A7A7, 0x0A7A7,
+        0x0A7A9, 0x0A7A9, 0x00266, 0x0025C, 0x00261, 0x0026C, 0x0026A, 0x0A7AF,
+        0x0029E, 0x00287, 0x0029D, 0x0AB53, 0x0A7B5, 0x0A7B5, 0x0A7B7, 0x0A7B7,
+        0x0A7B9, 0x0A7B9, 0x0A7BB, 0x0A7BB, 0x0A7BD, 0x0A7BD, 0x0A7BF, 0x0A7BF,
+        0x0A7C1, 0x0A7C1, 0x0A7C3, 0x0A7C3, 0x0A794, 0x00282, 0x01D8E, 0x0A7C8,
+        0x0A7C8, 0x0A7CA, 0x0A7CA, 0x0A7CB, 0x0A7CC, 0x0A7CD, 0x0A7CE, 0x0A7CF,
+        0x0A7D1, 0x0A7D1, 0x0A7D2, 0x0A7D3, 0x0A7D4, 0x0A7D5, 0x0A7D7, 0x0A7D7,
+        0x0A7D9, 0x0A7D9, 0x0A7DA, 0x0A7DB, 0x0A7DC, 0x0A7DD, 0x0A7DE, 0x0A7DF,
+        0x0A7E0, 0x0A7E1, 0x0A7E2, 0x0A7E3, 0x0A7E4, 0x0A7E5, 0x0A7E6, 0x0A7E7,
+        0x0A7E8, 0x0A7E9, 0x0A7EA, 0x0A7EB, 0x0A7EC, 0x0A7ED, 0x0A7EE, 0x0A7EF,
+        0x0A7F0, 0x0A7F1, 0x0A7F2, 0x0A7F3, 0x0A7F4, 0x0A7F6, 0x0A7F6, 0x0A7F7,
+        0x0A7F8, 0x0A7F9, 0x0A7FA, 0x0A7FB, 0x0A7FC, 0x0A7FD, 0x0A7FE, 0x0A7FF,
+    },
+    {
+        0x0A800, 0x0A801, 0x00000, 0x0A803, 0x0A804, 0x0A805, 0x00000, 0x0A807,
+        0x0A808, 0x0A809, 0x0A80A, 0x00000, 0x0A80C, 0x0A80D, 0x0A80E, 0x0A80F,
+        0x0A810, 0x0A811, 0x0A812, 0x0A813, 0x0A814, 0x0A815, 0x0A816, 0x0A817,
+        0x0A818, 0x0A819, 0x0A81A, 0x0A81B, 0x0A81C, 0x0A81D, 0x0A81E, 0x0A81F,
+        0x0A820, 0x0A821, 0x0A822, 0x0A823, 0x0A824, 0x00000, 0x00000, 0x0A827,
+        0x0A828, 0x0A829, 0x0A82A, 0x0A82B, 0x00000, 0x0A82D, 0x0A82E, 0x0A82F,
+        0x0A830, 0x0A831, 0x0A832, 0x0A833, 0x0A834, 0x0A835, 0x0A836, 0x0A837,
+        0x0A838, 0x0A839, 0x0A83A, 0x0A83B, 0x0A83C, 0x0A83D, 0x0A83E, 0x0A83F,
+        0x0A840, 0x0A841, 0x0A842, 0x0A843, 0x0A844, 0x0A845, 0x0A846, 0x0A847,
+        0x0A848, 0x0A849, 0x0A84A, 0x0A84B, 0x0A84C, 0x0A84D, 0x0A84E, 0x0A84F,
+        0x0A850, 0x0A851, 0x0A852, 0x0A853, 0x0A854, 0x0A855, 0x0A856, 0x0A857,
+        0x0A858, 0x0A859, 0x0A85A, 0x0A85B, 0x0A85C, 0x0A85D, 0x0A85E, 0x0A85F,
+        0x0A860, 0x0A861, 0x0A862, 0x0A863, 0x0A864, 0x0A865, 0x0A866, 0x0A867,
+        0x0A868, 0x0A869, 0x0A86A, 0x0A86B, 0x0A86C, 0x0A86D, 0x0A86E, 0x0A86F,
+        0x0A870, 0x0A871, 0x0A872, 0x0A873, 0x0A874, 0x0A875, 0x0A876, 0x0A877,
+        0x0A878, 0x0A879, 0x0A87A, 0x0A87B, 0x0A87C, 0x0A87D, 0x0A87E, 0x0A87F,
+    },
+    {
+        0x0A880, 0x0A881, 0x0A882, 0x0A883, 0x0A884, 0x0A885, 0x0A886, 0x0A887,
+        0x0A888, 0x0A889, 0x0A88A, 0x0A88B, 0x0A88C, 0x0A88D, 0x0A88E, 0x0A88F,
+        0x0A890, 0x0A891, 0x0A892, 0x0A893, 0x0A894, 0x0A895, 0x0A896, 0x0A897,
+        0x0A898, 0x0A899, 0x0A89A, 0x0A89B, 0x0A89C, 0x0A89D, 0x0A89E, 0x0A89F,
+        0x0A8A0, 0x0A8A1, 0x0A8A2, 0x0A8A3, 0x0A8A4, 0x0A8A5, 0x0A8A6, 0x0A8A7,
+        0x0A8A8, 0x0A8A9, 0x0A8AA, 0x0A8AB, 0x0A8AC, 0x0A8AD, 0x0A8AE, 0x0A8AF,
+        0x0A8B0, 0x0A8B1, 0x0A8B2, 0x0A8B3, 0x0A8B4, 0x0A8B5, 0x0A8B6, 0x0A8B7,
+        0x0A8B8, 0x0A8B9, 0x0A8BA, 0x0A8BB, 0x0A8BC, 0x0A8BD, 0x0A8BE, 0x0A8BF,
+        0x0A8C0, 0x0A8C1, 0x0A8C2, 0x0A8C3, 0x00000, 0x00000, 0x0A8C6, 0x0A8C7,
+        0x0A8C8, 0x0A8C9, 0x0A8CA, 0x0A8CB, 0x0A8CC, 0x0A8CD, 0x0A8CE, 0x0A8CF,
+        0x0A8D0, 0x0A8D1, 0x0A8D2, 0x0A8D3, 0x0A8D4, 0x0A8D5, 0x0A8D6, 0x0A8D7,
+        0x0A8D8, 0x0A8D9, 0x0A8DA, 0x0A8DB, 0x0A8DC, 0x0A8DD, 0x0A8DE, 0x0A8DF,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x0A8F2, 0x0A8F3, 0x0A8F4, 0x0A8F5, 0x0A8F6, 0x0A8F7,
+        0x0A8F8, 0x0A8F9, 0x0A8FA, 0x0A8FB, 0x0A8FC, 0x0A8FD, 0x0A8FE, 0x00000,
+    },
+    {
+        0x0A900, 0x0A901, 0x0A902, 0x0A903, 0x0A904, 0x0A905, 0x0A906, 0x0A907,
+        0x0A908, 0x0A909, 0x0A90A, 0x0A90B, 0x0A90C, 0x0A90D, 0x0A90E, 0x0A90F,
+        0x0A910, 0x0A911, 0x0A912, 0x0A913, 0x0A914, 0x0A915, 0x0A916, 0x0A917,
+        0x0A918, 0x0A919, 0x0A91A, 0x0A91B, 0x0A91C, 0x0A91D, 0x0A91E, 0x0A91F,
+        0x0A920, 0x0A921, 0x0A922, 0x0A923, 0x0A924, 0x0A925, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x0A92E, 0x0A92F,
+        0x0A930, 0x0A931, 0x0A932, 0x0A933, 0x0A934, 0x0A935, 0x0A936, 0x0A937,
+        0x0A938, 0x0A939, 0x0A93A, 0x0A93B, 0x0A93C, 0x0A93D, 0x0A93E, 0x0A93F,
+        0x0A940, 0x0A941, 0x0A942, 0x0A943, 0x0A944, 0x0A945, 0x0A946, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x0A952, 0x0A953, 0x0A954, 0x0A955, 0x0A956, 0x0A957,
+        0x0A958, 0x0A959, 0x0A95A, 0x0A95B, 0x0A95C, 0x0A95D, 0x0A95E, 0x0A95F,
+        0x0A960, 0x0A961, 0x0A962, 0x0A963, 0x0A964, 0x0A965, 0x0A966, 0x0A967,
+        0x0A968, 0x0A969, 0x0A96A, 0x0A96B, 0x0A96C, 0x0A96D, 0x0A96E, 0x0A96F,
+        0x0A970, 0x0A971, 0x0A972, 0x0A973, 0x0A974, 0x0A975, 0x0A976, 0x0A977,
+        0x0A978, 0x0A979, 0x0A97A, 0x0A97B, 0x0A97C, 0x0A97D, 0x0A97E, 0x0A97F,
+    },
+    {
+        0x00000, 0x00000, 0x00000, 0x0A983, 0x0A984, 0x0A985, 0x0A986, 0x0A987,
+        0x0A988, 0x0A989, 0x0A98A, 0x0A98B, 0x0A98C, 0x0A98D, 0x0A98E, 0x0A98F,
+        0x0A990, 0x0A991, 0x0A992, 0x0A993, 0x0A994, 0x0A995, 0x0A996, 0x0A997,
+        0x0A998, 0x0A999, 0x0A99A, 0x0A99B, 0x0A99C, 0x0A99D, 0x0A99E, 0x0A99F,
+        0x0A9A0, 0x0A9A1, 0x0A9A2, 0x0A9A3, 0x0A9A4, 0x0A9A5, 0x0A9A6, 0x0A9A7,
+        0x0A9A8, 0x0A9A9, 0x0A9AA, 0x0A9AB, 0x0A9AC, 0x0A9AD, 0x0A9AE, 0x0A9AF,
+        0x0A9B0, 0x0A9B1, 0x0A9B2, 0x00000, 0x0A9B4, 0x0A9B5, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x0A9BA, 0x0A9BB, 0x00000, 0x00000, 0x0A9BE, 0x0A9BF,
+        0x0A9C0, 0x0A9C1, 0x0A9C2, 0x0A9C3, 0x0A9C4, 0x0A9C5, 0x0A9C6, 0x0A9C7,
+        0x0A9C8, 0x0A9C9, 0x0A9CA, 0x0A9CB, 0x0A9CC, 0x0A9CD, 0x0A9CE, 0x0A9CF,
+        0x0A9D0, 0x0A9D1, 0x0A9D2, 0x0A9D3, 0x0A9D4, 0x0A9D5, 0x0A9D6, 0x0A9D7,
+        0x0A9D8, 0x0A9D9, 0x0A9DA, 0x0A9DB, 0x0A9DC, 0x0A9DD, 0x0A9DE, 0x0A9DF,
+        0x0A9E0, 0x0A9E1, 0x0A9E2, 0x0A9E3, 0x0A9E4, 0x00000, 0x0A9E6, 0x0A9E7,
+        0x0A9E8, 0x0A9E9, 0x0A9EA, 0x0A9EB, 0x0A9EC, 0x0A9ED, 0x0A9EE, 0x0A9EF,
+        0x0A9F0, 0x0A9F1, 0x0A9F2, 0x0A9F3, 0x0A9F4, 0x0A9F5, 0x0A9F6, 0x0A9F7,
+        0x0A9F8, 0x0A9F9, 0x0A9FA, 0x0A9FB, 0x0A9FC, 0x0A9FD, 0x0A9FE, 0x0A9FF,
+    },
+    {
+        0x0AA00, 0x0AA01, 0x0AA02, 0x0AA03, 0x0AA04, 0x0AA05, 0x0AA06, 0x0AA07,
+        0x0AA08, 0x0AA09, 0x0AA0A, 0x0AA0B, 0x0AA0C, 0x0AA0D, 0x0AA0E, 0x0AA0F,
+        0x0AA10, 0x0AA11, 0x0AA12, 0x0AA13, 0x0AA14, 0x0AA15, 0x0AA16, 0x0AA17,
+        0x0AA18, 0x0AA19, 0x0AA1A, 0x0AA1B, 0x0AA1C, 0x0AA1D, 0x0AA1E, 0x0AA1F,
+        0x0AA20, 0x0AA21, 0x0AA22, 0x0AA23, 0x0AA24, 0x0AA25, 0x0AA26, 0x0AA27,
+        0x0AA28, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x0AA2F,
+        0x0AA30, 0x00000, 0x00000, 0x0AA33, 0x0AA34, 0x00000, 0x00000, 0x0AA37,
+        0x0AA38, 0x0AA39, 0x0AA3A, 0x0AA3B, 0x0AA3C, 0x0AA3D, 0x0AA3E, 0x0AA3F,
+        0x0AA40, 0x0AA41, 0x0AA42, 0x00000, 0x0AA44, 0x0AA45, 0x0AA46, 0x0AA47,
+        0x0AA48, 0x0AA49, 0x0AA4A, 0x0AA4B, 0x00000, 0x0AA4D, 0x0AA4E, 0x0AA4F,
+        0x0AA50, 0x0AA51, 0x0AA52, 0x0AA53, 0x0AA54, 0x0AA55, 0x0AA56, 0x0AA57,
+        0x0AA58, 0x0AA59, 0x0AA5A, 0x0AA5B, 0x0AA5C, 0x0AA5D, 0x0AA5E, 0x0AA5F,
+        0x0AA60, 0x0AA61, 0x0AA62, 0x0AA63, 0x0AA64, 0x0AA65, 0x0AA66, 0x0AA67,
+        0x0AA68, 0x0AA69, 0x0AA6A, 0x0AA6B, 0x0AA6C, 0x0AA6D, 0x0AA6E, 0x0AA6F,
+        0x0AA70, 0x0AA71, 0x0AA72, 0x0AA73, 0x0AA74, 0x0AA75, 0x0AA76, 0x0AA77,
+        0x0AA78, 0x0AA79, 0x0AA7A, 0x0AA7B, 0x00000, 0x0AA7D, 0x0AA7E, 0x0AA7F,
+    },
+    {
+        0x0AA80, 0x0AA81, 0x0AA82, 0x0AA83, 0x0AA84, 0x0AA85, 0x0AA86, 0x0AA87,
+        0x0AA88, 0x0AA89, 0x0AA8A, 0x0AA8B, 0x0AA8C, 0x0AA8D, 0x0AA8E, 0x0AA8F,
+        0x0AA90, 0x0AA91, 0x0AA92, 0x0AA93, 0x0AA94, 0x0AA95, 0x0AA96, 0x0AA97,
+        0x0AA98, 0x0AA99, 0x0AA9A, 0x0AA9B, 0x0AA9C, 0x0AA9D, 0x0AA9E, 0x0AA9F,
+        0x0AAA0, 0x0AAA1, 0x0AAA2, 0x0AAA3, 0x0AAA4, 0x0AAA5, 0x0AAA6, 0x0AAA7,
+        0x0AAA8, 0x0AAA9, 0x0AAAA, 0x0AAAB, 0x0AAAC, 0x0AAAD, 0x0AAAE, 0x0AAAF,
+        0x00000, 0x0AAB1, 0x00000, 0x00000, 0x00000, 0x0AAB5, 0x0AAB6, 0x00000,
+        0x00000, 0x0AAB9, 0x0AABA, 0x0AABB, 0x0AABC, 0x0AABD, 0x00000, 0x00000,
+        0x0AAC0, 0x00000, 0x0AAC2, 0x0AAC3, 0x0AAC4, 0x0AAC5, 0x0AAC6, 0x0AAC7,
+        0x0AAC8, 0x0AAC9, 0x0AACA, 0x0AACB, 0x0AACC, 0x0AACD, 0x0AACE, 0x0AACF,
+        0x0AAD0, 0x0AAD1, 0x0AAD2, 0x0AAD3, 0x0AAD4, 0x0AAD5, 0x0AAD6, 0x0AAD7,
+        0x0AAD8, 0x0AAD9, 0x0AADA, 0x0AADB, 0x0AADC, 0x0AADD, 0x0AADE, 0x0AADF,
+        0x0AAE0, 0x0AAE1, 0x0AAE2, 0x0AAE3, 0x0AAE4, 0x0AAE5, 0x0AAE6, 0x0AAE7,
+        0x0AAE8, 0x0AAE9, 0x0AAEA, 0x0AAEB, 0x00000, 0x00000, 0x0AAEE, 0x0AAEF,
+        0x0AAF0, 0x0AAF1, 0x0AAF2, 0x0AAF3, 0x0AAF4, 0x0AAF5, 0x00000, 0x0AAF7,
+        0x0AAF8, 0x0AAF9, 0x0AAFA, 0x0AAFB, 0x0AAFC, 0x0AAFD, 0x0AAFE, 0x0AAFF,
+    },
+    {
+        0x0AB80, 0x0AB81, 0x0AB82, 0x0AB83, 0x0AB84, 0x0AB85, 0x0AB86, 0x0AB87,
+        0x0AB88, 0x0AB89, 0x0AB8A, 0x0AB8B, 0x0AB8C, 0x0AB8D, 0x0AB8E, 0x0AB8F,
+        0x0AB90, 0x0AB91, 0x0AB92, 0x0AB93, 0x0AB94, 0x0AB95, 0x0AB96, 0x0AB97,
+        0x0AB98, 0x0AB99, 0x0AB9A, 0x0AB9B, 0x0AB9C, 0x0AB9D, 0x0AB9E, 0x0AB9F,
+        0x0ABA0, 0x0ABA1, 0x0ABA2, 0x0ABA3, 0x0ABA4, 0x0ABA5, 0x0ABA6, 0x0ABA7,
+        0x0ABA8, 0x0ABA9, 0x0ABAA, 0x0ABAB, 0x0ABAC, 0x0ABAD, 0x0ABAE, 0x0ABAF,
+        0x0ABB0, 0x0ABB1, 0x0ABB2, 0x0ABB3, 0x0ABB4, 0x0ABB5, 0x0ABB6, 0x0ABB7,
+        0x0ABB8, 0x0ABB9, 0x0ABBA, 0x0ABBB, 0x0ABBC, 0x0ABBD, 0x0ABBE, 0x0ABBF,
+        0x0ABC0, 0x0ABC1, 0x0ABC2, 0x0ABC3, 0x0ABC4, 0x0ABC5, 0x0ABC6, 0x0ABC7,
+        0x0ABC8, 0x0ABC9, 0x0ABCA, 0x0ABCB, 0x0ABCC, 0x0ABCD, 0x0ABCE, 0x0ABCF,
+        0x0ABD0, 0x0ABD1, 0x0ABD2, 0x0ABD3, 0x0ABD4, 0x0ABD5, 0x0ABD6, 0x0ABD7,
+        0x0ABD8, 0x0ABD9, 0x0ABDA, 0x0ABDB, 0x0ABDC, 0x0ABDD, 0x0ABDE, 0x0ABDF,
+        0x0ABE0, 0x0ABE1, 0x0ABE2, 0x0ABE3, 0x0ABE4, 0x00000, 0x0ABE6, 0x0ABE7,
+        0x00000, 0x0ABE9, 0x0ABEA, 0x0ABEB, 0x0ABEC, 0x00000, 0x0ABEE, 0x0ABEF,
+        0x0ABF0, 0x0ABF1, 0x0ABF2, 0x0ABF3, 0x0ABF4, 0x0ABF5, 0x0ABF6, 0x0ABF7,
+        0x0ABF8, 0x0ABF9, 0x0ABFA, 0x0ABFB, 0x0ABFC, 0x0ABFD, 0x0ABFE, 0x0ABFF,
+    },
+    {
+        0x08C48, 0x066F4, 0x08ECA, 0x08CC8, 0x06ED1, 0x04E32, 0x053E5, 0x09F9C,
+        0x09F9C, 0x05951, 0x091D1, 0x05587, 0x05948, 0x061F6, 0x07669, 0x07F85,
+        0x0863F, 0x087BA, 0x088F8, 0x0908F, 0x06A02, 0x06D1B, 0x070D9, 0x073DE,
+        0x0843D, 0x0916A, 0x099F1, 0x04E82, 0x05375, 0x06B04, 0x0721B, 0x0862D,
+        0x09E1E, 0x05D50, 0x06FEB, 0x085CD, 0x08964, 0x062C9, 0x081D8, 0x0881F,
+        0x05ECA, 0x06717, 0x06D6A, 0x072FC, 0x090CE, 0x04F86, 0x051B7, 0x052DE,
+        0x064C4, 0x06AD3, 0x07210, 0x076E7, 0x08001, 0x08606, 0x0865C, 0x08DEF,
+        0x09732, 0x09B6F, 0x09DFA, 0x0788C, 0x0797F, 0x07DA0, 0x083C9, 0x09304,
+        0x09E7F, 0x08AD6, 0x058DF, 0x05F04, 0x07C60, 0x0807E, 0x07262, 0x078CA,
+        0x08CC2, 0x096F7, 0x058D8, 0x05C62, 0x06A13, 0x06DDA, 0x06F0F, 0x07D2F,
+        0x07E37, 0x0964B, 0x052D2, 0x0808B, 0x051DC, 0x051CC, 0x07A1C, 0x07DBE,
+        0x083F1, 0x09675, 0x08B80, 0x062CF, 0x06A02, 0x08AFE, 0x04E39, 0x05BE7,
+        0x06012, 0x07387, 0x07570, 0x05317, 0x078FB, 0x04FBF, 0x05FA9, 0x04E0D,
+        0x06CCC, 0x06578, 0x07D22, 0x053C3, 0x0585E, 0x07701, 0x08449, 0x08AAA,
+        0x06BBA, 0x08FB0, 0x06C88, 0x062FE, 0x082E5, 0x063A0, 0x07565, 0x04EAE,
+        0x05169, 0x051C9, 0x06881, 0x07CE7, 0x0826F, 0x08AD2, 0x091CF, 0x052F5,
+    },
+    {
+        0x05442, 0x05973, 0x05EEC, 0x065C5, 0x06FFE, 0x0792A, 0x095AD, 0x09A6A,
+        0x09E97, 0x09ECE, 0x0529B, 0x066C6, 0x06B77, 0x08F62, 0x05E74, 0x06190,
+        0x06200, 0x0649A, 0x06F23, 0x07149, 0x07489, 0x079CA, 0x07DF4, 0x0806F,
+        0x08F26, 0x084EE, 0x09023, 0x0934A, 0x05217, 0x052A3, 0x054BD, 0x070C8,
+        0x088C2, 0x08AAA, 0x05EC9, 0x05FF5, 0x0637B, 0x06BAE, 0x07C3E, 0x07375,
+        0x04EE4, 0x056F9, 0x05BE7, 0x05DBA, 0x0601C, 0x073B2, 0x07469, 0x07F9A,
+        0x08046, 0x09234, 0x096F6, 0x09748, 0x09818, 0x04F8B, 0x079AE, 0x091B4,
+        0x096B8, 0x060E1, 0x04E86, 0x050DA, 0x05BEE, 0x05C3F, 0x06599, 0x06A02,
+        0x071CE, 0x07642, 0x084FC, 0x0907C, 0x09F8D, 0x06688, 0x0962E, 0x05289,
+        0x0677B, 0x067F3, 0x06D41, 0x06E9C, 0x07409, 0x07559, 0x0786B, 0x07D10,
+        0x0985E, 0x0516D, 0x0622E, 0x09678, 0x0502B, 0x05D19, 0x06DEA, 0x08F2A,
+        0x05F8B, 0x06144, 0x06817, 0x07387, 0x09686, 0x05229, 0x0540F, 0x05C65,
+        0x06613, 0x0674E, 0x068A8, 0x06CE5, 0x07406, 0x075E2, 0x07F79, 0x088CF,
+        0x088E1, 0x091CC, 0x096E2, 0x0533F, 0x06EBA, 0x0541D, 0x071D0, 0x07498,
+        0x085FA, 0x096A3, 0x09C57, 0x09E9F, 0x06797, 0x06DCB, 0x081E8, 0x07ACB,
+        0x07B20, 0x07C92, 0x072C0, 0x07099, 0x08B58, 0x04EC0, 0x08336, 0x0523A,
+    },
+    {
+        0x05207, 0x05EA6, 0x062D3, 0x07CD6, 0x05B85, 0x06D1E, 0x066B4, 0x08F3B,
+        0x0884C, 0x0964D, 0x0898B, 0x05ED3, 0x05140, 0x055C0, 0x0FA0E, 0x0FA0F,
+        0x0585A, 0x0FA11, 0x06674, 0x0FA13, 0x0FA14, 0x051DE, 0x0732A, 0x076CA,
+        0x0793C, 0x0795E, 0x07965, 0x0798F, 0x09756, 0x07CBE, 0x07FBD, 0x0FA1F,
+        0x08612, 0x0FA21, 0x08AF8, 0x0FA23, 0x0FA24, 0x09038, 0x090FD, 0x0FA27,
+        0x0FA28, 0x0FA29, 0x098EF, 0x098FC, 0x09928, 0x09DB4, 0x090DE, 0x096B7,
+        0x04FAE, 0x050E7, 0x0514D, 0x052C9, 0x052E4, 0x05351, 0x0559D, 0x05606,
+        0x05668, 0x05840, 0x058A8, 0x05C64, 0x05C6E, 0x06094, 0x06168, 0x0618E,
+        0x061F2, 0x0654F, 0x065E2, 0x06691, 0x06885, 0x06D77, 0x06E1A, 0x06F22,
+        0x0716E, 0x0722B, 0x07422, 0x07891, 0x0793E, 0x07949, 0x07948, 0x07950,
+        0x07956, 0x0795D, 0x0798D, 0x0798E, 0x07A40, 0x07A81, 0x07BC0, 0x07DF4,
+        0x07E09, 0x07E41, 0x07F72, 0x08005, 0x081ED, 0x08279, 0x08279, 0x08457,
+        0x08910, 0x08996, 0x08B01, 0x08B39, 0x08CD3, 0x08D08, 0x08FB6, 0x09038,
+        0x096E3, 0x097FF, 0x0983B, 0x06075, 0x242EE, 0x08218, 0x0FA6E, 0x0FA6F,
+        0x04E26, 0x051B5, 0x05168, 0x04F80, 0x05145, 0x05180, 0x052C7, 0x052FA,
+        0x0559D, 0x05555, 0x05599, 0x055E2, 0x0585A, 0x058B3, 0x05944, 0x05954,
+    },
+    {
+        0x05A62, 0x05B28, 0x05ED2, 0x05ED9, 0x05F69, 0x05FAD, 0x060D8, 0x0614E,
+        0x06108, 0x0618E, 0x06160, 0x061F2, 0x06234, 0x063C4, 0x0641C, 0x06452,
+        0x06556, 0x06674, 0x06717, 0x0671B, 0x06756, 0x06B79, 0x06BBA, 0x06D41,
+        0x06EDB, 0x06ECB, 0x06F22, 0x0701E, 0x0716E, 0x077A7, 0x07235, 0x072AF,
+        0x0732A, 0x07471, 0x07506, 0x0753B, 0x0761D, 0x0761F, 0x076CA, 0x076DB,
+        0x076F4, 0x0774A, 0x07740, 0x078CC, 0x07AB1, 0x07BC0, 0x07C7B, 0x07D5B,
+        0x07DF4, 0x07F3E, 0x08005, 0x08352, 0x083EF, 0x08779, 0x08941, 0x08986,
+        0x08996, 0x08ABF, 0x08AF8, 0x08ACB, 0x08B01, 0x08AFE, 0x08AED, 0x08B39,
+        0x08B8A, 0x08D08, 0x08F38, 0x09072, 0x09199, 0x09276, 0x0967C, 0x096E3,
+        0x09756, 0x097DB, 0x097FF, 0x0980B, 0x0983B, 0x09B12, 0x09F9C, 0x2284A,
+        0x22844, 0x233D5, 0x03B9D, 0x04018, 0x04039, 0x25249, 0x25CD0, 0x27ED3,
+        0x09F43, 0x09F8E, 0x0FADA, 0x0FADB, 0x0FADC, 0x0FADD, 0x0FADE, 0x0FADF,
+        0x0FAE0, 0x0FAE1, 0x0FAE2, 0x0FAE3, 0x0FAE4, 0x0FAE5, 0x0FAE6, 0x0FAE7,
+        0x0FAE8, 0x0FAE9, 0x0FAEA, 0x0FAEB, 0x0FAEC, 0x0FAED, 0x0FAEE, 0x0FAEF,
+        0x0FAF0, 0x0FAF1, 0x0FAF2, 0x0FAF3, 0x0FAF4, 0x0FAF5, 0x0FAF6, 0x0FAF7,
+        0x0FAF8, 0x0FAF9, 0x0FAFA, 0x0FAFB, 0x0FAFC, 0x0FAFD, 0x0FAFE, 0x0FAFF,
+    },
+    {
+        0x0FB00, 0x0FB01, 0x0FB02, 0x0FB03, 0x0FB04, 0x0FB05, 0x0FB06, 0x0FB07,
+        0x0FB08, 0x0FB09, 0x0FB0A, 0x0FB0B, 0x0FB0C, 0x0FB0D, 0x0FB0E, 0x0FB0F,
+        0x0FB10, 0x0FB11, 0x0FB12, 0x0FB13, 0x0FB14, 0x0FB15, 0x0FB16, 0x0FB17,
+        0x0FB18, 0x0FB19, 0x0FB1A, 0x0FB1B, 0x0FB1C, 0x005D9, 0x00000, 0x005F2,
+        0x0FB20, 0x0FB21, 0x0FB22, 0x0FB23, 0x0FB24, 0x0FB25, 0x0FB26, 0x0FB27,
+        0x0FB28, 0x0FB29, 0x005E9, 0x005E9, 0x005E9, 0x005E9, 0x005D0, 0x005D0,
+        0x005D0, 0x005D1, 0x005D2, 0x005D3, 0x005D4, 0x005D5, 0x005D6, 0x0FB37,
+        0x005D8, 0x005D9, 0x005DA, 0x005DB, 0x005DC, 0x0FB3D, 0x005DE, 0x0FB3F,
+        0x005E0, 0x005E1, 0x0FB42, 0x005E3, 0x005E4, 0x0FB45, 0x005E6, 0x005E7,
+        0x005E8, 0x005E9, 0x005EA, 0x005D5, 0x005D1, 0x005DB, 0x005E4, 0x0FB4F,
+        0x0FB50, 0x0FB51, 0x0FB52, 0x0FB53, 0x0FB54, 0x0FB55, 0x0FB56, 0x0FB57,
+        0x0FB58, 0x0FB59, 0x0FB5A, 0x0FB5B, 0x0FB5C, 0x0FB5D, 0x0FB5E, 0x0FB5F,
+        0x0FB60, 0x0FB61, 0x0FB62, 0x0FB63, 0x0FB64, 0x0FB65, 0x0FB66, 0x0FB67,
+        0x0FB68, 0x0FB69, 0x0FB6A, 0x0FB6B, 0x0FB6C, 0x0FB6D, 0x0FB6E, 0x0FB6F,
+        0x0FB70, 0x0FB71, 0x0FB72, 0x0FB73, 0x0FB74, 0x0FB75, 0x0FB76, 0x0FB77,
+        0x0FB78, 0x0FB79, 0x0FB7A, 0x0FB7B, 0x0FB7C, 0x0FB7D, 0x0FB7E, 0x0FB7F,
+    },
+    {
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x0FE10, 0x0FE11, 0x0FE12, 0x0FE13, 0x0FE14, 0x0FE15, 0x0FE16, 0x0FE17,
+        0x0FE18, 0x0FE19, 0x0FE1A, 0x0FE1B, 0x0FE1C, 0x0FE1D, 0x0FE1E, 0x0FE1F,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x0FE30, 0x0FE31, 0x0FE32, 0x0FE33, 0x0FE34, 0x0FE35, 0x0FE36, 0x0FE37,
+        0x0FE38, 0x0FE39, 0x0FE3A, 0x0FE3B, 0x0FE3C, 0x0FE3D, 0x0FE3E, 0x0FE3F,
+        0x0FE40, 0x0FE41, 0x0FE42, 0x0FE43, 0x0FE44, 0x0FE45, 0x0FE46, 0x0FE47,
+        0x0FE48, 0x0FE49, 0x0FE4A, 0x0FE4B, 0x0FE4C, 0x0FE4D, 0x0FE4E, 0x0FE4F,
+        0x0FE50, 0x0FE51, 0x0FE52, 0x0FE53, 0x0FE54, 0x0FE55, 0x0FE56, 0x0FE57,
+        0x0FE58, 0x0FE59, 0x0FE5A, 0x0FE5B, 0x0FE5C, 0x0FE5D, 0x0FE5E, 0x0FE5F,
+        0x0FE60, 0x0FE61, 0x0FE62, 0x0FE63, 0x0FE64, 0x0FE65, 0x0FE66, 0x0FE67,
+        0x0FE68, 0x0FE69, 0x0FE6A, 0x0FE6B, 0x0FE6C, 0x0FE6D, 0x0FE6E, 0x0FE6F,
+        0x0FE70, 0x0FE71, 0x0FE72, 0x0FE73, 0x0FE74, 0x0FE75, 0x0FE76, 0x0FE77,
+        0x0FE78, 0x0FE79, 0x0FE7A, 0x0FE7B, 0x0FE7C, 0x0FE7D, 0x0FE7E, 0x0FE7F,
+    },
+    {
+        0x0FF00, 0x0FF01, 0x0FF02, 0x0FF03, 0x0FF04, 0x0FF05, 0x0FF06, 0x0FF07,
+        0x0FF08, 0x0FF09, 0x0FF0A, 0x0FF0B, 0x0FF0C, 0x0FF0D, 0x0FF0E, 0x0FF0F,
+        0x0FF10, 0x0FF11, 0x0FF12, 0x0FF13, 0x0FF14, 0x0FF15, 0x0FF16, 0x0FF17,
+        0x0FF18, 0x0FF19, 0x0FF1A, 0x0FF1B, 0x0FF1C, 0x0FF1D, 0x0FF1E, 0x0FF1F,
+        0x0FF20, 0x0FF41, 0x0FF42, 0x0FF43, 0x0FF44, 0x0FF45, 0x0FF46, 0x0FF47,
+        0x0FF48, 0x0FF49, 0x0FF4A, 0x0FF4B, 0x0FF4C, 0x0FF4D, 0x0FF4E, 0x0FF4F,
+        0x0FF50, 0x0FF51, 0x0FF52, 0x0FF53, 0x0FF54, 0x0FF55, 0x0FF56, 0x0FF57,
+        0x0FF58, 0x0FF59, 0x0FF5A, 0x0FF3B, 0x0FF3C, 0x0FF3D, 0x0FF3E, 0x0FF3F,
+        0x0FF40, 0x0FF41, 0x0FF42, 0x0FF43, 0x0FF44, 0x0FF45, 0x0FF46, 0x0FF47,
+        0x0FF48, 0x0FF49, 0x0FF4A, 0x0FF4B, 0x0FF4C, 0x0FF4D, 0x0FF4E, 0x0FF4F,
+        0x0FF50, 0x0FF51, 0x0FF52, 0x0FF53, 0x0FF54, 0x0FF55, 0x0FF56, 0x0FF57,
+        0x0FF58, 0x0FF59, 0x0FF5A, 0x0FF5B, 0x0FF5C, 0x0FF5D, 0x0FF5E, 0x0FF5F,
+        0x0FF60, 0x0FF61, 0x0FF62, 0x0FF63, 0x0FF64, 0x0FF65, 0x0FF66, 0x0FF67,
+        0x0FF68, 0x0FF69, 0x0FF6A, 0x0FF6B, 0x0FF6C, 0x0FF6D, 0x0FF6E, 0x0FF6F,
+        0x0FF70, 0x0FF71, 0x0FF72, 0x0FF73, 0x0FF74, 0x0FF75, 0x0FF76, 0x0FF77,
+        0x0FF78, 0x0FF79, 0x0FF7A, 0x0FF7B, 0x0FF7C, 0x0FF7D, 0x0FF7E, 0x0FF7F,
+    },
+    {
+        0x10180, 0x10181, 0x10182, 0x10183, 0x10184, 0x10185, 0x10186, 0x10187,
+        0x10188, 0x10189, 0x1018A, 0x1018B, 0x1018C, 0x1018D, 0x1018E, 0x1018F,
+        0x10190, 0x10191, 0x10192, 0x10193, 0x10194, 0x10195, 0x10196, 0x10197,
+        0x10198, 0x10199, 0x1019A, 0x1019B, 0x1019C, 0x1019D, 0x1019E, 0x1019F,
+        0x101A0, 0x101A1, 0x101A2, 0x101A3, 0x101A4, 0x101A5, 0x101A6, 0x101A7,
+        0x101A8, 0x101A9, 0x101AA, 0x101AB, 0x101AC, 0x101AD, 0x101AE, 0x101AF,
+        0x101B0, 0x101B1, 0x101B2, 0x101B3, 0x101B4, 0x101B5, 0x101B6, 0x101B7,
+        0x101B8, 0x101B9, 0x101BA, 0x101BB, 0x101BC, 0x101BD, 0x101BE, 0x101BF,
+        0x101C0, 0x101C1, 0x101C2, 0x101C3, 0x101C4, 0x101C5, 0x101C6, 0x101C7,
+        0x101C8, 0x101C9, 0x101CA, 0x101CB, 0x101CC, 0x101CD, 0x101CE, 0x101CF,
+        0x101D0, 0x101D1, 0x101D2, 0x101D3, 0x101D4, 0x101D5, 0x101D6, 0x101D7,
+        0x101D8, 0x101D9, 0x101DA, 0x101DB, 0x101DC, 0x101DD, 0x101DE, 0x101DF,
+        0x101E0, 0x101E1, 0x101E2, 0x101E3, 0x101E4, 0x101E5, 0x101E6, 0x101E7,
+        0x101E8, 0x101E9, 0x101EA, 0x101EB, 0x101EC, 0x101ED, 0x101EE, 0x101EF,
+        0x101F0, 0x101F1, 0x101F2, 0x101F3, 0x101F4, 0x101F5, 0x101F6, 0x101F7,
+        0x101F8, 0x101F9, 0x101FA, 0x101FB, 0x101FC, 0x00000, 0x101FE, 0x101FF,
+    },
+    {
+        0x10280, 0x10281, 0x10282, 0x10283, 0x10284, 0x10285, 0x10286, 0x10287,
+        0x10288, 0x10289, 0x1028A, 0x1028B, 0x1028C, 0x1028D, 0x1028E, 0x1028F,
+        0x10290, 0x10291, 0x10292, 0x10293, 0x10294, 0x10295, 0x10296, 0x10297,
+        0x10298, 0x10299, 0x1029A, 0x1029B, 0x1029C, 0x1029D, 0x1029E, 0x1029F,
+        0x102A0, 0x102A1, 0x102A2, 0x102A3, 0x102A4, 0x102A5, 0x102A6, 0x102A7,
+        0x102A8, 0x102A9, 0x102AA, 0x102AB, 0x102AC, 0x102AD, 0x102AE, 0x102AF,
+        0x102B0, 0x102B1, 0x102B2, 0x102B3, 0x102B4, 0x102B5, 0x102B6, 0x102B7,
+        0x102B8, 0x102B9, 0x102BA, 0x102BB, 0x102BC, 0x102BD, 0x102BE, 0x102BF,
+        0x102C0, 0x102C1, 0x102C2, 0x102C3, 0x102C4, 0x102C5, 0x102C6, 0x102C7,
+        0x102C8, 0x102C9, 0x102CA, 0x102CB, 0x102CC, 0x102CD, 0x102CE, 0x102CF,
+        0x102D0, 0x102D1, 0x102D2, 0x102D3, 0x102D4, 0x102D5, 0x102D6, 0x102D7,
+        0x102D8, 0x102D9, 0x102DA, 0x102DB, 0x102DC, 0x102DD, 0x102DE, 0x102DF,
+        0x00000, 0x102E1, 0x102E2, 0x102E3, 0x102E4, 0x102E5, 0x102E6, 0x102E7,
+        0x102E8, 0x102E9, 0x102EA, 0x102EB, 0x102EC, 0x102ED, 0x102EE, 0x102EF,
+        0x102F0, 0x102F1, 0x102F2, 0x102F3, 0x102F4, 0x102F5, 0x102F6, 0x102F7,
+        0x102F8, 0x102F9, 0x102FA, 0x102FB, 0x102FC, 0x102FD, 0x102FE, 0x102FF,
+    },
+    {
+        0x10300, 0x10301, 0x10302, 0x10303, 0x10304, 0x10305, 0x10306, 0x10307,
+        0x10308, 0x10309, 0x1030A, 0x1030B, 0x1030C, 0x1030D, 0x1030E, 0x1030F,
+        0x10310, 0x10311, 0x10312, 0x10313, 0x10314, 0x10315, 0x10316, 0x10317,
+        0x10318, 0x10319, 0x1031A, 0x1031B, 0x1031C, 0x1031D, 0x1031E, 0x1031F,
+        0x10320, 0x10321, 0x10322, 0x10323, 0x10324, 0x10325, 0x10326, 0x10327,
+        0x10328, 0x10329, 0x1032A, 0x1032B, 0x1032C, 0x1032D, 0x1032E, 0x1032F,
+        0x10330, 0x10331, 0x10332, 0x10333, 0x10334, 0x10335, 0x10336, 0x10337,
+        0x10338, 0x10339, 0x1033A, 0x1033B, 0x1033C, 0x1033D, 0x1033E, 0x1033F,
+        0x10340, 0x10341, 0x10342, 0x10343, 0x10344, 0x10345, 0x10346, 0x10347,
+        0x10348, 0x10349, 0x1034A, 0x1034B, 0x1034C, 0x1034D, 0x1034E, 0x1034F,
+        0x10350, 0x10351, 0x10352, 0x10353, 0x10354, 0x10355, 0x10356, 0x10357,
+        0x10358, 0x10359, 0x1035A, 0x1035B, 0x1035C, 0x1035D, 0x1035E, 0x1035F,
+        0x10360, 0x10361, 0x10362, 0x10363, 0x10364, 0x10365, 0x10366, 0x10367,
+        0x10368, 0x10369, 0x1036A, 0x1036B, 0x1036C, 0x1036D, 0x1036E, 0x1036F,
+        0x10370, 0x10371, 0x10372, 0x10373, 0x10374, 0x10375, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x1037B, 0x1037C, 0x1037D, 0x1037E, 0x1037F,
+    },
+    {
+        0x10428, 0x10429, 0x1042A, 0x1042B, 0x1042C, 0x1042D, 0x1042E, 0x1042F,
+        0x10430, 0x10431, 0x10432, 0x10433, 0x10434, 0x10435, 0x10436, 0x10437,
+        0x10438, 0x10439, 0x1043A, 0x1043B, 0x1043C, 0x1043D, 0x1043E, 0x1043F,
+        0x10440, 0x10441, 0x10442, 0x10443, 0x10444, 0x10445, 0x10446, 0x10447,
+        0x10448, 0x10449, 0x1044A, 0x1044B, 0x1044C, 0x1044D, 0x1044E, 0x1044F,
+        0x10428, 0x10429, 0x1042A, 0x1042B, 0x1042C, 0x1042D, 0x1042E, 0x1042F,
+        0x10430, 0x10431, 0x10432, 0x10433, 0x10434, 0x10435, 0x10436, 0x10437,
+        0x10438, 0x10439, 0x1043A, 0x1043B, 0x1043C, 0x1043D, 0x1043E, 0x1043F,
+        0x10440, 0x10441, 0x10442, 0x10443, 0x10444, 0x10445, 0x10446, 0x10447,
+        0x10448, 0x10449, 0x1044A, 0x1044B, 0x1044C, 0x1044D, 0x1044E, 0x1044F,
+        0x10450, 0x10451, 0x10452, 0x10453, 0x10454, 0x10455, 0x10456, 0x10457,
+        0x10458, 0x10459, 0x1045A, 0x1045B, 0x1045C, 0x1045D, 0x1045E, 0x1045F,
+        0x10460, 0x10461, 0x10462, 0x10463, 0x10464, 0x10465, 0x10466, 0x10467,
+        0x10468, 0x10469, 0x1046A, 0x1046B, 0x1046C, 0x1046D, 0x1046E, 0x1046F,
+        0x10470, 0x10471, 0x10472, 0x10473, 0x10474, 0x10475, 0x10476, 0x10477,
+        0x10478, 0x10479, 0x1047A, 0x1047B, 0x1047C, 0x1047D, 0x1047E, 0x1047F,
+    },
+    {
+        0x10480, 0x10481, 0x10482, 0x10483, 0x10484, 0x10485, 0x10486, 0x10487,
+        0x10488, 0x10489, 0x1048A, 0x1048B, 0x1048C, 0x1048D, 0x1048E, 0x1048F,
+        0x10490, 0x10491, 0x10492, 0x10493, 0x10494, 0x10495, 0x10496, 0x10497,
+        0x10498, 0x10499, 0x1049A, 0x1049B, 0x1049C, 0x1049D, 0x1049E, 0x1049F,
+        0x104A0, 0x104A1, 0x104A2, 0x104A3, 0x104A4, 0x104A5, 0x104A6, 0x104A7,
+        0x104A8, 0x104A9, 0x104AA, 0x104AB, 0x104AC, 0x104AD, 0x104AE, 0x104AF,
+        0x104D8, 0x104D9, 0x104DA, 0x104DB, 0x104DC, 0x104DD, 0x104DE, 0x104DF,
+        0x104E0, 0x104E1, 0x104E2, 0x104E3, 0x104E4, 0x104E5, 0x104E6, 0x104E7,
+        0x104E8, 0x104E9, 0x104EA, 0x104EB, 0x104EC, 0x104ED, 0x104EE, 0x104EF,
+        0x104F0, 0x104F1, 0x104F2, 0x104F3, 0x104F4, 0x104F5, 0x104F6, 0x104F7,
+        0x104F8, 0x104F9, 0x104FA, 0x104FB, 0x104D4, 0x104D5, 0x104D6, 0x104D7,
+        0x104D8, 0x104D9, 0x104DA, 0x104DB, 0x104DC, 0x104DD, 0x104DE, 0x104DF,
+        0x104E0, 0x104E1, 0x104E2, 0x104E3, 0x104E4, 0x104E5, 0x104E6, 0x104E7,
+        0x104E8, 0x104E9, 0x104EA, 0x104EB, 0x104EC, 0x104ED, 0x104EE, 0x104EF,
+        0x104F0, 0x104F1, 0x104F2, 0x104F3, 0x104F4, 0x104F5, 0x104F6, 0x104F7,
+        0x104F8, 0x104F9, 0x104FA, 0x104FB, 0x104FC, 0x104FD, 0x104FE, 0x104FF,
+    },
+    {
+        0x10500, 0x10501, 0x10502, 0x10503, 0x10504, 0x10505, 0x10506, 0x10507,
+        0x10508, 0x10509, 0x1050A, 0x1050B, 0x1050C, 0x1050D, 0x1050E, 0x1050F,
+        0x10510, 0x10511, 0x10512, 0x10513, 0x10514, 0x10515, 0x10516, 0x10517,
+        0x10518, 0x10519, 0x1051A, 0x1051B, 0x1051C, 0x1051D, 0x1051E, 0x1051F,
+        0x10520, 0x10521, 0x10522, 0x10523, 0x10524, 0x10525, 0x10526, 0x10527,
+        0x10528, 0x10529, 0x1052A, 0x1052B, 0x1052C, 0x1052D, 0x1052E, 0x1052F,
+        0x10530, 0x10531, 0x10532, 0x10533, 0x10534, 0x10535, 0x10536, 0x10537,
+        0x10538, 0x10539, 0x1053A, 0x1053B, 0x1053C, 0x1053D, 0x1053E, 0x1053F,
+        0x10540, 0x10541, 0x10542, 0x10543, 0x10544, 0x10545, 0x10546, 0x10547,
+        0x10548, 0x10549, 0x1054A, 0x1054B, 0x1054C, 0x1054D, 0x1054E, 0x1054F,
+        0x10550, 0x10551, 0x10552, 0x10553, 0x10554, 0x10555, 0x10556, 0x10557,
+        0x10558, 0x10559, 0x1055A, 0x1055B, 0x1055C, 0x1055D, 0x1055E, 0x1055F,
+        0x10560, 0x10561, 0x10562, 0x10563, 0x10564, 0x10565, 0x10566, 0x10567,
+        0x10568, 0x10569, 0x1056A, 0x1056B, 0x1056C, 0x1056D, 0x1056E, 0x1056F,
+        0x10597, 0x10598, 0x10599, 0x1059A, 0x1059B, 0x1059C, 0x1059D, 0x1059E,
+        0x1059F, 0x105A0, 0x105A1, 0x1057B, 0x105A3, 0x105A4, 0x105A5, 0x105A6,
+    },
+    {
+        0x105A7, 0x105A8, 0x105A9, 0x105AA, 0x105AB, 0x105AC, 0x105AD, 0x105AE,
+        0x105AF, 0x105B0, 0x105B1, 0x1058B, 0x105B3, 0x105B4, 0x105B5, 0x105B6,
+        0x105B7, 0x105B8, 0x105B9, 0x10593, 0x105BB, 0x105BC, 0x10596, 0x10597,
+        0x10598, 0x10599, 0x1059A, 0x1059B, 0x1059C, 0x1059D, 0x1059E, 0x1059F,
+        0x105A0, 0x105A1, 0x105A2, 0x105A3, 0x105A4, 0x105A5, 0x105A6, 0x105A7,
+        0x105A8, 0x105A9, 0x105AA, 0x105AB, 0x105AC, 0x105AD, 0x105AE, 0x105AF,
+        0x105B0, 0x105B1, 0x105B2, 0x105B3, 0x105B4, 0x105B5, 0x105B6, 0x105B7,
+        0x105B8, 0x105B9, 0x105BA, 0x105BB, 0x105BC, 0x105BD, 0x105BE, 0x105BF,
+        0x105C0, 0x105C1, 0x105C2, 0x105C3, 0x105C4, 0x105C5, 0x105C6, 0x105C7,
+        0x105C8, 0x105C9, 0x105CA, 0x105CB, 0x105CC, 0x105CD, 0x105CE, 0x105CF,
+        0x105D0, 0x105D1, 0x105D2, 0x105D3, 0x105D4, 0x105D5, 0x105D6, 0x105D7,
+        0x105D8, 0x105D9, 0x105DA, 0x105DB, 0x105DC, 0x105DD, 0x105DE, 0x105DF,
+        0x105E0, 0x105E1, 0x105E2, 0x105E3, 0x105E4, 0x105E5, 0x105E6, 0x105E7,
+        0x105E8, 0x105E9, 0x105EA, 0x105EB, 0x105EC, 0x105ED, 0x105EE, 0x105EF,
+        0x105F0, 0x105F1, 0x105F2, 0x105F3, 0x105F4, 0x105F5, 0x105F6, 0x105F7,
+        0x105F8, 0x105F9, 0x105FA, 0x105FB, 0x105FC, 0x105FD, 0x105FE, 0x105FF,
+    },
+    {
+        0x10A00, 0x00000, 0x00000, 0x00000, 0x10A04, 0x00000, 0x00000, 0x10A07,
+        0x10A08, 0x10A09, 0x10A0A, 0x10A0B, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x10A10, 0x10A11, 0x10A12, 0x10A13, 0x10A14, 0x10A15, 0x10A16, 0x10A17,
+        0x10A18, 0x10A19, 0x10A1A, 0x10A1B, 0x10A1C, 0x10A1D, 0x10A1E, 0x10A1F,
+        0x10A20, 0x10A21, 0x10A22, 0x10A23, 0x10A24, 0x10A25, 0x10A26, 0x10A27,
+        0x10A28, 0x10A29, 0x10A2A, 0x10A2B, 0x10A2C, 0x10A2D, 0x10A2E, 0x10A2F,
+        0x10A30, 0x10A31, 0x10A32, 0x10A33, 0x10A34, 0x10A35, 0x10A36, 0x10A37,
+        0x00000, 0x00000, 0x00000, 0x10A3B, 0x10A3C, 0x10A3D, 0x10A3E, 0x00000,
+        0x10A40, 0x10A41, 0x10A42, 0x10A43, 0x10A44, 0x10A45, 0x10A46, 0x10A47,
+        0x10A48, 0x10A49, 0x10A4A, 0x10A4B, 0x10A4C, 0x10A4D, 0x10A4E, 0x10A4F,
+        0x10A50, 0x10A51, 0x10A52, 0x10A53, 0x10A54, 0x10A55, 0x10A56, 0x10A57,
+        0x10A58, 0x10A59, 0x10A5A, 0x10A5B, 0x10A5C, 0x10A5D, 0x10A5E, 0x10A5F,
+        0x10A60, 0x10A61, 0x10A62, 0x10A63, 0x10A64, 0x10A65, 0x10A66, 0x10A67,
+        0x10A68, 0x10A69, 0x10A6A, 0x10A6B, 0x10A6C, 0x10A6D, 0x10A6E, 0x10A6F,
+        0x10A70, 0x10A71, 0x10A72, 0x10A73, 0x10A74, 0x10A75, 0x10A76, 0x10A77,
+        0x10A78, 0x10A79, 0x10A7A, 0x10A7B, 0x10A7C, 0x10A7D, 0x10A7E, 0x10A7F,
+    },
+    {
+        0x10A80, 0x10A81, 0x10A82, 0x10A83, 0x10A84, 0x10A85, 0x10A86, 0x10A87,
+        0x10A88, 0x10A89, 0x10A8A, 0x10A8B, 0x10A8C, 0x10A8D, 0x10A8E, 0x10A8F,
+        0x10A90, 0x10A91, 0x10A92, 0x10A93, 0x10A94, 0x10A95, 0x10A96, 0x10A97,
+        0x10A98, 0x10A99, 0x10A9A, 0x10A9B, 0x10A9C, 0x10A9D, 0x10A9E, 0x10A9F,
+        0x10AA0, 0x10AA1, 0x10AA2, 0x10AA3, 0x10AA4, 0x10AA5, 0x10AA6, 0x10AA7,
+        0x10AA8, 0x10AA9, 0x10AAA, 0x10AAB, 0x10AAC, 0x10AAD, 0x10AAE, 0x10AAF,
+        0x10AB0, 0x10AB1, 0x10AB2, 0x10AB3, 0x10AB4, 0x10AB5, 0x10AB6, 0x10AB7,
+        0x10AB8, 0x10AB9, 0x10ABA, 0x10ABB, 0x10ABC, 0x10ABD, 0x10ABE, 0x10ABF,
+        0x10AC0, 0x10AC1, 0x10AC2, 0x10AC3, 0x10AC4, 0x10AC5, 0x10AC6, 0x10AC7,
+        0x10AC8, 0x10AC9, 0x10ACA, 0x10ACB, 0x10ACC, 0x10ACD, 0x10ACE, 0x10ACF,
+        0x10AD0, 0x10AD1, 0x10AD2, 0x10AD3, 0x10AD4, 0x10AD5, 0x10AD6, 0x10AD7,
+        0x10AD8, 0x10AD9, 0x10ADA, 0x10ADB, 0x10ADC, 0x10ADD, 0x10ADE, 0x10ADF,
+        0x10AE0, 0x10AE1, 0x10AE2, 0x10AE3, 0x10AE4, 0x00000, 0x00000, 0x10AE7,
+        0x10AE8, 0x10AE9, 0x10AEA, 0x10AEB, 0x10AEC, 0x10AED, 0x10AEE, 0x10AEF,
+        0x10AF0, 0x10AF1, 0x10AF2, 0x10AF3, 0x10AF4, 0x10AF5, 0x10AF6, 0x10AF7,
+        0x10AF8, 0x10AF9, 0x10AFA, 0x10AFB, 0x10AFC, 0x10AFD, 0x10AFE, 0x10AFF,
+    },
+    {
+        0x10CC0, 0x10CC1, 0x10CC2, 0x10CC3, 0x10CC4, 0x10CC5, 0x10CC6, 0x10CC7,
+        0x10CC8, 0x10CC9, 0x10CCA, 0x10CCB, 0x10CCC, 0x10CCD, 0x10CCE, 0x10CCF,
+        0x10CD0, 0x10CD1, 0x10CD2, 0x10CD3, 0x10CD4, 0x10CD5, 0x10CD6, 0x10CD7,
+        0x10CD8, 0x10CD9, 0x10CDA, 0x10CDB, 0x10CDC, 0x10CDD, 0x10CDE, 0x10CDF,
+        0x10CE0, 0x10CE1, 0x10CE2, 0x10CE3, 0x10CE4, 0x10CE5, 0x10CE6, 0x10CE7,
+        0x10CE8, 0x10CE9, 0x10CEA, 0x10CEB, 0x10CEC, 0x10CED, 0x10CEE, 0x10CEF,
+        0x10CF0, 0x10CF1, 0x10CF2, 0x10CB3, 0x10CB4, 0x10CB5, 0x10CB6, 0x10CB7,
+        0x10CB8, 0x10CB9, 0x10CBA, 0x10CBB, 0x10CBC, 0x10CBD, 0x10CBE, 0x10CBF,
+        0x10CC0, 0x10CC1, 0x10CC2, 0x10CC3, 0x10CC4, 0x10CC5, 0x10CC6, 0x10CC7,
+        0x10CC8, 0x10CC9, 0x10CCA, 0x10CCB, 0x10CCC, 0x10CCD, 0x10CCE, 0x10CCF,
+        0x10CD0, 0x10CD1, 0x10CD2, 0x10CD3, 0x10CD4, 0x10CD5, 0x10CD6, 0x10CD7,
+        0x10CD8, 0x10CD9, 0x10CDA, 0x10CDB, 0x10CDC, 0x10CDD, 0x10CDE, 0x10CDF,
+        0x10CE0, 0x10CE1, 0x10CE2, 0x10CE3, 0x10CE4, 0x10CE5, 0x10CE6, 0x10CE7,
+        0x10CE8, 0x10CE9, 0x10CEA, 0x10CEB, 0x10CEC, 0x10CED, 0x10CEE, 0x10CEF,
+        0x10CF0, 0x10CF1, 0x10CF2, 0x10CF3, 0x10CF4, 0x10CF5, 0x10CF6, 0x10CF7,
+        0x10CF8, 0x10CF9, 0x10CFA, 0x10CFB, 0x10CFC, 0x10CFD, 0x10CFE, 0x10CFF,
+    },
+    {
+        0x10D00, 0x10D01, 0x10D02, 0x10D03, 0x10D04, 0x10D05, 0x10D06, 0x10D07,
+        0x10D08, 0x10D09, 0x10D0A, 0x10D0B, 0x10D0C, 0x10D0D, 0x10D0E, 0x10D0F,
+        0x10D10, 0x10D11, 0x10D12, 0x10D13, 0x10D14, 0x10D15, 0x10D16, 0x10D17,
+        0x10D18, 0x10D19, 0x10D1A, 0x10D1B, 0x10D1C, 0x10D1D, 0x10D1E, 0x10D1F,
+        0x10D20, 0x10D21, 0x10D22, 0x10D23, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x10D28, 0x10D29, 0x10D2A, 0x10D2B, 0x10D2C, 0x10D2D, 0x10D2E, 0x10D2F,
+        0x10D30, 0x10D31, 0x10D32, 0x10D33, 0x10D34, 0x10D35, 0x10D36, 0x10D37,
+        0x10D38, 0x10D39, 0x10D3A, 0x10D3B, 0x10D3C, 0x10D3D, 0x10D3E, 0x10D3F,
+        0x10D40, 0x10D41, 0x10D42, 0x10D43, 0x10D44, 0x10D45, 0x10D46, 0x10D47,
+        0x10D48, 0x10D49, 0x10D4A, 0x10D4B, 0x10D4C, 0x10D4D, 0x10D4E, 0x10D4F,
+        0x10D50, 0x10D51, 0x10D52, 0x10D53, 0x10D54, 0x10D55, 0x10D56, 0x10D57,
+        0x10D58, 0x10D59, 0x10D5A, 0x10D5B, 0x10D5C, 0x10D5D, 0x10D5E, 0x10D5F,
+        0x10D60, 0x10D61, 0x10D62, 0x10D63, 0x10D64, 0x10D65, 0x10D66, 0x10D67,
+        0x10D68, 0x10D69, 0x10D6A, 0x10D6B, 0x10D6C, 0x10D6D, 0x10D6E, 0x10D6F,
+        0x10D70, 0x10D71, 0x10D72, 0x10D73, 0x10D74, 0x10D75, 0x10D76, 0x10D77,
+        0x10D78, 0x10D79, 0x10D7A, 0x10D7B, 0x10D7C, 0x10D7D, 0x10D7E, 0x10D7F,
+    },
+    {
+        0x10E80, 0x10E81, 0x10E82, 0x10E83, 0x10E84, 0x10E85, 0x10E86, 0x10E87,
+        0x10E88, 0x10E89, 0x10E8A, 0x10E8B, 0x10E8C, 0x10E8D, 0x10E8E, 0x10E8F,
+        0x10E90, 0x10E91, 0x10E92, 0x10E93, 0x10E94, 0x10E95, 0x10E96, 0x10E97,
+        0x10E98, 0x10E99, 0x10E9A, 0x10E9B, 0x10E9C, 0x10E9D, 0x10E9E, 0x10E9F,
+        0x10EA0, 0x10EA1, 0x10EA2, 0x10EA3, 0x10EA4, 0x10EA5, 0x10EA6, 0x10EA7,
+        0x10EA8, 0x10EA9, 0x10EAA, 0x00000, 0x00000, 0x10EAD, 0x10EAE, 0x10EAF,
+        0x10EB0, 0x10EB1, 0x10EB2, 0x10EB3, 0x10EB4, 0x10EB5, 0x10EB6, 0x10EB7,
+        0x10EB8, 0x10EB9, 0x10EBA, 0x10EBB, 0x10EBC, 0x10EBD, 0x10EBE, 0x10EBF,
+        0x10EC0, 0x10EC1, 0x10EC2, 0x10EC3, 0x10EC4, 0x10EC5, 0x10EC6, 0x10EC7,
+        0x10EC8, 0x10EC9, 0x10ECA, 0x10ECB, 0x10ECC, 0x10ECD, 0x10ECE, 0x10ECF,
+        0x10ED0, 0x10ED1, 0x10ED2, 0x10ED3, 0x10ED4, 0x10ED5, 0x10ED6, 0x10ED7,
+        0x10ED8, 0x10ED9, 0x10EDA, 0x10EDB, 0x10EDC, 0x10EDD, 0x10EDE, 0x10EDF,
+        0x10EE0, 0x10EE1, 0x10EE2, 0x10EE3, 0x10EE4, 0x10EE5, 0x10EE6, 0x10EE7,
+        0x10EE8, 0x10EE9, 0x10EEA, 0x10EEB, 0x10EEC, 0x10EED, 0x10EEE, 0x10EEF,
+        0x10EF0, 0x10EF1, 0x10EF2, 0x10EF3, 0x10EF4, 0x10EF5, 0x10EF6, 0x10EF7,
+        0x10EF8, 0x10EF9, 0x10EFA, 0x10EFB, 0x10EFC, 0x10EFD, 0x10EFE, 0x10EFF,
+    },
+    {
+        0x10F00, 0x10F01, 0x10F02, 0x10F03, 0x10F04, 0x10F05, 0x10F06, 0x10F07,
+        0x10F08, 0x10F09, 0x10F0A, 0x10F0B, 0x10F0C, 0x10F0D, 0x10F0E, 0x10F0F,
+        0x10F10, 0x10F11, 0x10F12, 0x10F13, 0x10F14, 0x10F15, 0x10F16, 0x10F17,
+        0x10F18, 0x10F19, 0x10F1A, 0x10F1B, 0x10F1C, 0x10F1D, 0x10F1E, 0x10F1F,
+        0x10F20, 0x10F21, 0x10F22, 0x10F23, 0x10F24, 0x10F25, 0x10F26, 0x10F27,
+        0x10F28, 0x10F29, 0x10F2A, 0x10F2B, 0x10F2C, 0x10F2D, 0x10F2E, 0x10F2F,
+        0x10F30, 0x10F31, 0x10F32, 0x10F33, 0x10F34, 0x10F35, 0x10F36, 0x10F37,
+        0x10F38, 0x10F39, 0x10F3A, 0x10F3B, 0x10F3C, 0x10F3D, 0x10F3E, 0x10F3F,
+        0x10F40, 0x10F41, 0x10F42, 0x10F43, 0x10F44, 0x10F45, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x10F51, 0x10F52, 0x10F53, 0x10F54, 0x10F55, 0x10F56, 0x10F57,
+        0x10F58, 0x10F59, 0x10F5A, 0x10F5B, 0x10F5C, 0x10F5D, 0x10F5E, 0x10F5F,
+        0x10F60, 0x10F61, 0x10F62, 0x10F63, 0x10F64, 0x10F65, 0x10F66, 0x10F67,
+        0x10F68, 0x10F69, 0x10F6A, 0x10F6B, 0x10F6C, 0x10F6D, 0x10F6E, 0x10F6F,
+        0x10F70, 0x10F71, 0x10F72, 0x10F73, 0x10F74, 0x10F75, 0x10F76, 0x10F77,
+        0x10F78, 0x10F79, 0x10F7A, 0x10F7B, 0x10F7C, 0x10F7D, 0x10F7E, 0x10F7F,
+    },
+    {
+        0x10F80, 0x10F81, 0x00000, 0x00000, 0x00000, 0x00000, 0x10F86, 0x10F87,
+        0x10F88, 0x10F89, 0x10F8A, 0x10F8B, 0x10F8C, 0x10F8D, 0x10F8E, 0x10F8F,
+        0x10F90, 0x10F91, 0x10F92, 0x10F93, 0x10F94, 0x10F95, 0x10F96, 0x10F97,
+        0x10F98, 0x10F99, 0x10F9A, 0x10F9B, 0x10F9C, 0x10F9D, 0x10F9E, 0x10F9F,
+        0x10FA0, 0x10FA1, 0x10FA2, 0x10FA3, 0x10FA4, 0x10FA5, 0x10FA6, 0x10FA7,
+        0x10FA8, 0x10FA9, 0x10FAA, 0x10FAB, 0x10FAC, 0x10FAD, 0x10FAE, 0x10FAF,
+        0x10FB0, 0x10FB1, 0x10FB2, 0x10FB3, 0x10FB4, 0x10FB5, 0x10FB6, 0x10FB7,
+        0x10FB8, 0x10FB9, 0x10FBA, 0x10FBB, 0x10FBC, 0x10FBD, 0x10FBE, 0x10FBF,
+        0x10FC0, 0x10FC1, 0x10FC2, 0x10FC3, 0x10FC4, 0x10FC5, 0x10FC6, 0x10FC7,
+        0x10FC8, 0x10FC9, 0x10FCA, 0x10FCB, 0x10FCC, 0x10FCD, 0x10FCE, 0x10FCF,
+        0x10FD0, 0x10FD1, 0x10FD2, 0x10FD3, 0x10FD4, 0x10FD5, 0x10FD6, 0x10FD7,
+        0x10FD8, 0x10FD9, 0x10FDA, 0x10FDB, 0x10FDC, 0x10FDD, 0x10FDE, 0x10FDF,
+        0x10FE0, 0x10FE1, 0x10FE2, 0x10FE3, 0x10FE4, 0x10FE5, 0x10FE6, 0x10FE7,
+        0x10FE8, 0x10FE9, 0x10FEA, 0x10FEB, 0x10FEC, 0x10FED, 0x10FEE, 0x10FEF,
+        0x10FF0, 0x10FF1, 0x10FF2, 0x10FF3, 0x10FF4, 0x10FF5, 0x10FF6, 0x10FF7,
+        0x10FF8, 0x10FF9, 0x10FFA, 0x10FFB, 0x10FFC, 0x10FFD, 0x10FFE, 0x10FFF,
+    },
+    {
+        0x11000, 0x00000, 0x11002, 0x11003, 0x11004, 0x11005, 0x11006, 0x11007,
+        0x11008, 0x11009, 0x1100A, 0x1100B, 0x1100C, 0x1100D, 0x1100E, 0x1100F,
+        0x11010, 0x11011, 0x11012, 0x11013, 0x11014, 0x11015, 0x11016, 0x11017,
+        0x11018, 0x11019, 0x1101A, 0x1101B, 0x1101C, 0x1101D, 0x1101E, 0x1101F,
+        0x11020, 0x11021, 0x11022, 0x11023, 0x11024, 0x11025, 0x11026, 0x11027,
+        0x11028, 0x11029, 0x1102A, 0x1102B, 0x1102C, 0x1102D, 0x1102E, 0x1102F,
+        0x11030, 0x11031, 0x11032, 0x11033, 0x11034, 0x11035, 0x11036, 0x11037,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x11047,
+        0x11048, 0x11049, 0x1104A, 0x1104B, 0x1104C, 0x1104D, 0x1104E, 0x1104F,
+        0x11050, 0x11051, 0x11052, 0x11053, 0x11054, 0x11055, 0x11056, 0x11057,
+        0x11058, 0x11059, 0x1105A, 0x1105B, 0x1105C, 0x1105D, 0x1105E, 0x1105F,
+        0x11060, 0x11061, 0x11062, 0x11063, 0x11064, 0x11065, 0x11066, 0x11067,
+        0x11068, 0x11069, 0x1106A, 0x1106B, 0x1106C, 0x1106D, 0x1106E, 0x1106F,
+        0x00000, 0x11071, 0x11072, 0x00000, 0x00000, 0x11075, 0x11076, 0x11077,
+        0x11078, 0x11079, 0x1107A, 0x1107B, 0x1107C, 0x1107D, 0x1107E, 0x00000,
+    },
+    {
+        0x00000, 0x00000, 0x11082, 0x11083, 0x11084, 0x11085, 0x11086, 0x11087,
+        0x11088, 0x11089, 0x1108A, 0x1108B, 0x1108C, 0x1108D, 0x1108E, 0x1108F,
+        0x11090, 0x11091, 0x11092, 0x11093, 0x11094, 0x11095, 0x11096, 0x11097,
+        0x11098, 0x11099, 0x11099, 0x1109B, 0x1109B, 0x1109D, 0x1109E, 0x1109F,
+        0x110A0, 0x110A1, 0x110A2, 0x110A3, 0x110A4, 0x110A5, 0x110A6, 0x110A7,
+        0x110A8, 0x110A9, 0x110AA, 0x110A5, 0x110AC, 0x110AD, 0x110AE, 0x110AF,
+        0x110B0, 0x110B1, 0x110B2, 0x00000, 0x00000, 0x00000, 0x00000, 0x110B7,
+        0x110B8, 0x00000, 0x00000, 0x110BB, 0x110BC, 0x110BD, 0x110BE, 0x110BF,
+        0x110C0, 0x110C1, 0x00000, 0x110C3, 0x110C4, 0x110C5, 0x110C6, 0x110C7,
+        0x110C8, 0x110C9, 0x110CA, 0x110CB, 0x110CC, 0x110CD, 0x110CE, 0x110CF,
+        0x110D0, 0x110D1, 0x110D2, 0x110D3, 0x110D4, 0x110D5, 0x110D6, 0x110D7,
+        0x110D8, 0x110D9, 0x110DA, 0x110DB, 0x110DC, 0x110DD, 0x110DE, 0x110DF,
+        0x110E0, 0x110E1, 0x110E2, 0x110E3, 0x110E4, 0x110E5, 0x110E6, 0x110E7,
+        0x110E8, 0x110E9, 0x110EA, 0x110EB, 0x110EC, 0x110ED, 0x110EE, 0x110EF,
+        0x110F0, 0x110F1, 0x110F2, 0x110F3, 0x110F4, 0x110F5, 0x110F6, 0x110F7,
+        0x110F8, 0x110F9, 0x110FA, 0x110FB, 0x110FC, 0x110FD, 0x110FE, 0x110FF,
+    },
+    {
+        0x00000, 0x00000, 0x00000, 0x11103, 0x11104, 0x11105, 0x11106, 0x11107,
+        0x11108, 0x11109, 0x1110A, 0x1110B, 0x1110C, 0x1110D, 0x1110E, 0x1110F,
+        0x11110, 0x11111, 0x11112, 0x11113, 0x11114, 0x11115, 0x11116, 0x11117,
+        0x11118, 0x11119, 0x1111A, 0x1111B, 0x1111C, 0x1111D, 0x1111E, 0x1111F,
+        0x11120, 0x11121, 0x11122, 0x11123, 0x11124, 0x11125, 0x11126, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x1112C, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x11135, 0x11136, 0x11137,
+        0x11138, 0x11139, 0x1113A, 0x1113B, 0x1113C, 0x1113D, 0x1113E, 0x1113F,
+        0x11140, 0x11141, 0x11142, 0x11143, 0x11144, 0x11145, 0x11146, 0x11147,
+        0x11148, 0x11149, 0x1114A, 0x1114B, 0x1114C, 0x1114D, 0x1114E, 0x1114F,
+        0x11150, 0x11151, 0x11152, 0x11153, 0x11154, 0x11155, 0x11156, 0x11157,
+        0x11158, 0x11159, 0x1115A, 0x1115B, 0x1115C, 0x1115D, 0x1115E, 0x1115F,
+        0x11160, 0x11161, 0x11162, 0x11163, 0x11164, 0x11165, 0x11166, 0x11167,
+        0x11168, 0x11169, 0x1116A, 0x1116B, 0x1116C, 0x1116D, 0x1116E, 0x1116F,
+        0x11170, 0x11171, 0x11172, 0x00000, 0x11174, 0x11175, 0x11176, 0x11177,
+        0x11178, 0x11179, 0x1117A, 0x1117B, 0x1117C, 0x1117D, 0x1117E, 0x1117F,
+    },
+    {
+        0x00000, 0x00000, 0x11182, 0x11183, 0x11184, 0x11185, 0x11186, 0x11187,
+        0x11188, 0x11189, 0x1118A, 0x1118B, 0x1118C, 0x1118D, 0x1118E, 0x1118F,
+        0x11190, 0x11191, 0x11192, 0x11193, 0x11194, 0x11195, 0x11196, 0x11197,
+        0x11198, 0x11199, 0x1119A, 0x1119B, 0x1119C, 0x1119D, 0x1119E, 0x1119F,
+        0x111A0, 0x111A1, 0x111A2, 0x111A3, 0x111A4, 0x111A5, 0x111A6, 0x111A7,
+        0x111A8, 0x111A9, 0x111AA, 0x111AB, 0x111AC, 0x111AD, 0x111AE, 0x111AF,
+        0x111B0, 0x111B1, 0x111B2, 0x111B3, 0x111B4, 0x111B5, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x111BF,
+        0x111C0, 0x111C1, 0x111C2, 0x111C3, 0x111C4, 0x111C5, 0x111C6, 0x111C7,
+        0x111C8, 0x00000, 0x00000, 0x00000, 0x00000, 0x111CD, 0x111CE, 0x00000,
+        0x111D0, 0x111D1, 0x111D2, 0x111D3, 0x111D4, 0x111D5, 0x111D6, 0x111D7,
+        0x111D8, 0x111D9, 0x111DA, 0x111DB, 0x111DC, 0x111DD, 0x111DE, 0x111DF,
+        0x111E0, 0x111E1, 0x111E2, 0x111E3, 0x111E4, 0x111E5, 0x111E6, 0x111E7,
+        0x111E8, 0x111E9, 0x111EA, 0x111EB, 0x111EC, 0x111ED, 0x111EE, 0x111EF,
+        0x111F0, 0x111F1, 0x111F2, 0x111F3, 0x111F4, 0x111F5, 0x111F6, 0x111F7,
+        0x111F8, 0x111F9, 0x111FA, 0x111FB, 0x111FC, 0x111FD, 0x111FE, 0x111FF,
+    },
+    {
+        0x11200, 0x11201, 0x11202, 0x11203, 0x11204, 0x11205, 0x11206, 0x11207,
+        0x11208, 0x11209, 0x1120A, 0x1120B, 0x1120C, 0x1120D, 0x1120E, 0x1120F,
+        0x11210, 0x11211, 0x11212, 0x11213, 0x11214, 0x11215, 0x11216, 0x11217,
+        0x11218, 0x11219, 0x1121A, 0x1121B, 0x1121C, 0x1121D, 0x1121E, 0x1121F,
+        0x11220, 0x11221, 0x11222, 0x11223, 0x11224, 0x11225, 0x11226, 0x11227,
+        0x11228, 0x11229, 0x1122A, 0x1122B, 0x1122C, 0x1122D, 0x1122E, 0x00000,
+        0x00000, 0x00000, 0x11232, 0x11233, 0x00000, 0x11235, 0x00000, 0x00000,
+        0x11238, 0x11239, 0x1123A, 0x1123B, 0x1123C, 0x1123D, 0x00000, 0x1123F,
+        0x11240, 0x11241, 0x11242, 0x11243, 0x11244, 0x11245, 0x11246, 0x11247,
+        0x11248, 0x11249, 0x1124A, 0x1124B, 0x1124C, 0x1124D, 0x1124E, 0x1124F,
+        0x11250, 0x11251, 0x11252, 0x11253, 0x11254, 0x11255, 0x11256, 0x11257,
+        0x11258, 0x11259, 0x1125A, 0x1125B, 0x1125C, 0x1125D, 0x1125E, 0x1125F,
+        0x11260, 0x11261, 0x11262, 0x11263, 0x11264, 0x11265, 0x11266, 0x11267,
+        0x11268, 0x11269, 0x1126A, 0x1126B, 0x1126C, 0x1126D, 0x1126E, 0x1126F,
+        0x11270, 0x11271, 0x11272, 0x11273, 0x11274, 0x11275, 0x11276, 0x11277,
+        0x11278, 0x11279, 0x1127A, 0x1127B, 0x1127C, 0x1127D, 0x1127E, 0x1127F,
+    },
+    {
+        0x11280, 0x11281, 0x11282, 0x11283, 0x11284, 0x11285, 0x11286, 0x11287,
+        0x11288, 0x11289, 0x1128A, 0x1128B, 0x1128C, 0x1128D, 0x1128E, 0x1128F,
+        0x11290, 0x11291, 0x11292, 0x11293, 0x11294, 0x11295, 0x11296, 0x11297,
+        0x11298, 0x11299, 0x1129A, 0x1129B, 0x1129C, 0x1129D, 0x1129E, 0x1129F,
+        0x112A0, 0x112A1, 0x112A2, 0x112A3, 0x112A4, 0x112A5, 0x112A6, 0x112A7,
+        0x112A8, 0x112A9, 0x112AA, 0x112AB, 0x112AC, 0x112AD, 0x112AE, 0x112AF,
+        0x112B0, 0x112B1, 0x112B2, 0x112B3, 0x112B4, 0x112B5, 0x112B6, 0x112B7,
+        0x112B8, 0x112B9, 0x112BA, 0x112BB, 0x112BC, 0x112BD, 0x112BE, 0x112BF,
+        0x112C0, 0x112C1, 0x112C2, 0x112C3, 0x112C4, 0x112C5, 0x112C6, 0x112C7,
+        0x112C8, 0x112C9, 0x112CA, 0x112CB, 0x112CC, 0x112CD, 0x112CE, 0x112CF,
+        0x112D0, 0x112D1, 0x112D2, 0x112D3, 0x112D4, 0x112D5, 0x112D6, 0x112D7,
+        0x112D8, 0x112D9, 0x112DA, 0x112DB, 0x112DC, 0x112DD, 0x112DE, 0x00000,
+        0x112E0, 0x112E1, 0x112E2, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x112EB, 0x112EC, 0x112ED, 0x112EE, 0x112EF,
+        0x112F0, 0x112F1, 0x112F2, 0x112F3, 0x112F4, 0x112F5, 0x112F6, 0x112F7,
+        0x112F8, 0x112F9, 0x112FA, 0x112FB, 0x112FC, 0x112FD, 0x112FE, 0x112FF,
+    },
+    {
+        0x00000, 0x00000, 0x11302, 0x11303, 0x11304, 0x11305, 0x11306, 0x11307,
+        0x11308, 0x11309, 0x1130A, 0x1130B, 0x1130C, 0x1130D, 0x1130E, 0x1130F,
+        0x11310, 0x11311, 0x11312, 0x11313, 0x11314, 0x11315, 0x11316, 0x11317,
+        0x11318, 0x11319, 0x1131A, 0x1131B, 0x1131C, 0x1131D, 0x1131E, 0x1131F,
+        0x11320, 0x11321, 0x11322, 0x11323, 0x11324, 0x11325, 0x11326, 0x11327,
+        0x11328, 0x11329, 0x1132A, 0x1132B, 0x1132C, 0x1132D, 0x1132E, 0x1132F,
+        0x11330, 0x11331, 0x11332, 0x11333, 0x11334, 0x11335, 0x11336, 0x11337,
+        0x11338, 0x11339, 0x1133A, 0x00000, 0x00000, 0x1133D, 0x1133E, 0x1133F,
+        0x00000, 0x11341, 0x11342, 0x11343, 0x11344, 0x11345, 0x11346, 0x11347,
+        0x11348, 0x11349, 0x1134A, 0x80000016, 0x80000017, 0x1134D, 0x1134E, 0x1134F,
+        0x11350, 0x11351, 0x11352, 0x11353, 0x11354, 0x11355, 0x11356, 0x11357,
+        0x11358, 0x11359, 0x1135A, 0x1135B, 0x1135C, 0x1135D, 0x1135E, 0x1135F,
+        0x11360, 0x11361, 0x11362, 0x11363, 0x11364, 0x11365, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x1136D, 0x1136E, 0x1136F,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x11375, 0x11376, 0x11377,
+        0x11378, 0x11379, 0x1137A, 0x1137B, 0x1137C, 0x1137D, 0x1137E, 0x1137F,
+    },
+    {
+        0x11400, 0x11401, 0x11402, 0x11403, 0x11404, 0x11405, 0x11406, 0x11407,
+        0x11408, 0x11409, 0x1140A, 0x1140B, 0x1140C, 0x1140D, 0x1140E, 0x1140F,
+        0x11410, 0x11411, 0x11412, 0x11413, 0x11414, 0x11415, 0x11416, 0x11417,
+        0x11418, 0x11419, 0x1141A, 0x1141B, 0x1141C, 0x1141D, 0x1141E, 0x1141F,
+        0x11420, 0x11421, 0x11422, 0x11423, 0x11424, 0x11425, 0x11426, 0x11427,
+        0x11428, 0x11429, 0x1142A, 0x1142B, 0x1142C, 0x1142D, 0x1142E, 0x1142F,
+        0x11430, 0x11431, 0x11432, 0x11433, 0x11434, 0x11435, 0x11436, 0x11437,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x11440, 0x11441, 0x00000, 0x00000, 0x00000, 0x11445, 0x00000, 0x11447,
+        0x11448, 0x11449, 0x1144A, 0x1144B, 0x1144C, 0x1144D, 0x1144E, 0x1144F,
+        0x11450, 0x11451, 0x11452, 0x11453, 0x11454, 0x11455, 0x11456, 0x11457,
+        0x11458, 0x11459, 0x1145A, 0x1145B, 0x1145C, 0x1145D, 0x00000, 0x1145F,
+        0x11460, 0x11461, 0x11462, 0x11463, 0x11464, 0x11465, 0x11466, 0x11467,
+        0x11468, 0x11469, 0x1146A, 0x1146B, 0x1146C, 0x1146D, 0x1146E, 0x1146F,
+        0x11470, 0x11471, 0x11472, 0x11473, 0x11474, 0x11475, 0x11476, 0x11477,
+        0x11478, 0x11479, 0x1147A, 0x1147B, 0x1147C, 0x1147D, 0x1147E, 0x1147F,
+    },
+    {
+        0x11480, 0x11481, 0x11482, 0x11483, 0x11484, 0x11485, 0x11486, 0x11487,
+        0x11488, 0x11489, 0x1148A, 0x1148B, 0x1148C, 0x1148D, 0x1148E, 0x1148F,
+        0x11490, 0x11491, 0x11492, 0x11493, 0x11494, 0x11495, 0x11496, 0x11497,
+        0x11498, 0x11499, 0x1149A, 0x1149B, 0x1149C, 0x1149D, 0x1149E, 0x1149F,
+        0x114A0, 0x114A1, 0x114A2, 0x114A3, 0x114A4, 0x114A5, 0x114A6, 0x114A7,
+        0x114A8, 0x114A9, 0x114AA, 0x114AB, 0x114AC, 0x114AD, 0x114AE, 0x114AF,
+        0x114B0, 0x114B1, 0x114B2, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x114B9, 0x00000, 0x114B9, 0x80000018, 0x114BD, 0x80000019, 0x00000,
+        0x00000, 0x114C1, 0x00000, 0x00000, 0x114C4, 0x114C5, 0x114C6, 0x114C7,
+        0x114C8, 0x114C9, 0x114CA, 0x114CB, 0x114CC, 0x114CD, 0x114CE, 0x114CF,
+        0x114D0, 0x114D1, 0x114D2, 0x114D3, 0x114D4, 0x114D5, 0x114D6, 0x114D7,
+        0x114D8, 0x114D9, 0x114DA, 0x114DB, 0x114DC, 0x114DD, 0x114DE, 0x114DF,
+        0x114E0, 0x114E1, 0x114E2, 0x114E3, 0x114E4, 0x114E5, 0x114E6, 0x114E7,
+        0x114E8, 0x114E9, 0x114EA, 0x114EB, 0x114EC, 0x114ED, 0x114EE, 0x114EF,
+        0x114F0, 0x114F1, 0x114F2, 0x114F3, 0x114F4, 0x114F5, 0x114F6, 0x114F7,
+        0x114F8, 0x114F9, 0x114FA, 0x114FB, 0x114FC, 0x114FD, 0x114FE, 0x114FF,
+    },
+    {
+        0x11580, 0x11581, 0x11582, 0x11583, 0x11584, 0x11585, 0x11586, 0x11587,
+        0x11588, 0x11589, 0x1158A, 0x1158B, 0x1158C, 0x1158D, 0x1158E, 0x1158F,
+        0x11590, 0x11591, 0x11592, 0x11593, 0x11594, 0x11595, 0x11596, 0x11597,
+        0x11598, 0x11599, 0x1159A, 0x1159B, 0x1159C, 0x1159D, 0x1159E, 0x1159F,
+        0x115A0, 0x115A1, 0x115A2, 0x115A3, 0x115A4, 0x115A5, 0x115A6, 0x115A7,
+        0x115A8, 0x115A9, 0x115AA, 0x115AB, 0x115AC, 0x115AD, 0x115AE, 0x115AF,
+        0x115B0, 0x115B1, 0x00000, 0x00000, 0x00000, 0x00000, 0x115B6, 0x115B7,
+        0x115B8, 0x115B9, 0x8000001A, 0x8000001B, 0x00000, 0x00000, 0x115BE, 0x00000,
+        0x00000, 0x115C1, 0x115C2, 0x115C3, 0x115C4, 0x115C5, 0x115C6, 0x115C7,
+        0x115C8, 0x115C9, 0x115CA, 0x115CB, 0x115CC, 0x115CD, 0x115CE, 0x115CF,
+        0x115D0, 0x115D1, 0x115D2, 0x115D3, 0x115D4, 0x115D5, 0x115D6, 0x115D7,
+        0x115D8, 0x115D9, 0x115DA, 0x115DB, 0x00000, 0x00000, 0x115DE, 0x115DF,
+        0x115E0, 0x115E1, 0x115E2, 0x115E3, 0x115E4, 0x115E5, 0x115E6, 0x115E7,
+        0x115E8, 0x115E9, 0x115EA, 0x115EB, 0x115EC, 0x115ED, 0x115EE, 0x115EF,
+        0x115F0, 0x115F1, 0x115F2, 0x115F3, 0x115F4, 0x115F5, 0x115F6, 0x115F7,
+        0x115F8, 0x115F9, 0x115FA, 0x115FB, 0x115FC, 0x115FD, 0x115FE, 0x115FF,
+    },
+    {
+        0x11600, 0x11601, 0x11602, 0x11603, 0x11604, 0x11605, 0x11606, 0x11607,
+        0x11608, 0x11609, 0x1160A, 0x1160B, 0x1160C, 0x1160D, 0x1160E, 0x1160F,
+        0x11610, 0x11611, 0x11612, 0x11613, 0x11614, 0x11615, 0x11616, 0x11617,
+        0x11618, 0x11619, 0x1161A, 0x1161B, 0x1161C, 0x1161D, 0x1161E, 0x1161F,
+        0x11620, 0x11621, 0x11622, 0x11623, 0x11624, 0x11625, 0x11626, 0x11627,
+        0x11628, 0x11629, 0x1162A, 0x1162B, 0x1162C, 0x1162D, 0x1162E, 0x1162F,
+        0x11630, 0x11631, 0x11632, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x1163B, 0x1163C, 0x00000, 0x1163E, 0x00000,
+        0x00000, 0x11641, 0x11642, 0x11643, 0x11644, 0x11645, 0x11646, 0x11647,
+        0x11648, 0x11649, 0x1164A, 0x1164B, 0x1164C, 0x1164D, 0x1164E, 0x1164F,
+        0x11650, 0x11651, 0x11652, 0x11653, 0x11654, 0x11655, 0x11656, 0x11657,
+        0x11658, 0x11659, 0x1165A, 0x1165B, 0x1165C, 0x1165D, 0x1165E, 0x1165F,
+        0x11660, 0x11661, 0x11662, 0x11663, 0x11664, 0x11665, 0x11666, 0x11667,
+        0x11668, 0x11669, 0x1166A, 0x1166B, 0x1166C, 0x1166D, 0x1166E, 0x1166F,
+        0x11670, 0x11671, 0x11672, 0x11673, 0x11674, 0x11675, 0x11676, 0x11677,
+        0x11678, 0x11679, 0x1167A, 0x1167B, 0x1167C, 0x1167D, 0x1167E, 0x1167F,
+    },
+    {
+        0x11680, 0x11681, 0x11682, 0x11683, 0x11684, 0x11685, 0x11686, 0x11687,
+        0x11688, 0x11689, 0x1168A, 0x1168B, 0x1168C, 0x1168D, 0x1168E, 0x1168F,
+        0x11690, 0x11691, 0x11692, 0x11693, 0x11694, 0x11695, 0x11696, 0x11697,
+        0x11698, 0x11699, 0x1169A, 0x1169B, 0x1169C, 0x1169D, 0x1169E, 0x1169F,
+        0x116A0, 0x116A1, 0x116A2, 0x116A3, 0x116A4, 0x116A5, 0x116A6, 0x116A7,
+        0x116A8, 0x116A9, 0x116AA, 0x00000, 0x116AC, 0x00000, 0x116AE, 0x116AF,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x116B6, 0x00000,
+        0x116B8, 0x116B9, 0x116BA, 0x116BB, 0x116BC, 0x116BD, 0x116BE, 0x116BF,
+        0x116C0, 0x116C1, 0x116C2, 0x116C3, 0x116C4, 0x116C5, 0x116C6, 0x116C7,
+        0x116C8, 0x116C9, 0x116CA, 0x116CB, 0x116CC, 0x116CD, 0x116CE, 0x116CF,
+        0x116D0, 0x116D1, 0x116D2, 0x116D3, 0x116D4, 0x116D5, 0x116D6, 0x116D7,
+        0x116D8, 0x116D9, 0x116DA, 0x116DB, 0x116DC, 0x116DD, 0x116DE, 0x116DF,
+        0x116E0, 0x116E1, 0x116E2, 0x116E3, 0x116E4, 0x116E5, 0x116E6, 0x116E7,
+        0x116E8, 0x116E9, 0x116EA, 0x116EB, 0x116EC, 0x116ED, 0x116EE, 0x116EF,
+        0x116F0, 0x116F1, 0x116F2, 0x116F3, 0x116F4, 0x116F5, 0x116F6, 0x116F7,
+        0x116F8, 0x116F9, 0x116FA, 0x116FB, 0x116FC, 0x116FD, 0x116FE, 0x116FF,
+    },
+    {
+        0x11700, 0x11701, 0x11702, 0x11703, 0x11704, 0x11705, 0x11706, 0x11707,
+        0x11708, 0x11709, 0x1170A, 0x1170B, 0x1170C, 0x1170D, 0x1170E, 0x1170F,
+        0x11710, 0x11711, 0x11712, 0x11713, 0x11714, 0x11715, 0x11716, 0x11717,
+        0x11718, 0x11719, 0x1171A, 0x1171B, 0x1171C, 0x00000, 0x00000, 0x00000,
+        0x11720, 0x11721, 0x00000, 0x00000, 0x00000, 0x00000, 0x11726, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x1172C, 0x1172D, 0x1172E, 0x1172F,
+        0x11730, 0x11731, 0x11732, 0x11733, 0x11734, 0x11735, 0x11736, 0x11737,
+        0x11738, 0x11739, 0x1173A, 0x1173B, 0x1173C, 0x1173D, 0x1173E, 0x1173F,
+        0x11740, 0x11741, 0x11742, 0x11743, 0x11744, 0x11745, 0x11746, 0x11747,
+        0x11748, 0x11749, 0x1174A, 0x1174B, 0x1174C, 0x1174D, 0x1174E, 0x1174F,
+        0x11750, 0x11751, 0x11752, 0x11753, 0x11754, 0x11755, 0x11756, 0x11757,
+        0x11758, 0x11759, 0x1175A, 0x1175B, 0x1175C, 0x1175D, 0x1175E, 0x1175F,
+        0x11760, 0x11761, 0x11762, 0x11763, 0x11764, 0x11765, 0x11766, 0x11767,
+        0x11768, 0x11769, 0x1176A, 0x1176B, 0x1176C, 0x1176D, 0x1176E, 0x1176F,
+        0x11770, 0x11771, 0x11772, 0x11773, 0x11774, 0x11775, 0x11776, 0x11777,
+        0x11778, 0x11779, 0x1177A, 0x1177B, 0x1177C, 0x1177D, 0x1177E, 0x1177F,
+    },
+    {
+        0x11800, 0x11801, 0x11802, 0x11803, 0x11804, 0x11805, 0x11806, 0x11807,
+        0x11808, 0x11809, 0x1180A, 0x1180B, 0x1180C, 0x1180D, 0x1180E, 0x1180F,
+        0x11810, 0x11811, 0x11812, 0x11813, 0x11814, 0x11815, 0x11816, 0x11817,
+        0x11818, 0x11819, 0x1181A, 0x1181B, 0x1181C, 0x1181D, 0x1181E, 0x1181F,
+        0x11820, 0x11821, 0x11822, 0x11823, 0x11824, 0x11825, 0x11826, 0x11827,
+        0x11828, 0x11829, 0x1182A, 0x1182B, 0x1182C, 0x1182D, 0x1182E, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x11838, 0x00000, 0x00000, 0x1183B, 0x1183C, 0x1183D, 0x1183E, 0x1183F,
+        0x11840, 0x11841, 0x11842, 0x11843, 0x11844, 0x11845, 0x11846, 0x11847,
+        0x11848, 0x11849, 0x1184A, 0x1184B, 0x1184C, 0x1184D, 0x1184E, 0x1184F,
+        0x11850, 0x11851, 0x11852, 0x11853, 0x11854, 0x11855, 0x11856, 0x11857,
+        0x11858, 0x11859, 0x1185A, 0x1185B, 0x1185C, 0x1185D, 0x1185E, 0x1185F,
+        0x11860, 0x11861, 0x11862, 0x11863, 0x11864, 0x11865, 0x11866, 0x11867,
+        0x11868, 0x11869, 0x1186A, 0x1186B, 0x1186C, 0x1186D, 0x1186E, 0x1186F,
+        0x11870, 0x11871, 0x11872, 0x11873, 0x11874, 0x11875, 0x11876, 0x11877,
+        0x11878, 0x11879, 0x1187A, 0x1187B, 0x1187C, 0x1187D, 0x1187E, 0x1187F,
+    },
+    {
+        0x11880, 0x11881, 0x11882, 0x11883, 0x11884, 0x11885, 0x11886, 0x11887,
+        0x11888, 0x11889, 0x1188A, 0x1188B, 0x1188C, 0x1188D, 0x1188E, 0x1188F,
+        0x11890, 0x11891, 0x11892, 0x11893, 0x11894, 0x11895, 0x11896, 0x11897,
+        0x11898, 0x11899, 0x1189A, 0x1189B, 0x1189C, 0x1189D, 0x1189E, 0x1189F,
+        0x118C0, 0x118C1, 0x118C2, 0x118C3, 0x118C4, 0x118C5, 0x118C6, 0x118C7,
+        0x118C8, 0x118C9, 0x118CA, 0x118CB, 0x118CC, 0x118CD, 0x118CE, 0x118CF,
+        0x118D0, 0x118D1, 0x118D2, 0x118D3, 0x118D4, 0x118D5, 0x118D6, 0x118D7,
+        0x118D8, 0x118D9, 0x118DA, 0x118DB, 0x118DC, 0x118DD, 0x118DE, 0x118DF,
+        0x118C0, 0x118C1, 0x118C2, 0x118C3, 0x118C4, 0x118C5, 0x118C6, 0x118C7,
+        0x118C8, 0x118C9, 0x118CA, 0x118CB, 0x118CC, 0x118CD, 0x118CE, 0x118CF,
+        0x118D0, 0x118D1, 0x118D2, 0x118D3, 0x118D4, 0x118D5, 0x118D6, 0x118D7,
+        0x118D8, 0x118D9, 0x118DA, 0x118DB, 0x118DC, 0x118DD, 0x118DE, 0x118DF,
+        0x118E0, 0x118E1, 0x118E2, 0x118E3, 0x118E4, 0x118E5, 0x118E6, 0x118E7,
+        0x118E8, 0x118E9, 0x118EA, 0x118EB, 0x118EC, 0x118ED, 0x118EE, 0x118EF,
+        0x118F0, 0x118F1, 0x118F2, 0x118F3, 0x118F4, 0x118F5, 0x118F6, 0x118F7,
+        0x118F8, 0x118F9, 0x118FA, 0x118FB, 0x118FC, 0x118FD, 0x118FE, 0x118FF,
+    },
+    {
+        0x11900, 0x11901, 0x11902, 0x11903, 0x11904, 0x11905, 0x11906, 0x11907,
+        0x11908, 0x11909, 0x1190A, 0x1190B, 0x1190C, 0x1190D, 0x1190E, 0x1190F,
+        0x11910, 0x11911, 0x11912, 0x11913, 0x11914, 0x11915, 0x11916, 0x11917,
+        0x11918, 0x11919, 0x1191A, 0x1191B, 0x1191C, 0x1191D, 0x1191E, 0x1191F,
+        0x11920, 0x11921, 0x11922, 0x11923, 0x11924, 0x11925, 0x11926, 0x11927,
+        0x11928, 0x11929, 0x1192A, 0x1192B, 0x1192C, 0x1192D, 0x1192E, 0x1192F,
+        0x11930, 0x11931, 0x11932, 0x11933, 0x11934, 0x11935, 0x11936, 0x11937,
+        0x8000001C, 0x11939, 0x1193A, 0x00000, 0x00000, 0x1193D, 0x00000, 0x1193F,
+        0x11940, 0x11941, 0x11942, 0x00000, 0x11944, 0x11945, 0x11946, 0x11947,
+        0x11948, 0x11949, 0x1194A, 0x1194B, 0x1194C, 0x1194D, 0x1194E, 0x1194F,
+        0x11950, 0x11951, 0x11952, 0x11953, 0x11954, 0x11955, 0x11956, 0x11957,
+        0x11958, 0x11959, 0x1195A, 0x1195B, 0x1195C, 0x1195D, 0x1195E, 0x1195F,
+        0x11960, 0x11961, 0x11962, 0x11963, 0x11964, 0x11965, 0x11966, 0x11967,
+        0x11968, 0x11969, 0x1196A, 0x1196B, 0x1196C, 0x1196D, 0x1196E, 0x1196F,
+        0x11970, 0x11971, 0x11972, 0x11973, 0x11974, 0x11975, 0x11976, 0x11977,
+        0x11978, 0x11979, 0x1197A, 0x1197B, 0x1197C, 0x1197D, 0x1197E, 0x1197F,
+    },
+    {
+        0x11980, 0x11981, 0x11982, 0x11983, 0x11984, 0x11985, 0x11986, 0x11987,
+        0x11988, 0x11989, 0x1198A, 0x1198B, 0x1198C, 0x1198D, 0x1198E, 0x1198F,
+        0x11990, 0x11991, 0x11992, 0x11993, 0x11994, 0x11995, 0x11996, 0x11997,
+        0x11998, 0x11999, 0x1199A, 0x1199B, 0x1199C, 0x1199D, 0x1199E, 0x1199F,
+        0x119A0, 0x119A1, 0x119A2, 0x119A3, 0x119A4, 0x119A5, 0x119A6, 0x119A7,
+        0x119A8, 0x119A9, 0x119AA, 0x119AB, 0x119AC, 0x119AD, 0x119AE, 0x119AF,
+        0x119B0, 0x119B1, 0x119B2, 0x119B3, 0x119B4, 0x119B5, 0x119B6, 0x119B7,
+        0x119B8, 0x119B9, 0x119BA, 0x119BB, 0x119BC, 0x119BD, 0x119BE, 0x119BF,
+        0x119C0, 0x119C1, 0x119C2, 0x119C3, 0x119C4, 0x119C5, 0x119C6, 0x119C7,
+        0x119C8, 0x119C9, 0x119CA, 0x119CB, 0x119CC, 0x119CD, 0x119CE, 0x119CF,
+        0x119D0, 0x119D1, 0x119D2, 0x119D3, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x119D8, 0x119D9, 0x00000, 0x00000, 0x119DC, 0x119DD, 0x119DE, 0x119DF,
+        0x00000, 0x119E1, 0x119E2, 0x119E3, 0x119E4, 0x119E5, 0x119E6, 0x119E7,
+        0x119E8, 0x119E9, 0x119EA, 0x119EB, 0x119EC, 0x119ED, 0x119EE, 0x119EF,
+        0x119F0, 0x119F1, 0x119F2, 0x119F3, 0x119F4, 0x119F5, 0x119F6, 0x119F7,
+        0x119F8, 0x119F9, 0x119FA, 0x119FB, 0x119FC, 0x119FD, 0x119FE, 0x119FF,
+    },
+    {
+        0x11A00, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x11A0B, 0x11A0C, 0x11A0D, 0x11A0E, 0x11A0F,
+        0x11A10, 0x11A11, 0x11A12, 0x11A13, 0x11A14, 0x11A15, 0x11A16, 0x11A17,
+        0x11A18, 0x11A19, 0x11A1A, 0x11A1B, 0x11A1C, 0x11A1D, 0x11A1E, 0x11A1F,
+        0x11A20, 0x11A21, 0x11A22, 0x11A23, 0x11A24, 0x11A25, 0x11A26, 0x11A27,
+        0x11A28, 0x11A29, 0x11A2A, 0x11A2B, 0x11A2C, 0x11A2D, 0x11A2E, 0x11A2F,
+        0x11A30, 0x11A31, 0x11A32, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x11A39, 0x11A3A, 0x00000, 0x00000, 0x00000, 0x00000, 0x11A3F,
+        0x11A40, 0x11A41, 0x11A42, 0x11A43, 0x11A44, 0x11A45, 0x11A46, 0x00000,
+        0x11A48, 0x11A49, 0x11A4A, 0x11A4B, 0x11A4C, 0x11A4D, 0x11A4E, 0x11A4F,
+        0x11A50, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x11A57,
+        0x11A58, 0x00000, 0x00000, 0x00000, 0x11A5C, 0x11A5D, 0x11A5E, 0x11A5F,
+        0x11A60, 0x11A61, 0x11A62, 0x11A63, 0x11A64, 0x11A65, 0x11A66, 0x11A67,
+        0x11A68, 0x11A69, 0x11A6A, 0x11A6B, 0x11A6C, 0x11A6D, 0x11A6E, 0x11A6F,
+        0x11A70, 0x11A71, 0x11A72, 0x11A73, 0x11A74, 0x11A75, 0x11A76, 0x11A77,
+        0x11A78, 0x11A79, 0x11A7A, 0x11A7B, 0x11A7C, 0x11A7D, 0x11A7E, 0x11A7F,
+    },
+    {
+        0x11A80, 0x11A81, 0x11A82, 0x11A83, 0x11A84, 0x11A85, 0x11A86, 0x11A87,
+        0x11A88, 0x11A89, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x11A97,
+        0x00000, 0x00000, 0x11A9A, 0x11A9B, 0x11A9C, 0x11A9D, 0x11A9E, 0x11A9F,
+        0x11AA0, 0x11AA1, 0x11AA2, 0x11AA3, 0x11AA4, 0x11AA5, 0x11AA6, 0x11AA7,
+        0x11AA8, 0x11AA9, 0x11AAA, 0x11AAB, 0x11AAC, 0x11AAD, 0x11AAE, 0x11AAF,
+        0x11AB0, 0x11AB1, 0x11AB2, 0x11AB3, 0x11AB4, 0x11AB5, 0x11AB6, 0x11AB7,
+        0x11AB8, 0x11AB9, 0x11ABA, 0x11ABB, 0x11ABC, 0x11ABD, 0x11ABE, 0x11ABF,
+        0x11AC0, 0x11AC1, 0x11AC2, 0x11AC3, 0x11AC4, 0x11AC5, 0x11AC6, 0x11AC7,
+        0x11AC8, 0x11AC9, 0x11ACA, 0x11ACB, 0x11ACC, 0x11ACD, 0x11ACE, 0x11ACF,
+        0x11AD0, 0x11AD1, 0x11AD2, 0x11AD3, 0x11AD4, 0x11AD5, 0x11AD6, 0x11AD7,
+        0x11AD8, 0x11AD9, 0x11ADA, 0x11ADB, 0x11ADC, 0x11ADD, 0x11ADE, 0x11ADF,
+        0x11AE0, 0x11AE1, 0x11AE2, 0x11AE3, 0x11AE4, 0x11AE5, 0x11AE6, 0x11AE7,
+        0x11AE8, 0x11AE9, 0x11AEA, 0x11AEB, 0x11AEC, 0x11AED, 0x11AEE, 0x11AEF,
+        0x11AF0, 0x11AF1, 0x11AF2, 0x11AF3, 0x11AF4, 0x11AF5, 0x11AF6, 0x11AF7,
+        0x11AF8, 0x11AF9, 0x11AFA, 0x11AFB, 0x11AFC, 0x11AFD, 0x11AFE, 0x11AFF,
+    },
+    {
+        0x11C00, 0x11C01, 0x11C02, 0x11C03, 0x11C04, 0x11C05, 0x11C06, 0x11C07,
+        0x11C08, 0x11C09, 0x11C0A, 0x11C0B, 0x11C0C, 0x11C0D, 0x11C0E, 0x11C0F,
+        0x11C10, 0x11C11, 0x11C12, 0x11C13, 0x11C14, 0x11C15, 0x11C16, 0x11C17,
+        0x11C18, 0x11C19, 0x11C1A, 0x11C1B, 0x11C1C, 0x11C1D, 0x11C1E, 0x11C1F,
+        0x11C20, 0x11C21, 0x11C22, 0x11C23, 0x11C24, 0x11C25, 0x11C26, 0x11C27,
+        0x11C28, 0x11C29, 0x11C2A, 0x11C2B, 0x11C2C, 0x11C2D, 0x11C2E, 0x11C2F,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x11C37,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x11C3E, 0x00000,
+        0x11C40, 0x11C41, 0x11C42, 0x11C43, 0x11C44, 0x11C45, 0x11C46, 0x11C47,
+        0x11C48, 0x11C49, 0x11C4A, 0x11C4B, 0x11C4C, 0x11C4D, 0x11C4E, 0x11C4F,
+        0x11C50, 0x11C51, 0x11C52, 0x11C53, 0x11C54, 0x11C55, 0x11C56, 0x11C57,
+        0x11C58, 0x11C59, 0x11C5A, 0x11C5B, 0x11C5C, 0x11C5D, 0x11C5E, 0x11C5F,
+        0x11C60, 0x11C61, 0x11C62, 0x11C63, 0x11C64, 0x11C65, 0x11C66, 0x11C67,
+        0x11C68, 0x11C69, 0x11C6A, 0x11C6B, 0x11C6C, 0x11C6D, 0x11C6E, 0x11C6F,
+        0x11C70, 0x11C71, 0x11C72, 0x11C73, 0x11C74, 0x11C75, 0x11C76, 0x11C77,
+        0x11C78, 0x11C79, 0x11C7A, 0x11C7B, 0x11C7C, 0x11C7D, 0x11C7E, 0x11C7F,
+    },
+    {
+        0x11C80, 0x11C81, 0x11C82, 0x11C83, 0x11C84, 0x11C85, 0x11C86, 0x11C87,
+        0x11C88, 0x11C89, 0x11C8A, 0x11C8B, 0x11C8C, 0x11C8D, 0x11C8E, 0x11C8F,
+        0x11C90, 0x11C91, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x11CA8, 0x11CA9, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x11CB1, 0x00000, 0x00000, 0x11CB4, 0x00000, 0x00000, 0x11CB7,
+        0x11CB8, 0x11CB9, 0x11CBA, 0x11CBB, 0x11CBC, 0x11CBD, 0x11CBE, 0x11CBF,
+        0x11CC0, 0x11CC1, 0x11CC2, 0x11CC3, 0x11CC4, 0x11CC5, 0x11CC6, 0x11CC7,
+        0x11CC8, 0x11CC9, 0x11CCA, 0x11CCB, 0x11CCC, 0x11CCD, 0x11CCE, 0x11CCF,
+        0x11CD0, 0x11CD1, 0x11CD2, 0x11CD3, 0x11CD4, 0x11CD5, 0x11CD6, 0x11CD7,
+        0x11CD8, 0x11CD9, 0x11CDA, 0x11CDB, 0x11CDC, 0x11CDD, 0x11CDE, 0x11CDF,
+        0x11CE0, 0x11CE1, 0x11CE2, 0x11CE3, 0x11CE4, 0x11CE5, 0x11CE6, 0x11CE7,
+        0x11CE8, 0x11CE9, 0x11CEA, 0x11CEB, 0x11CEC, 0x11CED, 0x11CEE, 0x11CEF,
+        0x11CF0, 0x11CF1, 0x11CF2, 0x11CF3, 0x11CF4, 0x11CF5, 0x11CF6, 0x11CF7,
+        0x11CF8, 0x11CF9, 0x11CFA, 0x11CFB, 0x11CFC, 0x11CFD, 0x11CFE, 0x11CFF,
+    },
+    {
+        0x11D00, 0x11D01, 0x11D02, 0x11D03, 0x11D04, 0x11D05, 0x11D06, 0x11D07,
+        0x11D08, 0x11D09, 0x11D0A, 0x11D0B, 0x11D0C, 0x11D0D, 0x11D0E, 0x11D0F,
+        0x11D10, 0x11D11, 0x11D12, 0x11D13, 0x11D14, 0x11D15, 0x11D16, 0x11D17,
+        0x11D18, 0x11D19, 0x11D1A, 0x11D1B, 0x11D1C, 0x11D1D, 0x11D1E, 0x11D1F,
+        0x11D20, 0x11D21, 0x11D22, 0x11D23, 0x11D24, 0x11D25, 0x11D26, 0x11D27,
+        0x11D28, 0x11D29, 0x11D2A, 0x11D2B, 0x11D2C, 0x11D2D, 0x11D2E, 0x11D2F,
+        0x11D30, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x11D37,
+        0x11D38, 0x11D39, 0x00000, 0x11D3B, 0x00000, 0x00000, 0x11D3E, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x11D46, 0x00000,
+        0x11D48, 0x11D49, 0x11D4A, 0x11D4B, 0x11D4C, 0x11D4D, 0x11D4E, 0x11D4F,
+        0x11D50, 0x11D51, 0x11D52, 0x11D53, 0x11D54, 0x11D55, 0x11D56, 0x11D57,
+        0x11D58, 0x11D59, 0x11D5A, 0x11D5B, 0x11D5C, 0x11D5D, 0x11D5E, 0x11D5F,
+        0x11D60, 0x11D61, 0x11D62, 0x11D63, 0x11D64, 0x11D65, 0x11D66, 0x11D67,
+        0x11D68, 0x11D69, 0x11D6A, 0x11D6B, 0x11D6C, 0x11D6D, 0x11D6E, 0x11D6F,
+        0x11D70, 0x11D71, 0x11D72, 0x11D73, 0x11D74, 0x11D75, 0x11D76, 0x11D77,
+        0x11D78, 0x11D79, 0x11D7A, 0x11D7B, 0x11D7C, 0x11D7D, 0x11D7E, 0x11D7F,
+    },
+    {
+        0x11D80, 0x11D81, 0x11D82, 0x11D83, 0x11D84, 0x11D85, 0x11D86, 0x11D87,
+        0x11D88, 0x11D89, 0x11D8A, 0x11D8B, 0x11D8C, 0x11D8D, 0x11D8E, 0x11D8F,
+        0x00000, 0x00000, 0x11D92, 0x11D93, 0x11D94, 0x00000, 0x11D96, 0x00000,
+        0x11D98, 0x11D99, 0x11D9A, 0x11D9B, 0x11D9C, 0x11D9D, 0x11D9E, 0x11D9F,
+        0x11DA0, 0x11DA1, 0x11DA2, 0x11DA3, 0x11DA4, 0x11DA5, 0x11DA6, 0x11DA7,
+        0x11DA8, 0x11DA9, 0x11DAA, 0x11DAB, 0x11DAC, 0x11DAD, 0x11DAE, 0x11DAF,
+        0x11DB0, 0x11DB1, 0x11DB2, 0x11DB3, 0x11DB4, 0x11DB5, 0x11DB6, 0x11DB7,
+        0x11DB8, 0x11DB9, 0x11DBA, 0x11DBB, 0x11DBC, 0x11DBD, 0x11DBE, 0x11DBF,
+        0x11DC0, 0x11DC1, 0x11DC2, 0x11DC3, 0x11DC4, 0x11DC5, 0x11DC6, 0x11DC7,
+        0x11DC8, 0x11DC9, 0x11DCA, 0x11DCB, 0x11DCC, 0x11DCD, 0x11DCE, 0x11DCF,
+        0x11DD0, 0x11DD1, 0x11DD2, 0x11DD3, 0x11DD4, 0x11DD5, 0x11DD6, 0x11DD7,
+        0x11DD8, 0x11DD9, 0x11DDA, 0x11DDB, 0x11DDC, 0x11DDD, 0x11DDE, 0x11DDF,
+        0x11DE0, 0x11DE1, 0x11DE2, 0x11DE3, 0x11DE4, 0x11DE5, 0x11DE6, 0x11DE7,
+        0x11DE8, 0x11DE9, 0x11DEA, 0x11DEB, 0x11DEC, 0x11DED, 0x11DEE, 0x11DEF,
+        0x11DF0, 0x11DF1, 0x11DF2, 0x11DF3, 0x11DF4, 0x11DF5, 0x11DF6, 0x11DF7,
+        0x11DF8, 0x11DF9, 0x11DFA, 0x11DFB, 0x11DFC, 0x11DFD, 0x11DFE, 0x11DFF,
+    },
+    {
+        0x11E80, 0x11E81, 0x11E82, 0x11E83, 0x11E84, 0x11E85, 0x11E86, 0x11E87,
+        0x11E88, 0x11E89, 0x11E8A, 0x11E8B, 0x11E8C, 0x11E8D, 0x11E8E, 0x11E8F,
+        0x11E90, 0x11E91, 0x11E92, 0x11E93, 0x11E94, 0x11E95, 0x11E96, 0x11E97,
+        0x11E98, 0x11E99, 0x11E9A, 0x11E9B, 0x11E9C, 0x11E9D, 0x11E9E, 0x11E9F,
+        0x11EA0, 0x11EA1, 0x11EA2, 0x11EA3, 0x11EA4, 0x11EA5, 0x11EA6, 0x11EA7,
+        0x11EA8, 0x11EA9, 0x11EAA, 0x11EAB, 0x11EAC, 0x11EAD, 0x11EAE, 0x11EAF,
+        0x11EB0, 0x11EB1, 0x11EB2, 0x11EB3, 0x11EB4, 0x11EB5, 0x11EB6, 0x11EB7,
+        0x11EB8, 0x11EB9, 0x11EBA, 0x11EBB, 0x11EBC, 0x11EBD, 0x11EBE, 0x11EBF,
+        0x11EC0, 0x11EC1, 0x11EC2, 0x11EC3, 0x11EC4, 0x11EC5, 0x11EC6, 0x11EC7,
+        0x11EC8, 0x11EC9, 0x11ECA, 0x11ECB, 0x11ECC, 0x11ECD, 0x11ECE, 0x11ECF,
+        0x11ED0, 0x11ED1, 0x11ED2, 0x11ED3, 0x11ED4, 0x11ED5, 0x11ED6, 0x11ED7,
+        0x11ED8, 0x11ED9, 0x11EDA, 0x11EDB, 0x11EDC, 0x11EDD, 0x11EDE, 0x11EDF,
+        0x11EE0, 0x11EE1, 0x11EE2, 0x11EE3, 0x11EE4, 0x11EE5, 0x11EE6, 0x11EE7,
+        0x11EE8, 0x11EE9, 0x11EEA, 0x11EEB, 0x11EEC, 0x11EED, 0x11EEE, 0x11EEF,
+        0x11EF0, 0x11EF1, 0x11EF2, 0x00000, 0x00000, 0x11EF5, 0x11EF6, 0x11EF7,
+        0x11EF8, 0x11EF9, 0x11EFA, 0x11EFB, 0x11EFC, 0x11EFD, 0x11EFE, 0x11EFF,
+    },
+    {
+        0x16A80, 0x16A81, 0x16A82, 0x16A83, 0x16A84, 0x16A85, 0x16A86, 0x16A87,
+        0x16A88, 0x16A89, 0x16A8A, 0x16A8B, 0x16A8C, 0x16A8D, 0x16A8E, 0x16A8F,
+        0x16A90, 0x16A91, 0x16A92, 0x16A93, 0x16A94, 0x16A95, 0x16A96, 0x16A97,
+        0x16A98, 0x16A99, 0x16A9A, 0x16A9B, 0x16A9C, 0x16A9D, 0x16A9E, 0x16A9F,
+        0x16AA0, 0x16AA1, 0x16AA2, 0x16AA3, 0x16AA4, 0x16AA5, 0x16AA6, 0x16AA7,
+        0x16AA8, 0x16AA9, 0x16AAA, 0x16AAB, 0x16AAC, 0x16AAD, 0x16AAE, 0x16AAF,
+        0x16AB0, 0x16AB1, 0x16AB2, 0x16AB3, 0x16AB4, 0x16AB5, 0x16AB6, 0x16AB7,
+        0x16AB8, 0x16AB9, 0x16ABA, 0x16ABB, 0x16ABC, 0x16ABD, 0x16ABE, 0x16ABF,
+        0x16AC0, 0x16AC1, 0x16AC2, 0x16AC3, 0x16AC4, 0x16AC5, 0x16AC6, 0x16AC7,
+        0x16AC8, 0x16AC9, 0x16ACA, 0x16ACB, 0x16ACC, 0x16ACD, 0x16ACE, 0x16ACF,
+        0x16AD0, 0x16AD1, 0x16AD2, 0x16AD3, 0x16AD4, 0x16AD5, 0x16AD6, 0x16AD7,
+        0x16AD8, 0x16AD9, 0x16ADA, 0x16ADB, 0x16ADC, 0x16ADD, 0x16ADE, 0x16ADF,
+        0x16AE0, 0x16AE1, 0x16AE2, 0x16AE3, 0x16AE4, 0x16AE5, 0x16AE6, 0x16AE7,
+        0x16AE8, 0x16AE9, 0x16AEA, 0x16AEB, 0x16AEC, 0x16AED, 0x16AEE, 0x16AEF,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x16AF5, 0x16AF6, 0x16AF7,
+        0x16AF8, 0x16AF9, 0x16AFA, 0x16AFB, 0x16AFC, 0x16AFD, 0x16AFE, 0x16AFF,
+    },
+    {
+        0x16B00, 0x16B01, 0x16B02, 0x16B03, 0x16B04, 0x16B05, 0x16B06, 0x16B07,
+        0x16B08, 0x16B09, 0x16B0A, 0x16B0B, 0x16B0C, 0x16B0D, 0x16B0E, 0x16B0F,
+        0x16B10, 0x16B11, 0x16B12, 0x16B13, 0x16B14, 0x16B15, 0x16B16, 0x16B17,
+        0x16B18, 0x16B19, 0x16B1A, 0x16B1B, 0x16B1C, 0x16B1D, 0x16B1E, 0x16B1F,
+        0x16B20, 0x16B21, 0x16B22, 0x16B23, 0x16B24, 0x16B25, 0x16B26, 0x16B27,
+        0x16B28, 0x16B29, 0x16B2A, 0x16B2B, 0x16B2C, 0x16B2D, 0x16B2E, 0x16B2F,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x16B37,
+        0x16B38, 0x16B39, 0x16B3A, 0x16B3B, 0x16B3C, 0x16B3D, 0x16B3E, 0x16B3F,
+        0x16B40, 0x16B41, 0x16B42, 0x16B43, 0x16B44, 0x16B45, 0x16B46, 0x16B47,
+        0x16B48, 0x16B49, 0x16B4A, 0x16B4B, 0x16B4C, 0x16B4D, 0x16B4E, 0x16B4F,
+        0x16B50, 0x16B51, 0x16B52, 0x16B53, 0x16B54, 0x16B55, 0x16B56, 0x16B57,
+        0x16B58, 0x16B59, 0x16B5A, 0x16B5B, 0x16B5C, 0x16B5D, 0x16B5E, 0x16B5F,
+        0x16B60, 0x16B61, 0x16B62, 0x16B63, 0x16B64, 0x16B65, 0x16B66, 0x16B67,
+        0x16B68, 0x16B69, 0x16B6A, 0x16B6B, 0x16B6C, 0x16B6D, 0x16B6E, 0x16B6F,
+        0x16B70, 0x16B71, 0x16B72, 0x16B73, 0x16B74, 0x16B75, 0x16B76, 0x16B77,
+        0x16B78, 0x16B79, 0x16B7A, 0x16B7B, 0x16B7C, 0x16B7D, 0x16B7E, 0x16B7F,
+    },
+    {
+        0x16E00, 0x16E01, 0x16E02, 0x16E03, 0x16E04, 0x16E05, 0x16E06, 0x16E07,
+        0x16E08, 0x16E09, 0x16E0A, 0x16E0B, 0x16E0C, 0x16E0D, 0x16E0E, 0x16E0F,
+        0x16E10, 0x16E11, 0x16E12, 0x16E13, 0x16E14, 0x16E15, 0x16E16, 0x16E17,
+        0x16E18, 0x16E19, 0x16E1A, 0x16E1B, 0x16E1C, 0x16E1D, 0x16E1E, 0x16E1F,
+        0x16E20, 0x16E21, 0x16E22, 0x16E23, 0x16E24, 0x16E25, 0x16E26, 0x16E27,
+        0x16E28, 0x16E29, 0x16E2A, 0x16E2B, 0x16E2C, 0x16E2D, 0x16E2E, 0x16E2F,
+        0x16E30, 0x16E31, 0x16E32, 0x16E33, 0x16E34, 0x16E35, 0x16E36, 0x16E37,
+        0x16E38, 0x16E39, 0x16E3A, 0x16E3B, 0x16E3C, 0x16E3D, 0x16E3E, 0x16E3F,
+        0x16E60, 0x16E61, 0x16E62, 0x16E63, 0x16E64, 0x16E65, 0x16E66, 0x16E67,
+        0x16E68, 0x16E69, 0x16E6A, 0x16E6B, 0x16E6C, 0x16E6D, 0x16E6E, 0x16E6F,
+        0x16E70, 0x16E71, 0x16E72, 0x16E73, 0x16E74, 0x16E75, 0x16E76, 0x16E77,
+        0x16E78, 0x16E79, 0x16E7A, 0x16E7B, 0x16E7C, 0x16E7D, 0x16E7E, 0x16E7F,
+        0x16E60, 0x16E61, 0x16E62, 0x16E63, 0x16E64, 0x16E65, 0x16E66, 0x16E67,
+        0x16E68, 0x16E69, 0x16E6A, 0x16E6B, 0x16E6C, 0x16E6D, 0x16E6E, 0x16E6F,
+        0x16E70, 0x16E71, 0x16E72, 0x16E73, 0x16E74, 0x16E75, 0x16E76, 0x16E77,
+        0x16E78, 0x16E79, 0x16E7A, 0x16E7B, 0x16E7C, 0x16E7D, 0x16E7E, 0x16E7F,
+    },
+    {
+        0x16F00, 0x16F01, 0x16F02, 0x16F03, 0x16F04, 0x16F05, 0x16F06, 0x16F07,
+        0x16F08, 0x16F09, 0x16F0A, 0x16F0B, 0x16F0C, 0x16F0D, 0x16F0E, 0x16F0F,
+        0x16F10, 0x16F11, 0x16F12, 0x16F13, 0x16F14, 0x16F15, 0x16F16, 0x16F17,
+        0x16F18, 0x16F19, 0x16F1A, 0x16F1B, 0x16F1C, 0x16F1D, 0x16F1E, 0x16F1F,
+        0x16F20, 0x16F21, 0x16F22, 0x16F23, 0x16F24, 0x16F25, 0x16F26, 0x16F27,
+        0x16F28, 0x16F29, 0x16F2A, 0x16F2B, 0x16F2C, 0x16F2D, 0x16F2E, 0x16F2F,
+        0x16F30, 0x16F31, 0x16F32, 0x16F33, 0x16F34, 0x16F35, 0x16F36, 0x16F37,
+        0x16F38, 0x16F39, 0x16F3A, 0x16F3B, 0x16F3C, 0x16F3D, 0x16F3E, 0x16F3F,
+        0x16F40, 0x16F41, 0x16F42, 0x16F43, 0x16F44, 0x16F45, 0x16F46, 0x16F47,
+        0x16F48, 0x16F49, 0x16F4A, 0x16F4B, 0x16F4C, 0x16F4D, 0x16F4E, 0x00000,
+        0x16F50, 0x16F51, 0x16F52, 0x16F53, 0x16F54, 0x16F55, 0x16F56, 0x16F57,
+        0x16F58, 0x16F59, 0x16F5A, 0x16F5B, 0x16F5C, 0x16F5D, 0x16F5E, 0x16F5F,
+        0x16F60, 0x16F61, 0x16F62, 0x16F63, 0x16F64, 0x16F65, 0x16F66, 0x16F67,
+        0x16F68, 0x16F69, 0x16F6A, 0x16F6B, 0x16F6C, 0x16F6D, 0x16F6E, 0x16F6F,
+        0x16F70, 0x16F71, 0x16F72, 0x16F73, 0x16F74, 0x16F75, 0x16F76, 0x16F77,
+        0x16F78, 0x16F79, 0x16F7A, 0x16F7B, 0x16F7C, 0x16F7D, 0x16F7E, 0x16F7F,
+    },
+    {
+        0x16F80, 0x16F81, 0x16F82, 0x16F83, 0x16F84, 0x16F85, 0x16F86, 0x16F87,
+        0x16F88, 0x16F89, 0x16F8A, 0x16F8B, 0x16F8C, 0x16F8D, 0x16F8E, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x16F93, 0x16F94, 0x16F95, 0x16F96, 0x16F97,
+        0x16F98, 0x16F99, 0x16F9A, 0x16F9B, 0x16F9C, 0x16F9D, 0x16F9E, 0x16F9F,
+        0x16FA0, 0x16FA1, 0x16FA2, 0x16FA3, 0x16FA4, 0x16FA5, 0x16FA6, 0x16FA7,
+        0x16FA8, 0x16FA9, 0x16FAA, 0x16FAB, 0x16FAC, 0x16FAD, 0x16FAE, 0x16FAF,
+        0x16FB0, 0x16FB1, 0x16FB2, 0x16FB3, 0x16FB4, 0x16FB5, 0x16FB6, 0x16FB7,
+        0x16FB8, 0x16FB9, 0x16FBA, 0x16FBB, 0x16FBC, 0x16FBD, 0x16FBE, 0x16FBF,
+        0x16FC0, 0x16FC1, 0x16FC2, 0x16FC3, 0x16FC4, 0x16FC5, 0x16FC6, 0x16FC7,
+        0x16FC8, 0x16FC9, 0x16FCA, 0x16FCB, 0x16FCC, 0x16FCD, 0x16FCE, 0x16FCF,
+        0x16FD0, 0x16FD1, 0x16FD2, 0x16FD3, 0x16FD4, 0x16FD5, 0x16FD6, 0x16FD7,
+        0x16FD8, 0x16FD9, 0x16FDA, 0x16FDB, 0x16FDC, 0x16FDD, 0x16FDE, 0x16FDF,
+        0x16FE0, 0x16FE1, 0x16FE2, 0x16FE3, 0x00000, 0x16FE5, 0x16FE6, 0x16FE7,
+        0x16FE8, 0x16FE9, 0x16FEA, 0x16FEB, 0x16FEC, 0x16FED, 0x16FEE, 0x16FEF,
+        0x16FF0, 0x16FF1, 0x16FF2, 0x16FF3, 0x16FF4, 0x16FF5, 0x16FF6, 0x16FF7,
+        0x16FF8, 0x16FF9, 0x16FFA, 0x16FFB, 0x16FFC, 0x16FFD, 0x16FFE, 0x16FFF,
+    },
+    {
+        0x1BC80, 0x1BC81, 0x1BC82, 0x1BC83, 0x1BC84, 0x1BC85, 0x1BC86, 0x1BC87,
+        0x1BC88, 0x1BC89, 0x1BC8A, 0x1BC8B, 0x1BC8C, 0x1BC8D, 0x1BC8E, 0x1BC8F,
+        0x1BC90, 0x1BC91, 0x1BC92, 0x1BC93, 0x1BC94, 0x1BC95, 0x1BC96, 0x1BC97,
+        0x1BC98, 0x1BC99, 0x1BC9A, 0x1BC9B, 0x1BC9C, 0x00000, 0x00000, 0x1BC9F,
+        0x1BCA0, 0x1BCA1, 0x1BCA2, 0x1BCA3, 0x1BCA4, 0x1BCA5, 0x1BCA6, 0x1BCA7,
+        0x1BCA8, 0x1BCA9, 0x1BCAA, 0x1BCAB, 0x1BCAC, 0x1BCAD, 0x1BCAE, 0x1BCAF,
+        0x1BCB0, 0x1BCB1, 0x1BCB2, 0x1BCB3, 0x1BCB4, 0x1BCB5, 0x1BCB6, 0x1BCB7,
+        0x1BCB8, 0x1BCB9, 0x1BCBA, 0x1BCBB, 0x1BCBC, 0x1BCBD, 0x1BCBE, 0x1BCBF,
+        0x1BCC0, 0x1BCC1, 0x1BCC2, 0x1BCC3, 0x1BCC4, 0x1BCC5, 0x1BCC6, 0x1BCC7,
+        0x1BCC8, 0x1BCC9, 0x1BCCA, 0x1BCCB, 0x1BCCC, 0x1BCCD, 0x1BCCE, 0x1BCCF,
+        0x1BCD0, 0x1BCD1, 0x1BCD2, 0x1BCD3, 0x1BCD4, 0x1BCD5, 0x1BCD6, 0x1BCD7,
+        0x1BCD8, 0x1BCD9, 0x1BCDA, 0x1BCDB, 0x1BCDC, 0x1BCDD, 0x1BCDE, 0x1BCDF,
+        0x1BCE0, 0x1BCE1, 0x1BCE2, 0x1BCE3, 0x1BCE4, 0x1BCE5, 0x1BCE6, 0x1BCE7,
+        0x1BCE8, 0x1BCE9, 0x1BCEA, 0x1BCEB, 0x1BCEC, 0x1BCED, 0x1BCEE, 0x1BCEF,
+        0x1BCF0, 0x1BCF1, 0x1BCF2, 0x1BCF3, 0x1BCF4, 0x1BCF5, 0x1BCF6, 0x1BCF7,
+        0x1BCF8, 0x1BCF9, 0x1BCFA, 0x1BCFB, 0x1BCFC, 0x1BCFD, 0x1BCFE, 0x1BCFF,
+    },
+    {
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x1CF2E, 0x1CF2F,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x1CF47,
+        0x1CF48, 0x1CF49, 0x1CF4A, 0x1CF4B, 0x1CF4C, 0x1CF4D, 0x1CF4E, 0x1CF4F,
+        0x1CF50, 0x1CF51, 0x1CF52, 0x1CF53, 0x1CF54, 0x1CF55, 0x1CF56, 0x1CF57,
+        0x1CF58, 0x1CF59, 0x1CF5A, 0x1CF5B, 0x1CF5C, 0x1CF5D, 0x1CF5E, 0x1CF5F,
+        0x1CF60, 0x1CF61, 0x1CF62, 0x1CF63, 0x1CF64, 0x1CF65, 0x1CF66, 0x1CF67,
+        0x1CF68, 0x1CF69, 0x1CF6A, 0x1CF6B, 0x1CF6C, 0x1CF6D, 0x1CF6E, 0x1CF6F,
+        0x1CF70, 0x1CF71, 0x1CF72, 0x1CF73, 0x1CF74, 0x1CF75, 0x1CF76, 0x1CF77,
+        0x1CF78, 0x1CF79, 0x1CF7A, 0x1CF7B, 0x1CF7C, 0x1CF7D, 0x1CF7E, 0x1CF7F,
+    },
+    {
+        0x1D100, 0x1D101, 0x1D102, 0x1D103, 0x1D104, 0x1D105, 0x1D106, 0x1D107,
+        0x1D108, 0x1D109, 0x1D10A, 0x1D10B, 0x1D10C, 0x1D10D, 0x1D10E, 0x1D10F,
+        0x1D110, 0x1D111, 0x1D112, 0x1D113, 0x1D114, 0x1D115, 0x1D116, 0x1D117,
+        0x1D118, 0x1D119, 0x1D11A, 0x1D11B, 0x1D11C, 0x1D11D, 0x1D11E, 0x1D11F,
+        0x1D120, 0x1D121, 0x1D122, 0x1D123, 0x1D124, 0x1D125, 0x1D126, 0x1D127,
+        0x1D128, 0x1D129, 0x1D12A, 0x1D12B, 0x1D12C, 0x1D12D, 0x1D12E, 0x1D12F,
+        0x1D130, 0x1D131, 0x1D132, 0x1D133, 0x1D134, 0x1D135, 0x1D136, 0x1D137,
+        0x1D138, 0x1D139, 0x1D13A, 0x1D13B, 0x1D13C, 0x1D13D, 0x1D13E, 0x1D13F,
+        0x1D140, 0x1D141, 0x1D142, 0x1D143, 0x1D144, 0x1D145, 0x1D146, 0x1D147,
+        0x1D148, 0x1D149, 0x1D14A, 0x1D14B, 0x1D14C, 0x1D14D, 0x1D14E, 0x1D14F,
+        0x1D150, 0x1D151, 0x1D152, 0x1D153, 0x1D154, 0x1D155, 0x1D156, 0x1D157,
+        0x1D158, 0x1D159, 0x1D15A, 0x1D15B, 0x1D15C, 0x1D15D, 0x8000001D, 0x8000001E,
+        0x8000001F, 0x80000020, 0x80000021, 0x80000022, 0x80000023, 0x1D165, 0x1D166, 0x00000,
+        0x00000, 0x00000, 0x1D16A, 0x1D16B, 0x1D16C, 0x1D16D, 0x1D16E, 0x1D16F,
+        0x1D170, 0x1D171, 0x1D172, 0x1D173, 0x1D174, 0x1D175, 0x1D176, 0x1D177,
+        0x1D178, 0x1D179, 0x1D17A, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+    },
+    {
+        0x00000, 0x00000, 0x00000, 0x1D183, 0x1D184, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x1D18C, 0x1D18D, 0x1D18E, 0x1D18F,
+        0x1D190, 0x1D191, 0x1D192, 0x1D193, 0x1D194, 0x1D195, 0x1D196, 0x1D197,
+        0x1D198, 0x1D199, 0x1D19A, 0x1D19B, 0x1D19C, 0x1D19D, 0x1D19E, 0x1D19F,
+        0x1D1A0, 0x1D1A1, 0x1D1A2, 0x1D1A3, 0x1D1A4, 0x1D1A5, 0x1D1A6, 0x1D1A7,
+        0x1D1A8, 0x1D1A9, 0x00000, 0x00000, 0x00000, 0x00000, 0x1D1AE, 0x1D1AF,
+        0x1D1B0, 0x1D1B1, 0x1D1B2, 0x1D1B3, 0x1D1B4, 0x1D1B5, 0x1D1B6, 0x1D1B7,
+        0x1D1B8, 0x1D1B9, 0x1D1BA, 0x80000024, 0x80000025, 0x80000026, 0x80000027, 0x80000028,
+        0x80000029, 0x1D1C1, 0x1D1C2, 0x1D1C3, 0x1D1C4, 0x1D1C5, 0x1D1C6, 0x1D1C7,
+        0x1D1C8, 0x1D1C9, 0x1D1CA, 0x1D1CB, 0x1D1CC, 0x1D1CD, 0x1D1CE, 0x1D1CF,
+        0x1D1D0, 0x1D1D1, 0x1D1D2, 0x1D1D3, 0x1D1D4, 0x1D1D5, 0x1D1D6, 0x1D1D7,
+        0x1D1D8, 0x1D1D9, 0x1D1DA, 0x1D1DB, 0x1D1DC, 0x1D1DD, 0x1D1DE, 0x1D1DF,
+        0x1D1E0, 0x1D1E1, 0x1D1E2, 0x1D1E3, 0x1D1E4, 0x1D1E5, 0x1D1E6, 0x1D1E7,
+        0x1D1E8, 0x1D1E9, 0x1D1EA, 0x1D1EB, 0x1D1EC, 0x1D1ED, 0x1D1EE, 0x1D1EF,
+        0x1D1F0, 0x1D1F1, 0x1D1F2, 0x1D1F3, 0x1D1F4, 0x1D1F5, 0x1D1F6, 0x1D1F7,
+        0x1D1F8, 0x1D1F9, 0x1D1FA, 0x1D1FB, 0x1D1FC, 0x1D1FD, 0x1D1FE, 0x1D1FF,
+    },
+    {
+        0x1D200, 0x1D201, 0x1D202, 0x1D203, 0x1D204, 0x1D205, 0x1D206, 0x1D207,
+        0x1D208, 0x1D209, 0x1D20A, 0x1D20B, 0x1D20C, 0x1D20D, 0x1D20E, 0x1D20F,
+        0x1D210, 0x1D211, 0x1D212, 0x1D213, 0x1D214, 0x1D215, 0x1D216, 0x1D217,
+        0x1D218, 0x1D219, 0x1D21A, 0x1D21B, 0x1D21C, 0x1D21D, 0x1D21E, 0x1D21F,
+        0x1D220, 0x1D221, 0x1D222, 0x1D223, 0x1D224, 0x1D225, 0x1D226, 0x1D227,
+        0x1D228, 0x1D229, 0x1D22A, 0x1D22B, 0x1D22C, 0x1D22D, 0x1D22E, 0x1D22F,
+        0x1D230, 0x1D231, 0x1D232, 0x1D233, 0x1D234, 0x1D235, 0x1D236, 0x1D237,
+        0x1D238, 0x1D239, 0x1D23A, 0x1D23B, 0x1D23C, 0x1D23D, 0x1D23E, 0x1D23F,
+        0x1D240, 0x1D241, 0x00000, 0x00000, 0x00000, 0x1D245, 0x1D246, 0x1D247,
+        0x1D248, 0x1D249, 0x1D24A, 0x1D24B, 0x1D24C, 0x1D24D, 0x1D24E, 0x1D24F,
+        0x1D250, 0x1D251, 0x1D252, 0x1D253, 0x1D254, 0x1D255, 0x1D256, 0x1D257,
+        0x1D258, 0x1D259, 0x1D25A, 0x1D25B, 0x1D25C, 0x1D25D, 0x1D25E, 0x1D25F,
+        0x1D260, 0x1D261, 0x1D262, 0x1D263, 0x1D264, 0x1D265, 0x1D266, 0x1D267,
+        0x1D268, 0x1D269, 0x1D26A, 0x1D26B, 0x1D26C, 0x1D26D, 0x1D26E, 0x1D26F,
+        0x1D270, 0x1D271, 0x1D272, 0x1D273, 0x1D274, 0x1D275, 0x1D276, 0x1D277,
+        0x1D278, 0x1D279, 0x1D27A, 0x1D27B, 0x1D27C, 0x1D27D, 0x1D27E, 0x1D27F,
+    },
+    {
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x1DA37,
+        0x1DA38, 0x1DA39, 0x1DA3A, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x1DA6D, 0x1DA6E, 0x1DA6F,
+        0x1DA70, 0x1DA71, 0x1DA72, 0x1DA73, 0x1DA74, 0x00000, 0x1DA76, 0x1DA77,
+        0x1DA78, 0x1DA79, 0x1DA7A, 0x1DA7B, 0x1DA7C, 0x1DA7D, 0x1DA7E, 0x1DA7F,
+    },
+    {
+        0x1DA80, 0x1DA81, 0x1DA82, 0x1DA83, 0x00000, 0x1DA85, 0x1DA86, 0x1DA87,
+        0x1DA88, 0x1DA89, 0x1DA8A, 0x1DA8B, 0x1DA8C, 0x1DA8D, 0x1DA8E, 0x1DA8F,
+        0x1DA90, 0x1DA91, 0x1DA92, 0x1DA93, 0x1DA94, 0x1DA95, 0x1DA96, 0x1DA97,
+        0x1DA98, 0x1DA99, 0x1DA9A, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x1DAA0, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x1DAB0, 0x1DAB1, 0x1DAB2, 0x1DAB3, 0x1DAB4, 0x1DAB5, 0x1DAB6, 0x1DAB7,
+        0x1DAB8, 0x1DAB9, 0x1DABA, 0x1DABB, 0x1DABC, 0x1DABD, 0x1DABE, 0x1DABF,
+        0x1DAC0, 0x1DAC1, 0x1DAC2, 0x1DAC3, 0x1DAC4, 0x1DAC5, 0x1DAC6, 0x1DAC7,
+        0x1DAC8, 0x1DAC9, 0x1DACA, 0x1DACB, 0x1DACC, 0x1DACD, 0x1DACE, 0x1DACF,
+        0x1DAD0, 0x1DAD1, 0x1DAD2, 0x1DAD3, 0x1DAD4, 0x1DAD5, 0x1DAD6, 0x1DAD7,
+        0x1DAD8, 0x1DAD9, 0x1DADA, 0x1DADB, 0x1DADC, 0x1DADD, 0x1DADE, 0x1DADF,
+        0x1DAE0, 0x1DAE1, 0x1DAE2, 0x1DAE3, 0x1DAE4, 0x1DAE5, 0x1DAE6, 0x1DAE7,
+        0x1DAE8, 0x1DAE9, 0x1DAEA, 0x1DAEB, 0x1DAEC, 0x1DAED, 0x1DAEE, 0x1DAEF,
+        0x1DAF0, 0x1DAF1, 0x1DAF2, 0x1DAF3, 0x1DAF4, 0x1DAF5, 0x1DAF6, 0x1DAF7,
+        0x1DAF8, 0x1DAF9, 0x1DAFA, 0x1DAFB, 0x1DAFC, 0x1DAFD, 0x1DAFE, 0x1DAFF,
+    },
+    {
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x1E007,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x1E019, 0x1E01A, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x1E022, 0x00000, 0x00000, 0x1E025, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x1E02B, 0x1E02C, 0x1E02D, 0x1E02E, 0x1E02F,
+        0x1E030, 0x1E031, 0x1E032, 0x1E033, 0x1E034, 0x1E035, 0x1E036, 0x1E037,
+        0x1E038, 0x1E039, 0x1E03A, 0x1E03B, 0x1E03C, 0x1E03D, 0x1E03E, 0x1E03F,
+        0x1E040, 0x1E041, 0x1E042, 0x1E043, 0x1E044, 0x1E045, 0x1E046, 0x1E047,
+        0x1E048, 0x1E049, 0x1E04A, 0x1E04B, 0x1E04C, 0x1E04D, 0x1E04E, 0x1E04F,
+        0x1E050, 0x1E051, 0x1E052, 0x1E053, 0x1E054, 0x1E055, 0x1E056, 0x1E057,
+        0x1E058, 0x1E059, 0x1E05A, 0x1E05B, 0x1E05C, 0x1E05D, 0x1E05E, 0x1E05F,
+        0x1E060, 0x1E061, 0x1E062, 0x1E063, 0x1E064, 0x1E065, 0x1E066, 0x1E067,
+        0x1E068, 0x1E069, 0x1E06A, 0x1E06B, 0x1E06C, 0x1E06D, 0x1E06E, 0x1E06F,
+        0x1E070, 0x1E071, 0x1E072, 0x1E073, 0x1E074, 0x1E075, 0x1E076, 0x1E077,
+        0x1E078, 0x1E079, 0x1E07A, 0x1E07B, 0x1E07C, 0x1E07D, 0x1E07E, 0x1E07F,
+    },
+    {
+        0x1E100, 0x1E101, 0x1E102, 0x1E103, 0x1E104, 0x1E105, 0x1E106, 0x1E107,
+        0x1E108, 0x1E109, 0x1E10A, 0x1E10B, 0x1E10C, 0x1E10D, 0x1E10E, 0x1E10F,
+        0x1E110, 0x1E111, 0x1E112, 0x1E113, 0x1E114, 0x1E115, 0x1E116, 0x1E117,
+        0x1E118, 0x1E119, 0x1E11A, 0x1E11B, 0x1E11C, 0x1E11D, 0x1E11E, 0x1E11F,
+        0x1E120, 0x1E121, 0x1E122, 0x1E123, 0x1E124, 0x1E125, 0x1E126, 0x1E127,
+        0x1E128, 0x1E129, 0x1E12A, 0x1E12B, 0x1E12C, 0x1E12D, 0x1E12E, 0x1E12F,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x1E137,
+        0x1E138, 0x1E139, 0x1E13A, 0x1E13B, 0x1E13C, 0x1E13D, 0x1E13E, 0x1E13F,
+        0x1E140, 0x1E141, 0x1E142, 0x1E143, 0x1E144, 0x1E145, 0x1E146, 0x1E147,
+        0x1E148, 0x1E149, 0x1E14A, 0x1E14B, 0x1E14C, 0x1E14D, 0x1E14E, 0x1E14F,
+        0x1E150, 0x1E151, 0x1E152, 0x1E153, 0x1E154, 0x1E155, 0x1E156, 0x1E157,
+        0x1E158, 0x1E159, 0x1E15A, 0x1E15B, 0x1E15C, 0x1E15D, 0x1E15E, 0x1E15F,
+        0x1E160, 0x1E161, 0x1E162, 0x1E163, 0x1E164, 0x1E165, 0x1E166, 0x1E167,
+        0x1E168, 0x1E169, 0x1E16A, 0x1E16B, 0x1E16C, 0x1E16D, 0x1E16E, 0x1E16F,
+        0x1E170, 0x1E171, 0x1E172, 0x1E173, 0x1E174, 0x1E175, 0x1E176, 0x1E177,
+        0x1E178, 0x1E179, 0x1E17A, 0x1E17B, 0x1E17C, 0x1E17D, 0x1E17E, 0x1E17F,
+    },
+    {
+        0x1E280, 0x1E281, 0x1E282, 0x1E283, 0x1E284, 0x1E285, 0x1E286, 0x1E287,
+        0x1E288, 0x1E289, 0x1E28A, 0x1E28B, 0x1E28C, 0x1E28D, 0x1E28E, 0x1E28F,
+        0x1E290, 0x1E291, 0x1E292, 0x1E293, 0x1E294, 0x1E295, 0x1E296, 0x1E297,
+        0x1E298, 0x1E299, 0x1E29A, 0x1E29B, 0x1E29C, 0x1E29D, 0x1E29E, 0x1E29F,
+        0x1E2A0, 0x1E2A1, 0x1E2A2, 0x1E2A3, 0x1E2A4, 0x1E2A5, 0x1E2A6, 0x1E2A7,
+        0x1E2A8, 0x1E2A9, 0x1E2AA, 0x1E2AB, 0x1E2AC, 0x1E2AD, 0x00000, 0x1E2AF,
+        0x1E2B0, 0x1E2B1, 0x1E2B2, 0x1E2B3, 0x1E2B4, 0x1E2B5, 0x1E2B6, 0x1E2B7,
+        0x1E2B8, 0x1E2B9, 0x1E2BA, 0x1E2BB, 0x1E2BC, 0x1E2BD, 0x1E2BE, 0x1E2BF,
+        0x1E2C0, 0x1E2C1, 0x1E2C2, 0x1E2C3, 0x1E2C4, 0x1E2C5, 0x1E2C6, 0x1E2C7,
+        0x1E2C8, 0x1E2C9, 0x1E2CA, 0x1E2CB, 0x1E2CC, 0x1E2CD, 0x1E2CE, 0x1E2CF,
+        0x1E2D0, 0x1E2D1, 0x1E2D2, 0x1E2D3, 0x1E2D4, 0x1E2D5, 0x1E2D6, 0x1E2D7,
+        0x1E2D8, 0x1E2D9, 0x1E2DA, 0x1E2DB, 0x1E2DC, 0x1E2DD, 0x1E2DE, 0x1E2DF,
+        0x1E2E0, 0x1E2E1, 0x1E2E2, 0x1E2E3, 0x1E2E4, 0x1E2E5, 0x1E2E6, 0x1E2E7,
+        0x1E2E8, 0x1E2E9, 0x1E2EA, 0x1E2EB, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x1E2F0, 0x1E2F1, 0x1E2F2, 0x1E2F3, 0x1E2F4, 0x1E2F5, 0x1E2F6, 0x1E2F7,
+        0x1E2F8, 0x1E2F9, 0x1E2FA, 0x1E2FB, 0x1E2FC, 0x1E2FD, 0x1E2FE, 0x1E2FF,
+    },
+    {
+        0x1E880, 0x1E881, 0x1E882, 0x1E883, 0x1E884, 0x1E885, 0x1E886, 0x1E887,
+        0x1E888, 0x1E889, 0x1E88A, 0x1E88B, 0x1E88C, 0x1E88D, 0x1E88E, 0x1E88F,
+        0x1E890, 0x1E891, 0x1E892, 0x1E893, 0x1E894, 0x1E895, 0x1E896, 0x1E897,
+        0x1E898, 0x1E899, 0x1E89A, 0x1E89B, 0x1E89C, 0x1E89D, 0x1E89E, 0x1E89F,
+        0x1E8A0, 0x1E8A1, 0x1E8A2, 0x1E8A3, 0x1E8A4, 0x1E8A5, 0x1E8A6, 0x1E8A7,
+        0x1E8A8, 0x1E8A9, 0x1E8AA, 0x1E8AB, 0x1E8AC, 0x1E8AD, 0x1E8AE, 0x1E8AF,
+        0x1E8B0, 0x1E8B1, 0x1E8B2, 0x1E8B3, 0x1E8B4, 0x1E8B5, 0x1E8B6, 0x1E8B7,
+        0x1E8B8, 0x1E8B9, 0x1E8BA, 0x1E8BB, 0x1E8BC, 0x1E8BD, 0x1E8BE, 0x1E8BF,
+        0x1E8C0, 0x1E8C1, 0x1E8C2, 0x1E8C3, 0x1E8C4, 0x1E8C5, 0x1E8C6, 0x1E8C7,
+        0x1E8C8, 0x1E8C9, 0x1E8CA, 0x1E8CB, 0x1E8CC, 0x1E8CD, 0x1E8CE, 0x1E8CF,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x1E8D7,
+        0x1E8D8, 0x1E8D9, 0x1E8DA, 0x1E8DB, 0x1E8DC, 0x1E8DD, 0x1E8DE, 0x1E8DF,
+        0x1E8E0, 0x1E8E1, 0x1E8E2, 0x1E8E3, 0x1E8E4, 0x1E8E5, 0x1E8E6, 0x1E8E7,
+        0x1E8E8, 0x1E8E9, 0x1E8EA, 0x1E8EB, 0x1E8EC, 0x1E8ED, 0x1E8EE, 0x1E8EF,
+        0x1E8F0, 0x1E8F1, 0x1E8F2, 0x1E8F3, 0x1E8F4, 0x1E8F5, 0x1E8F6, 0x1E8F7,
+        0x1E8F8, 0x1E8F9, 0x1E8FA, 0x1E8FB, 0x1E8FC, 0x1E8FD, 0x1E8FE, 0x1E8FF,
+    },
+    {
+        0x1E922, 0x1E923, 0x1E924, 0x1E925, 0x1E926, 0x1E927, 0x1E928, 0x1E929,
+        0x1E92A, 0x1E92B, 0x1E92C, 0x1E92D, 0x1E92E, 0x1E92F, 0x1E930, 0x1E931,
+        0x1E932, 0x1E933, 0x1E934, 0x1E935, 0x1E936, 0x1E937, 0x1E938, 0x1E939,
+        0x1E93A, 0x1E93B, 0x1E93C, 0x1E93D, 0x1E93E, 0x1E93F, 0x1E940, 0x1E941,
+        0x1E942, 0x1E943, 0x1E922, 0x1E923, 0x1E924, 0x1E925, 0x1E926, 0x1E927,
+        0x1E928, 0x1E929, 0x1E92A, 0x1E92B, 0x1E92C, 0x1E92D, 0x1E92E, 0x1E92F,
+        0x1E930, 0x1E931, 0x1E932, 0x1E933, 0x1E934, 0x1E935, 0x1E936, 0x1E937,
+        0x1E938, 0x1E939, 0x1E93A, 0x1E93B, 0x1E93C, 0x1E93D, 0x1E93E, 0x1E93F,
+        0x1E940, 0x1E941, 0x1E942, 0x1E943, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x1E94B, 0x1E94C, 0x1E94D, 0x1E94E, 0x1E94F,
+        0x1E950, 0x1E951, 0x1E952, 0x1E953, 0x1E954, 0x1E955, 0x1E956, 0x1E957,
+        0x1E958, 0x1E959, 0x1E95A, 0x1E95B, 0x1E95C, 0x1E95D, 0x1E95E, 0x1E95F,
+        0x1E960, 0x1E961, 0x1E962, 0x1E963, 0x1E964, 0x1E965, 0x1E966, 0x1E967,
+        0x1E968, 0x1E969, 0x1E96A, 0x1E96B, 0x1E96C, 0x1E96D, 0x1E96E, 0x1E96F,
+        0x1E970, 0x1E971, 0x1E972, 0x1E973, 0x1E974, 0x1E975, 0x1E976, 0x1E977,
+        0x1E978, 0x1E979, 0x1E97A, 0x1E97B, 0x1E97C, 0x1E97D, 0x1E97E, 0x1E97F,
+    },
+    {
+        0x04E3D, 0x04E38, 0x04E41, 0x20122, 0x04F60, 0x04FAE, 0x04FBB, 0x05002,
+        0x0507A, 0x05099, 0x050E7, 0x050CF, 0x0349E, 0x2063A, 0x0514D, 0x05154,
+        0x05164, 0x05177, 0x2051C, 0x034B9, 0x05167, 0x0518D, 0x2054B, 0x05197,
+        0x051A4, 0x04ECC, 0x051AC, 0x051B5, 0x291DF, 0x051F5, 0x05203, 0x034DF,
+        0x0523B, 0x05246, 0x05272, 0x05277, 0x03515, 0x052C7, 0x052C9, 0x052E4,
+        0x052FA, 0x05305, 0x05306, 0x05317, 0x05349, 0x05351, 0x0535A, 0x05373,
+        0x0537D, 0x0537F, 0x0537F, 0x0537F, 0x20A2C, 0x07070, 0x053CA, 0x053DF,
+        0x20B63, 0x053EB, 0x053F1, 0x05406, 0x0549E, 0x05438, 0x05448, 0x05468,
+        0x054A2, 0x054F6, 0x05510, 0x05553, 0x05563, 0x05584, 0x05584, 0x05599,
+        0x055AB, 0x055B3, 0x055C2, 0x05716, 0x05606, 0x05717, 0x05651, 0x05674,
+        0x05207, 0x058EE, 0x057CE, 0x057F4, 0x0580D, 0x0578B, 0x05832, 0x05831,
+        0x058AC, 0x214E4, 0x058F2, 0x058F7, 0x05906, 0x0591A, 0x05922, 0x05962,
+        0x216A8, 0x216EA, 0x059EC, 0x05A1B, 0x05A27, 0x059D8, 0x05A66, 0x036EE,
+        0x036FC, 0x05B08, 0x05B3E, 0x05B3E, 0x219C8, 0x05BC3, 0x05BD8, 0x05BE7,
+        0x05BF3, 0x21B18, 0x05BFF, 0x05C06, 0x05F53, 0x05C22, 0x03781, 0x05C60,
+        0x05C6E, 0x05CC0, 0x05C8D, 0x21DE4, 0x05D43, 0x21DE6, 0x05D6E, 0x05D6B,
+    },
+    {
+        0x05D7C, 0x05DE1, 0x05DE2, 0x0382F, 0x05DFD, 0x05E28, 0x05E3D, 0x05E69,
+        0x03862, 0x22183, 0x0387C, 0x05EB0, 0x05EB3, 0x05EB6, 0x05ECA, 0x2A392,
+        0x05EFE, 0x22331, 0x22331, 0x08201, 0x05F22, 0x05F22, 0x038C7, 0x232B8,
+        0x261DA, 0x05F62, 0x05F6B, 0x038E3, 0x05F9A, 0x05FCD, 0x05FD7, 0x05FF9,
+        0x06081, 0x0393A, 0x0391C, 0x06094, 0x226D4, 0x060C7, 0x06148, 0x0614C,
+        0x0614E, 0x0614C, 0x0617A, 0x0618E, 0x061B2, 0x061A4, 0x061AF, 0x061DE,
+        0x061F2, 0x061F6, 0x06210, 0x0621B, 0x0625D, 0x062B1, 0x062D4, 0x06350,
+        0x22B0C, 0x0633D, 0x062FC, 0x06368, 0x06383, 0x063E4, 0x22BF1, 0x06422,
+        0x063C5, 0x063A9, 0x03A2E, 0x06469, 0x0647E, 0x0649D, 0x06477, 0x03A6C,
+        0x0654F, 0x0656C, 0x2300A, 0x065E3, 0x066F8, 0x06649, 0x03B19, 0x06691,
+        0x03B08, 0x03AE4, 0x05192, 0x05195, 0x06700, 0x0669C, 0x080AD, 0x043D9,
+        0x06717, 0x0671B, 0x06721, 0x0675E, 0x06753, 0x233C3, 0x03B49, 0x067FA,
+        0x06785, 0x06852, 0x06885, 0x2346D, 0x0688E, 0x0681F, 0x06914, 0x03B9D,
+        0x06942, 0x069A3, 0x069EA, 0x06AA8, 0x236A3, 0x06ADB, 0x03C18, 0x06B21,
+        0x238A7, 0x06B54, 0x03C4E, 0x06B72, 0x06B9F, 0x06BBA, 0x06BBB, 0x23A8D,
+        0x21D0B, 0x23AFA, 0x06C4E, 0x23CBC, 0x06CBF, 0x06CCD, 0x06C67, 0x06D16,
+    },
+    {
+        0x06D3E, 0x06D77, 0x06D41, 0x06D69, 0x06D78, 0x06D85, 0x23D1E, 0x06D34,
+        0x06E2F, 0x06E6E, 0x03D33, 0x06ECB, 0x06EC7, 0x23ED1, 0x06DF9, 0x06F6E,
+        0x23F5E, 0x23F8E, 0x06FC6, 0x07039, 0x0701E, 0x0701B, 0x03D96, 0x0704A,
+        0x0707D, 0x07077, 0x070AD, 0x20525, 0x07145, 0x24263, 0x0719C, 0x243AB,
+        0x07228, 0x07235, 0x07250, 0x24608, 0x07280, 0x07295, 0x24735, 0x24814,
+        0x0737A, 0x0738B, 0x03EAC, 0x073A5, 0x03EB8, 0x03EB8, 0x07447, 0x0745C,
+        0x07471, 0x07485, 0x074CA, 0x03F1B, 0x07524, 0x24C36, 0x0753E, 0x24C92,
+        0x07570, 0x2219F, 0x07610, 0x24FA1, 0x24FB8, 0x25044, 0x03FFC, 0x04008,
+        0x076F4, 0x250F3, 0x250F2, 0x25119, 0x25133, 0x0771E, 0x0771F, 0x0771F,
+        0x0774A, 0x04039, 0x0778B, 0x04046, 0x04096, 0x2541D, 0x0784E, 0x0788C,
+        0x078CC, 0x040E3, 0x25626, 0x07956, 0x2569A, 0x256C5, 0x0798F, 0x079EB,
+        0x0412F, 0x07A40, 0x07A4A, 0x07A4F, 0x2597C, 0x25AA7, 0x25AA7, 0x07AEE,
+        0x04202, 0x25BAB, 0x07BC6, 0x07BC9, 0x04227, 0x25C80, 0x07CD2, 0x042A0,
+        0x07CE8, 0x07CE3, 0x07D00, 0x25F86, 0x07D63, 0x04301, 0x07DC7, 0x07E02,
+        0x07E45, 0x04334, 0x26228, 0x26247, 0x04359, 0x262D9, 0x07F7A, 0x2633E,
+        0x07F95, 0x07FFA, 0x08005, 0x264DA, 0x26523, 0x08060, 0x265A8, 0x08070,
+    },
+    {
+        0x2335F, 0x043D5, 0x080B2, 0x08103, 0x0440B, 0x0813E, 0x05AB5, 0x267A7,
+        0x267B5, 0x23393, 0x2339C, 0x08201, 0x08204, 0x08F9E, 0x0446B, 0x08291,
+        0x0828B, 0x0829D, 0x052B3, 0x082B1, 0x082B3, 0x082BD, 0x082E6, 0x26B3C,
+        0x082E5, 0x0831D, 0x08363, 0x083AD, 0x08323, 0x083BD, 0x083E7, 0x08457,
+        0x08353, 0x083CA, 0x083CC, 0x083DC, 0x26C36, 0x26D6B, 0x26CD5, 0x0452B,
+        0x084F1, 0x084F3, 0x08516, 0x273CA, 0x08564, 0x26F2C, 0x0455D, 0x04561,
+        0x26FB1, 0x270D2, 0x0456B, 0x08650, 0x0865C, 0x08667, 0x08669, 0x086A9,
+        0x08688, 0x0870E, 0x086E2, 0x08779, 0x08728, 0x0876B, 0x08786, 0x045D7,
+        0x087E1, 0x08801, 0x045F9, 0x08860, 0x08863, 0x27667, 0x088D7, 0x088DE,
+        0x04635, 0x088FA, 0x034BB, 0x278AE, 0x27966, 0x046BE, 0x046C7, 0x08AA0,
+        0x08AED, 0x08B8A, 0x08C55, 0x27CA8, 0x08CAB, 0x08CC1, 0x08D1B, 0x08D77,
+        0x27F2F, 0x20804, 0x08DCB, 0x08DBC, 0x08DF0, 0x208DE, 0x08ED4, 0x08F38,
+        0x285D2, 0x285ED, 0x09094, 0x090F1, 0x09111, 0x2872E, 0x0911B, 0x09238,
+        0x092D7, 0x092D8, 0x0927C, 0x093F9, 0x09415, 0x28BFA, 0x0958B, 0x04995,
+        0x095B7, 0x28D77, 0x049E6, 0x096C3, 0x05DB2, 0x09723, 0x29145, 0x2921A,
+        0x04A6E, 0x04A76, 0x097E0, 0x2940A, 0x04AB2, 0x29496, 0x0980B, 0x0980B,
+    },
+    {
+        0x09829, 0x295B6, 0x098E2, 0x04B33, 0x09929, 0x099A7, 0x099C2, 0x099FE,
+        0x04BCE, 0x29B30, 0x09B12, 0x09C40, 0x09CFD, 0x04CCE, 0x04CED, 0x09D67,
+        0x2A0CE, 0x04CF8, 0x2A105, 0x2A20E, 0x2A291, 0x09EBB, 0x04D56, 0x09EF9,
+        0x09EFE, 0x09F05, 0x09F0F, 0x09F16, 0x09F3B, 0x2A600, 0x2FA1E, 0x2FA1F,
+        0x2FA20, 0x2FA21, 0x2FA22, 0x2FA23, 0x2FA24, 0x2FA25, 0x2FA26, 0x2FA27,
+        0x2FA28, 0x2FA29, 0x2FA2A, 0x2FA2B, 0x2FA2C, 0x2FA2D, 0x2FA2E, 0x2FA2F,
+        0x2FA30, 0x2FA31, 0x2FA32, 0x2FA33, 0x2FA34, 0x2FA35, 0x2FA36, 0x2FA37,
+        0x2FA38, 0x2FA39, 0x2FA3A, 0x2FA3B, 0x2FA3C, 0x2FA3D, 0x2FA3E, 0x2FA3F,
+        0x2FA40, 0x2FA41, 0x2FA42, 0x2FA43, 0x2FA44, 0x2FA45, 0x2FA46, 0x2FA47,
+        0x2FA48, 0x2FA49, 0x2FA4A, 0x2FA4B, 0x2FA4C, 0x2FA4D, 0x2FA4E, 0x2FA4F,
+        0x2FA50, 0x2FA51, 0x2FA52, 0x2FA53, 0x2FA54, 0x2FA55, 0x2FA56, 0x2FA57,
+        0x2FA58, 0x2FA59, 0x2FA5A, 0x2FA5B, 0x2FA5C, 0x2FA5D, 0x2FA5E, 0x2FA5F,
+        0x2FA60, 0x2FA61, 0x2FA62, 0x2FA63, 0x2FA64, 0x2FA65, 0x2FA66, 0x2FA67,
+        0x2FA68, 0x2FA69, 0x2FA6A, 0x2FA6B, 0x2FA6C, 0x2FA6D, 0x2FA6E, 0x2FA6F,
+        0x2FA70, 0x2FA71, 0x2FA72, 0x2FA73, 0x2FA74, 0x2FA75, 0x2FA76, 0x2FA77,
+        0x2FA78, 0x2FA79, 0x2FA7A, 0x2FA7B, 0x2FA7C, 0x2FA7D, 0x2FA7E, 0x2FA7F,
+    },
+    {
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+    },
+    {
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+        0xE01F0, 0xE01F1, 0xE01F2, 0xE01F3, 0xE01F4, 0xE01F5, 0xE01F6, 0xE01F7,
+        0xE01F8, 0xE01F9, 0xE01FA, 0xE01FB, 0xE01FC, 0xE01FD, 0xE01FE, 0xE01FF,
+    },
+};
+
+// Zero padded
+static const uint32_t uc_fold_multi[][3] __attribute__((unused)) = {
+    {0x009C7, 0x009BE, 0x00000},
+    {0x009C7, 0x009D7, 0x00000},
+    {0x00B47, 0x00B3E, 0x00000},
+    {0x00B47, 0x00B57, 0x00000},
+    {0x00B92, 0x00BD7, 0x00000},
+    {0x00BC6, 0x00BBE, 0x00000},
+    {0x00BC7, 0x00BBE, 0x00000},
+    {0x00BC6, 0x00BD7, 0x00000},
+    {0x00CC2, 0x00CD5, 0x00000},
+    {0x00D46, 0x00D3E, 0x00000},
+    {0x00D47, 0x00D3E, 0x00000},
+    {0x00D46, 0x00D57, 0x00000},
+    {0x00DD9, 0x00DCF, 0x00000},
+    {0x00DD9, 0x00DDF, 0x00000},
+    {0x01B05, 0x01B35, 0x00000},
+    {0x01B07, 0x01B35, 0x00000},
+    {0x01B09, 0x01B35, 0x00000},
+    {0x01B0B, 0x01B35, 0x00000},
+    {0x01B0D, 0x01B35, 0x00000},
+    {0x01B11, 0x01B35, 0x00000},
+    {0x01B3E, 0x01B35, 0x00000},
+    {0x01B3F, 0x01B35, 0x00000},
+    {0x11347, 0x1133E, 0x00000},
+    {0x11347, 0x11357, 0x00000},
+    {0x114B9, 0x114B0, 0x00000},
+    {0x114B9, 0x114BD, 0x00000},
+    {0x115B8, 0x115AF, 0x00000},
+    {0x115B9, 0x115AF, 0x00000},
+    {0x11935, 0x11930, 0x00000},
+    {0x1D157, 0x1D165, 0x00000},
+    {0x1D158, 0x1D165, 0x00000},
+    {0x1D158, 0x1D165, 0x1D16E},
+    {0x1D158, 0x1D165, 0x1D16F},
+    {0x1D158, 0x1D165, 0x1D170},
+    {0x1D158, 0x1D165, 0x1D171},
+    {0x1D158, 0x1D165, 0x1D172},
+    {0x1D1B9, 0x1D165, 0x00000},
+    {0x1D1BA, 0x1D165, 0x00000},
+    {0x1D1B9, 0x1D165, 0x1D16E},
+    {0x1D1BA, 0x1D165, 0x1D16E},
+    {0x1D1B9, 0x1D165, 0x1D16F},
+    {0x1D1BA, 0x1D165, 0x1D16F},
+};
+
+#endif
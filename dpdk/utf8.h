@@ -0,0 +1,146 @@
+#ifndef UTF8_H
+#define UTF8_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "unicode_tables.h"
+
+enum uc_class {
+    UC_LETTER,
+    UC_NUMBER,
+    UC_SPACE,
+    UC_OTHER,
+};
+
+// Decodes the code point at s[i]. Invalid or truncated sequences decode as
+// the single byte so the caller always makes progress.
+static inline uint32_t utf8_decode(const uint8_t *s, size_t len, size_t i, size_t *cp_len) {
+    uint8_t c = s[i];
+    if (c < 0x80) {
+        *cp_len = 1;
+        return c;
+    }
+    size_t n;
+    uint32_t cp;
+    if ((c & 0xE0) == 0xC0) { n = 2; cp = c & 0x1F; }
+    else if ((c & 0xF0) == 0xE0) { n = 3; cp = c & 0x0F; }
+    else if ((c & 0xF8) == 0xF0) { n = 4; cp = c & 0x07; }
+    else { *cp_len = 1; return c; }
+    if (i + n > len) {
+        *cp_len = 1;
+        return c;
+    }
+    for (size_t k = 1; k < n; k++) {
+        if ((s[i + k] & 0xC0) != 0x80) {
+            *cp_len = 1;
+            return c;
+        }
+        cp = (cp << 6) | (s[i + k] & 0x3F);
+    }
+    *cp_len = n;
+    return cp;
+}
+
+// Length of the prefix of s[0, len) that ends on a character boundary: a
+// trailing lead byte whose continuation bytes have not arrived yet is cut off.
+static inline size_t utf8_complete_len(const uint8_t *s, size_t len) {
+    for (size_t k = 1; k <= 3 && k <= len; k++) {
+        uint8_t c = s[len - k];
+        if ((c & 0xC0) == 0x80) continue;
+        size_t n = c >= 0xF0 ? 4 : c >= 0xE0 ? 3 : c >= 0xC0 ? 2 : 1;
+        return n > k ? len - k : len;
+    }
+    return len;
+}
+
+static inline int utf8_encode(uint32_t cp, uint8_t *out) {
+    if (cp < 0x80) { out[0] = cp; return 1; }
+    if (cp < 0x800) { out[0] = 0xC0 | (cp >> 6); out[1] = 0x80 | (cp & 0x3F); return 2; }
+    if (cp < 0x10000) {
+        out[0] = 0xE0 | (cp >> 12); out[1] = 0x80 | ((cp >> 6) & 0x3F); out[2] = 0x80 | (cp & 0x3F);
+        return 3;
+    }
+    out[0] = 0xF0 | (cp >> 18); out[1] = 0x80 | ((cp >> 12) & 0x3F);
+    out[2] = 0x80 | ((cp >> 6) & 0x3F); out[3] = 0x80 | (cp & 0x3F);
+    return 4;
+}
+
+// Binary search over the sorted, disjoint ranges of unicode_tables.h.
+static inline int uc_in_ranges(const uint32_t (*ranges)[2], int count, uint32_t cp) {
+    int lo = 0, hi = count - 1;
+    while (lo <= hi) {
+        int mid = (lo + hi) / 2;
+        if (cp < ranges[mid][0]) hi = mid - 1;
+        else if (cp > ranges[mid][1]) lo = mid + 1;
+        else return 1;
+    }
+    return 0;
+}
+
+#define UC_IN(table, cp) uc_in_ranges(table, sizeof(table) / sizeof(table[0]), cp)
+
+// White_Space, the \s of the HuggingFace pre-tokenizer regexes.
+static inline int uc_is_space(uint32_t cp) {
+    if (cp < 0x80) return cp == ' ' || (cp >= '\t' && cp <= '\r');
+    return UC_IN(uc_space_ranges, cp);
+}
+
+// The \p{L} / \p{N} / \s split of the HuggingFace pre-tokenizer regexes,
+// from the Unicode tables generated by vocab/gen_unicode_tables.py. ASCII
+// is tested inline; anything else costs a binary search or two.
+static inline enum uc_class uc_classify(uint32_t cp) {
+    if (cp < 0x80) {
+        if ((cp | 0x20) >= 'a' && (cp | 0x20) <= 'z') return UC_LETTER;
+        if (cp >= '0' && cp <= '9') return UC_NUMBER;
+        if (cp == ' ' || (cp >= '\t' && cp <= '\r')) return UC_SPACE;
+        return UC_OTHER;
+    }
+    if (UC_IN(uc_letter_ranges, cp)) return UC_LETTER;
+    if (UC_IN(uc_number_ranges, cp)) return UC_NUMBER;
+    if (UC_IN(uc_space_ranges, cp)) return UC_SPACE;
+    return UC_OTHER;
+}
+
+// The BERT lowercase + strip accents of cp (lower(), NFD, drop Mn) into out.
+// Returns the number of code points it becomes, up to 3, and 0 for dropped
+// combining marks. Hangul syllables decompose into their jamo.
+static inline int uc_fold(uint32_t cp, uint32_t *out) {
+    if (cp < 0x80) {
+        out[0] = (cp >= 'A' && cp <= 'Z') ? cp + 32 : cp;
+        return 1;
+    }
+    if (cp >= 0xAC00 && cp <= 0xD7A3) {
+        uint32_t s = cp - 0xAC00;
+        out[0] = 0x1100 + s / 588;
+        out[1] = 0x1161 + s % 588 / 28;
+        out[2] = 0x11A7 + s % 28;
+        return s % 28 ? 3 : 2;
+    }
+    uint8_t block = cp < UC_FOLD_END ? uc_fold_index[cp >> UC_FOLD_SHIFT] : 0;
+    if (!block) {
+        out[0] = cp;
+        return 1;
+    }
+    uint32_t v = uc_fold_blocks[block - 1][cp & ((1 << UC_FOLD_SHIFT) - 1)];
+    if (!(v & UC_FOLD_MULTI)) {
+        out[0] = v;
+        return v != 0;
+    }
+    const uint32_t *m = uc_fold_multi[v & ~UC_FOLD_MULTI];
+    out[0] = m[0];
+    out[1] = m[1];
+    out[2] = m[2];
+    return m[2] ? 3 : 2;
+}
+
+static inline enum uc_class utf8_class_at(const uint8_t *s, size_t len, size_t i, size_t *cp_len) {
+    uint8_t c = s[i];
+    if (c < 0x80) {
+        *cp_len = 1;
+        return uc_classify(c);
+    }
+    return uc_classify(utf8_decode(s, len, i, cp_len));
+}
+
+#endif
@@ -0,0 +1,120 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <rte_malloc.h>
+
+#include "trie.h"
+#include "vocab.h"
+
+char *vocab_read_file(const char *path, long *size) {
+    FILE *file = fopen(path, "r");
+    if (!file) {
+        printf("Error: Could not open '%s'\n", path);
+        return NULL;
+    }
+    fseek(file, 0, SEEK_END);
+    *size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    char *data = malloc(*size + 1);
+    if (!data || fread(data, 1, *size, file) != (size_t)*size) {
+        printf("Error: Could not read '%s'\n", path);
+        free(data);
+        fclose(file);
+        return NULL;
+    }
+    fclose(file);
+    data[*size] = '\0';
+    return data;
+}
+
+uint32_t vocab_crc32(uint32_t crc, const void *buf, size_t len) {
+    static uint32_t table[256];
+    if (!table[1]) {
+        for (uint32_t i = 0; i < 256; i++) {
+            uint32_t c = i;
+            for (int k = 0; k < 8; k++) c = c & 1 ? 0xEDB88320 ^ (c >> 1) : c >> 1;
+            table[i] = c;
+        }
+    }
+    const uint8_t *p = buf;
+    crc = ~crc;
+    while (len--) crc = table[(crc ^ *p++) & 0xFF] ^ (crc >> 8);
+    return ~crc;
+}
+
+int vocab_is_image(const char *path) {
+    char magic[8];
+    FILE *file = fopen(path, "rb");
+    if (!file) return 0;
+    int ok = fread(magic, 1, sizeof(magic), file) == sizeof(magic) && !memcmp(magic, VOCAB_IMAGE_MAGIC, 8);
+    fclose(file);
+    return ok;
+}
+
+static int section_ok(const struct vocab_image_header *img, uint64_t off, uint64_t bytes) {
+    return off % VOCAB_IMAGE_ALIGN == 0 && off >= sizeof(*img) && off <= img->image_size &&
+           bytes <= img->image_size - off;
+}
+
+const struct vocab_image_header *vocab_image_open(const char *path) {
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        printf("Error: Could not open '%s'\n", path);
+        return NULL;
+    }
+    struct stat st;
+    if (fstat(fd, &st) < 0 || (size_t)st.st_size < sizeof(struct vocab_image_header)) {
+        printf("Error: '%s' is too small for a vocabulary image\n", path);
+        close(fd);
+        return NULL;
+    }
+    // A file mapping would get 4 KB pages; the trie is walked at random and
+    // wants the TLB reach of hugepages, so the image is read into them.
+    uint8_t *buf = rte_malloc("vocab_image", st.st_size, VOCAB_IMAGE_ALIGN);
+    if (!buf) {
+        printf("Error: Could not allocate %lld bytes for '%s'\n", (long long)st.st_size, path);
+        close(fd);
+        return NULL;
+    }
+    for (off_t done = 0; done < st.st_size;) {
+        ssize_t n = read(fd, buf + done, st.st_size - done);
+        if (n <= 0) {
+            printf("Error: Could not read '%s'\n", path);
+            rte_free(buf);
+            close(fd);
+            return NULL;
+        }
+        done += n;
+    }
+    close(fd);
+
+    const struct vocab_image_header *img = (const struct vocab_image_header *)buf;
+    const char *err = NULL;
+    if (memcmp(img->magic, VOCAB_IMAGE_MAGIC, 8))
+        err = "bad magic";
+    else if (img->version != VOCAB_IMAGE_VERSION)
+        err = "unsupported version";
+    else if (img->image_size != (uint64_t)st.st_size)
+        err = "truncated image";
+    else if (vocab_crc32(0, buf + 16, st.st_size - 16) != img->checksum)
+        err = "checksum mismatch";
+    else if (img->trie_size < 257 || !section_ok(img, img->trie_off, (uint64_t)img->trie_size * sizeof(struct da_node)))
+        err = "bad trie section";
+    else if ((img->flags & VOCAB_IMAGE_BYTE_LEVEL) &&
+             (!img->merge_slots || (img->merge_slots & (img->merge_slots - 1)) ||
+              !section_ok(img, img->merge_off, (uint64_t)img->merge_slots * sizeof(struct vocab_merge))))
+        err = "bad merge section";
+    if (err) {
+        printf("Error: '%s': %s\n", path, err);
+        rte_free(buf);
+        return NULL;
+    }
+    return img;
+}
+
+void vocab_image_close(const struct vocab_image_header *img) {
+    rte_free((void *)img);
+}
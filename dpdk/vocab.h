@@ -0,0 +1,67 @@
+#ifndef VOCAB_H
+#define VOCAB_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define VOCAB_IMAGE_MAGIC "NTKVOCAB"
+#define VOCAB_IMAGE_VERSION 1
+#define VOCAB_IMAGE_ALIGN 64
+
+// Image flags
+#define VOCAB_IMAGE_BYTE_LEVEL 0x1   // byte_ids and a merge table are present
+
+struct vocab_token {
+    const uint8_t *bytes;
+    uint32_t len;
+    int id;
+};
+
+// Open-addressing merge table entry shared by the image and the JSON loader:
+// key = left id << 32 | right id, val = rank << 32 | merged id. Slots are
+// probed linearly from vocab_merge_slot(); empty slots hold VOCAB_MERGE_EMPTY.
+struct vocab_merge {
+    uint64_t key;
+    uint64_t val;
+};
+
+#define VOCAB_MERGE_EMPTY UINT64_MAX
+
+static inline uint32_t vocab_merge_slot(uint64_t key) {
+    return (uint32_t)((key * 0x9E3779B97F4A7C15ULL) >> 32);
+}
+
+// Binary vocabulary written by vocab/compile_vocab.py. All fields are little
+// endian and every section starts on a VOCAB_IMAGE_ALIGN boundary, so the
+// loader reads the file once and points the lookup structures straight into it.
+struct vocab_image_header {
+    char magic[8];
+    uint32_t version;
+    uint32_t checksum;          // CRC-32 (zlib) of bytes [16, image_size)
+    uint64_t image_size;
+    uint32_t flags;
+    uint32_t vocab_size;
+    uint32_t nb_keys;
+    uint32_t max_len;
+    uint64_t trie_off;          // struct da_node[trie_size]
+    uint32_t trie_size;
+    uint32_t nb_merges;
+    uint64_t merge_off;         // struct vocab_merge[merge_slots]
+    uint32_t merge_slots;       // power of two, 0 without VOCAB_IMAGE_BYTE_LEVEL
+    uint32_t reserved;
+    int32_t byte_ids[256];
+};
+
+char *vocab_read_file(const char *path, long *size);
+
+// Returns 1 when path starts with the image magic.
+int vocab_is_image(const char *path);
+
+// Reads an image into hugepage memory and validates it; NULL on a bad magic,
+// version, size or checksum.
+const struct vocab_image_header *vocab_image_open(const char *path);
+void vocab_image_close(const struct vocab_image_header *img);
+
+uint32_t vocab_crc32(uint32_t crc, const void *buf, size_t len);
+
+#endif
@@ -0,0 +1,82 @@
+#include <stdio.h>
+#include <string.h>
+#include <rte_common.h>
+#include <rte_hash_crc.h>
+#include <rte_malloc.h>
+
+#include "wcache.h"
+
+static uint32_t last_tag;
+
+struct wcache *wcache_create(uint32_t entries, int socket_id) {
+    uint32_t sets = rte_align32pow2(RTE_MAX(entries / WCACHE_WAYS, 1u));
+    size_t size = sizeof(struct wcache) + (size_t)sets * sizeof(struct wcache_set) +
+                  (size_t)sets * WCACHE_WAYS * sizeof(struct wcache_entry);
+    struct wcache *c = rte_zmalloc_socket("wcache", size, RTE_CACHE_LINE_SIZE, socket_id);
+    if (!c) {
+        printf("Error: Cannot allocate word cache for %u entries\n", sets * WCACHE_WAYS);
+        return NULL;
+    }
+    c->set_mask = sets - 1;
+    c->entries = (struct wcache_entry *)&c->sets[sets];
+    return c;
+}
+
+void wcache_free(struct wcache *c) {
+    rte_free(c);
+}
+
+uint32_t wcache_new_tag(void) {
+    return __atomic_add_fetch(&last_tag, 1, __ATOMIC_RELAXED);
+}
+
+static inline uint32_t wcache_sig(uint32_t tag, const uint8_t *word, size_t len) {
+    return rte_hash_crc(word, len, tag) | 1;
+}
+
+int wcache_lookup(struct wcache *c, uint32_t tag, const uint8_t *word, size_t len, int *ids, int max_ids) {
+    if (len > WCACHE_MAX_WORD) return -1;
+    uint32_t sig = wcache_sig(tag, word, len);
+    uint32_t s = sig & c->set_mask;
+    struct wcache_set *set = &c->sets[s];
+    for (int w = 0; w < WCACHE_WAYS; w++) {
+        if (set->sig[w] != sig) continue;
+        const struct wcache_entry *e = &c->entries[s * WCACHE_WAYS + w];
+        if (e->tag != tag || e->len != len || memcmp(e->word, word, len)) continue;
+        set->ref |= 1 << w;
+        c->stats.hits++;
+        int n = RTE_MIN((int)e->nb_ids, max_ids);
+        for (int k = 0; k < n; k++) ids[k] = e->ids[k];
+        return n;
+    }
+    c->stats.misses++;
+    return -1;
+}
+
+// A new entry starts unreferenced, so a piece seen once is the first to go
+// and a burst of one-off pieces cannot flush the working set.
+void wcache_insert(struct wcache *c, uint32_t tag, const uint8_t *word, size_t len, const int *ids, int nb_ids) {
+    if (len > WCACHE_MAX_WORD || nb_ids > WCACHE_MAX_IDS) return;
+    uint32_t sig = wcache_sig(tag, word, len);
+    uint32_t s = sig & c->set_mask;
+    struct wcache_set *set = &c->sets[s];
+    int w = 0;
+    while (w < WCACHE_WAYS && set->sig[w]) w++;
+    if (w == WCACHE_WAYS) {
+        while (set->ref & 1 << set->hand) {
+            set->ref &= ~(1 << set->hand);
+            set->hand = (set->hand + 1) % WCACHE_WAYS;
+        }
+        w = set->hand;
+        set->hand = (w + 1) % WCACHE_WAYS;
+        c->stats.evictions++;
+    }
+    struct wcache_entry *e = &c->entries[s * WCACHE_WAYS + w];
+    e->tag = tag;
+    e->len = len;
+    e->nb_ids = nb_ids;
+    memcpy(e->word, word, len);
+    for (int k = 0; k < nb_ids; k++) e->ids[k] = ids[k];
+    set->sig[w] = sig;
+    set->ref &= ~(1 << w);
+}
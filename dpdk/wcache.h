@@ -0,0 +1,59 @@
+#ifndef WCACHE_H
+#define WCACHE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <rte_common.h>
+
+#define WCACHE_WAYS 8           // entries per set
+#define WCACHE_MAX_WORD 26      // longer pieces bypass the cache
+#define WCACHE_MAX_IDS 8        // as do pieces that encode to more ids
+
+struct wcache_stats {
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t evictions;
+};
+
+// A piece and its ids, one cache line. tag tells apart the engines sharing
+// the cache, so entries of a replaced vocabulary can never hit.
+struct wcache_entry {
+    uint32_t tag;
+    uint8_t len;
+    uint8_t nb_ids;
+    uint8_t word[WCACHE_MAX_WORD];
+    int32_t ids[WCACHE_MAX_IDS];
+};
+
+// The signatures of a set's entries are compared before any entry is read,
+// so a miss costs one cache line. ref and hand are the CLOCK state: a
+// referenced bit per way, cleared as the hand sweeps past for a victim.
+struct wcache_set {
+    uint32_t sig[WCACHE_WAYS];  // 0 for a free way
+    uint8_t ref;
+    uint8_t hand;
+} __rte_cache_aligned;
+
+// Per-lcore piece -> ids cache in front of the BPE and WordPiece engines.
+// Not thread safe. Memory is fixed at creation: entries (rounded up to whole
+// sets, a power of two) cache lines plus one line of signatures per set.
+struct wcache {
+    uint32_t set_mask;
+    struct wcache_stats stats;
+    struct wcache_entry *entries;   // WCACHE_WAYS per set
+    struct wcache_set sets[];
+};
+
+struct wcache *wcache_create(uint32_t entries, int socket_id);
+void wcache_free(struct wcache *c);
+
+// A tag for a newly loaded engine, never handed out before.
+uint32_t wcache_new_tag(void);
+
+// Copies the ids of word, as encoded by the engine with tag, into ids (at
+// most max_ids of them) and returns their count, or returns -1 on a miss.
+int wcache_lookup(struct wcache *c, uint32_t tag, const uint8_t *word, size_t len, int *ids, int max_ids);
+// Caches the nb_ids ids of word, evicting from its set if need be.
+void wcache_insert(struct wcache *c, uint32_t tag, const uint8_t *word, size_t len, const int *ids, int nb_ids);
+
+#endif
@@ -0,0 +1,213 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <rte_common.h>
+#include <rte_malloc.h>
+
+#include "wordpiece.h"
+#include "trie.h"
+#include "utf8.h"
+#include "vocab.h"
+#include "wcache.h"
+
+static inline int bert_is_control(uint32_t cp) {
+    if (cp == '\t' || cp == '\n' || cp == '\r') return 0;
+    if (cp < 0x20 || cp == 0x7F) return 1;
+    if (cp < 0x80) return 0;
+    return UC_IN(uc_control_ranges, cp);
+}
+
+static inline int bert_is_space(uint32_t cp) {
+    return cp == ' ' || cp == '\t' || cp == '\n' || cp == '\r' || cp == 0xA0 || cp == 0x1680 ||
+           (cp >= 0x2000 && cp <= 0x200A) || cp == 0x202F || cp == 0x205F || cp == 0x3000;
+}
+
+static inline int bert_is_punct(uint32_t cp) {
+    if ((cp >= 33 && cp <= 47) || (cp >= 58 && cp <= 64) || (cp >= 91 && cp <= 96) || (cp >= 123 && cp <= 126))
+        return 1;
+    if (cp < 0x80) return 0;
+    return UC_IN(uc_punct_ranges, cp);
+}
+
+static inline int bert_is_cjk(uint32_t cp) {
+    return (cp >= 0x4E00 && cp <= 0x9FFF) || (cp >= 0x3400 && cp <= 0x4DBF) ||
+           (cp >= 0x20000 && cp <= 0x2A6DF) || (cp >= 0x2A700 && cp <= 0x2CEAF) ||
+           (cp >= 0xF900 && cp <= 0xFAFF) || (cp >= 0x2F800 && cp <= 0x2FA1F);
+}
+
+// Resolves the special tokens once wp->trie is set.
+static int wordpiece_init(struct wordpiece *wp, int lowercase) {
+    wp->cont_node = da_trie_walk(wp->trie, DA_ROOT, (const uint8_t *)"##", 2);
+    wp->lowercase = lowercase;
+    wp->unk_id = da_trie_lookup(wp->trie, (const uint8_t *)"[UNK]", 5);
+    wp->cls_id = da_trie_lookup(wp->trie, (const uint8_t *)"[CLS]", 5);
+    wp->sep_id = da_trie_lookup(wp->trie, (const uint8_t *)"[SEP]", 5);
+    wp->pad_id = da_trie_lookup(wp->trie, (const uint8_t *)"[PAD]", 5);
+    if (wp->unk_id < 0 || wp->cls_id < 0 || wp->sep_id < 0) {
+        printf("Error: Vocabulary is missing [UNK], [CLS] or [SEP]\n");
+        return -1;
+    }
+    if (wp->pad_id < 0) wp->pad_id = 0;
+    return 0;
+}
+
+struct wordpiece *wordpiece_create(const char *vocab_file, int lowercase) {
+    printf("Creating WordPiece tokenizer from %s...\n", vocab_file);
+    long size;
+    char *data = vocab_read_file(vocab_file, &size);
+    if (!data) return NULL;
+
+    int lines = 1;
+    for (long i = 0; i < size; i++)
+        if (data[i] == '\n') lines++;
+    struct vocab_token *tokens = calloc(lines, sizeof(*tokens));
+    struct wordpiece *wp = rte_zmalloc("wordpiece", sizeof(*wp), 0);
+    if (!tokens || !wp) goto fail;
+    wp->cache_tag = wcache_new_tag();
+
+    int n = 0, id = 0;
+    char *line = data;
+    while (line < data + size) {
+        char *end = memchr(line, '\n', data + size - line);
+        if (!end) end = data + size;
+        size_t len = end - line;
+        if (len && line[len - 1] == '\r') len--;
+        if (len) {
+            tokens[n].bytes = (const uint8_t *)line;
+            tokens[n].len = len;
+            tokens[n].id = id;
+            n++;
+        }
+        id++;
+        line = end + 1;
+    }
+
+    wp->trie = da_trie_build(tokens, n);
+    if (!wp->trie || wordpiece_init(wp, lowercase) < 0) goto fail;
+    printf("Loaded %d WordPiece tokens\n", n);
+
+    free(tokens);
+    free(data);
+    return wp;
+
+fail:
+    free(tokens);
+    free(data);
+    wordpiece_free(wp);
+    return NULL;
+}
+
+struct wordpiece *wordpiece_create_from_image(const char *image_file, int lowercase) {
+    printf("Loading WordPiece vocabulary image %s...\n", image_file);
+    const struct vocab_image_header *img = vocab_image_open(image_file);
+    if (!img) return NULL;
+    struct wordpiece *wp = rte_zmalloc("wordpiece", sizeof(*wp), 0);
+    if (!wp) {
+        vocab_image_close(img);
+        return NULL;
+    }
+    wp->image = img;
+    wp->cache_tag = wcache_new_tag();
+    wp->trie = da_trie_from_image(img);
+    if (!wp->trie || wordpiece_init(wp, lowercase) < 0) {
+        wordpiece_free(wp);
+        return NULL;
+    }
+    printf("Loaded %u WordPiece tokens\n", img->nb_keys);
+    return wp;
+}
+
+void wordpiece_free(struct wordpiece *wp) {
+    if (!wp) return;
+    da_trie_free(wp->trie);
+    vocab_image_close(wp->image);
+    rte_free(wp);
+}
+
+// Greedy longest-match-first over one normalized word: each subword is the
+// longest trie match from the root (first piece) or from the "##" node. A word
+// with any unmatchable remainder becomes a single [UNK].
+static int encode_word(const struct wordpiece *wp, const uint8_t *w, size_t len, int chars, int *ids, int max_ids) {
+    if (chars > WORDPIECE_MAX_CHARS) {
+        ids[0] = wp->unk_id;
+        return 1;
+    }
+    int sub[WORDPIECE_MAX_WORD];
+    size_t start = 0;
+    int n = 0;
+    while (start < len) {
+        uint32_t from = start ? wp->cont_node : DA_ROOT;
+        int id = -1;
+        size_t match = from == DA_NONE ? 0 : da_trie_longest_from(wp->trie, from, w + start, len - start, &id);
+        if (!match) {
+            ids[0] = wp->unk_id;
+            return 1;
+        }
+        sub[n++] = id;
+        start += match;
+    }
+    if (n > max_ids) n = max_ids;
+    memcpy(ids, sub, n * sizeof(*ids));
+    return n;
+}
+
+static int encode_word_cached(const struct wordpiece *wp, struct wcache *cache, const uint8_t *w, size_t len,
+                              int chars, int *ids, int max_ids) {
+    if (!cache) return encode_word(wp, w, len, chars, ids, max_ids);
+    int n = wcache_lookup(cache, wp->cache_tag, w, len, ids, max_ids);
+    if (n >= 0) return n;
+    n = encode_word(wp, w, len, chars, ids, max_ids);
+    if (n < max_ids) wcache_insert(cache, wp->cache_tag, w, len, ids, n);
+    return n;
+}
+
+int wordpiece_encode_partial(const struct wordpiece *wp, struct wcache *cache, const char *text, size_t len,
+                             int final, size_t *consumed, int *ids, int max_ids) {
+    const uint8_t *s = (const uint8_t *)text;
+    uint8_t word[WORDPIECE_MAX_WORD];
+    size_t wlen = 0, wstart = 0;
+    int chars = 0;
+    int n = 0;
+    size_t i = 0;
+
+    if (!final) len = utf8_complete_len(s, len);
+    while (i < len && n < max_ids) {
+        size_t at = i, cp_len;
+        uint32_t cp = utf8_decode(s, len, i, &cp_len);
+        i += cp_len;
+        if (cp == 0 || cp == 0xFFFD || bert_is_control(cp)) continue;
+        if (bert_is_space(cp)) {
+            if (wlen) n += encode_word_cached(wp, cache, word, wlen, chars, ids + n, max_ids - n);
+            wlen = chars = 0;
+            continue;
+        }
+        uint32_t folded[3] = { cp };
+        int nb_folded = wp->lowercase ? uc_fold(cp, folded) : 1;
+        for (int k = 0; k < nb_folded && n < max_ids; k++) {
+            cp = folded[k];
+            if (bert_is_punct(cp) || bert_is_cjk(cp)) {
+                if (wlen) n += encode_word_cached(wp, cache, word, wlen, chars, ids + n, max_ids - n);
+                wlen = chars = 0;
+                if (n < max_ids) {
+                    uint8_t c[4];
+                    n += encode_word(wp, c, utf8_encode(cp, c), 1, ids + n, max_ids - n);
+                }
+                continue;
+            }
+            if (!chars) wstart = at;
+            if (++chars <= WORDPIECE_MAX_CHARS) wlen += utf8_encode(cp, word + wlen);
+        }
+    }
+    if (wlen && !final && n < max_ids) {
+        *consumed = wstart;
+        return n;
+    }
+    if (wlen && n < max_ids) n += encode_word_cached(wp, cache, word, wlen, chars, ids + n, max_ids - n);
+    *consumed = i;
+    return n;
+}
+
+int wordpiece_encode(const struct wordpiece *wp, const char *text, size_t len, int *ids, int max_ids) {
+    size_t consumed;
+    return wordpiece_encode_partial(wp, NULL, text, len, 1, &consumed, ids, max_ids);
+}
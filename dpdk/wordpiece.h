@@ -0,0 +1,45 @@
+#ifndef WORDPIECE_H
+#define WORDPIECE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define WORDPIECE_MAX_CHARS 100   // max_input_chars_per_word
+#define WORDPIECE_MAX_WORD 512
+
+struct da_trie;
+struct wcache;
+struct vocab_image_header;
+
+struct wordpiece {
+    struct da_trie *trie;
+    uint32_t cont_node;   // trie node after "##"
+    int unk_id;
+    int cls_id;
+    int sep_id;
+    int pad_id;
+    int lowercase;
+    const struct vocab_image_header *image;   // backing image, NULL for vocab.txt
+    uint32_t cache_tag;   // its entries in a wcache
+};
+
+// Loads a BERT vocab.txt (one token per line, id = line number). With
+// lowercase set the normalizer matches the uncased models behind
+// python_tokenizers/: bert-tiny, ms-marco-MiniLM and paraphrase-MiniLM.
+struct wordpiece *wordpiece_create(const char *vocab_file, int lowercase);
+// Maps an image compiled from vocab.txt by vocab/compile_vocab.py.
+struct wordpiece *wordpiece_create_from_image(const char *image_file, int lowercase);
+void wordpiece_free(struct wordpiece *wp);
+
+// BERT basic tokenization followed by greedy longest-match-first subwords.
+// Does not add [CLS]/[SEP]; returns the number of ids written.
+int wordpiece_encode(const struct wordpiece *wp, const char *text, size_t len, int *ids, int max_ids);
+
+// As wordpiece_encode, for text that continues past len. Unless final is set,
+// a word still open at the end of the buffer is not encoded and *consumed
+// points at its first byte. Words are looked up in cache first, when given,
+// and added on a miss.
+int wordpiece_encode_partial(const struct wordpiece *wp, struct wcache *cache, const char *text, size_t len,
+                             int final, size_t *consumed, int *ids, int max_ids);
+
+#endif
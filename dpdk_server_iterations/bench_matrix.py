@@ -0,0 +1,284 @@
+#!/usr/bin/env python3
+"""Builds every server generation and runs the same traffic through each on
+local virtual ports, so each change is measured against the ones before it.
+
+Every variant gets the same requests, a fixed set of random lowercase words
+framed the way it parses them: JSON {"sentence"} or {"texts"} for
+tokenizer_1..4, plain text from tokenizer_5 on. All use the char-mode
+vocabulary dpdk/data.json on one lcore unless -l says otherwise.
+
+- Latency: one request at a time over a net_tap port, timed at the client as
+  p50/p99/p999 round trips. The kernel and Python add the same constant to
+  every variant.
+- Throughput: the requests looped at full rate through a net_pcap port
+  (infinite_rx), counting the responses written to its tx_pcap. CPU cycles
+  per request are the server's CPU time over that window at the nominal
+  clock, divided by the responses.
+
+    sudo ./bench_matrix.py                      # all variants, 1 lcore
+    sudo ./bench_matrix.py -l 0-1 -b 32 tokenizer_6 tokenizer
+
+Results are printed as a table and appended to iteration_matrix.csv with the
+date and commit, so later runs can be compared with this history.
+"""
+import argparse
+import datetime
+import json
+import os
+import random
+import socket
+import string
+import struct
+import subprocess
+import sys
+import tempfile
+import time
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+ROOT = os.path.dirname(HERE)
+DPDK_DIR = os.path.join(ROOT, "dpdk")
+sys.path.insert(0, os.path.join(ROOT, "test"))
+import pcap_replay
+
+ETH_TYPE       = 0x88B5
+SRC_PORT       = 12345
+DST_PORT       = 67
+SRC_MAC        = "08:c0:eb:a6:de:3d"
+DST_MAC        = "08:c0:eb:a6:c6:2d"
+TAP_IFACE      = "nettok_tap0"
+CSV_FILE       = os.path.join(HERE, "iteration_matrix.csv")
+PACKET_OUTGOING = 4
+
+MAIN_SOURCES = ["tokenizer.c", "bpe.c", "wordpiece.c", "vocab.c", "trie.c", "proto.c", "itoa.c", "stream.c",
+                "reasm.c", "ctl.c", "wcache.c", "hist.c", "metrics.c", "trace.c"]
+
+# name, sources, how it expects a request, extra server arguments
+VARIANTS = [
+    ("tokenizer_1", [os.path.join(HERE, "tokenizer_1.c")], "sentence", []),
+    ("tokenizer_2", [os.path.join(HERE, "tokenizer_2.c")], "sentence-no-udp", []),
+    ("tokenizer_3", [os.path.join(HERE, "tokenizer_3.c")], "texts", []),
+    ("tokenizer_4", [os.path.join(HERE, "tokenizer_4.c")], "texts", []),
+    ("tokenizer_5", [os.path.join(HERE, "tokenizer_5.c")], "text", []),
+    ("tokenizer_6", [os.path.join(HERE, "tokenizer_6.c")], "text", []),
+    ("tokenizer", [os.path.join(DPDK_DIR, s) for s in MAIN_SOURCES], "text",
+     ["--quiet", "--ctl-socket", "/tmp/nettok_matrix.sock"]),
+]
+
+
+def mac_to_bytes(mac:str) -> bytes:
+    return bytes.fromhex(mac.replace(":", ""))
+
+
+def random_texts(count, batch_size, seed):
+    rng = random.Random(seed)
+    return [" ".join("".join(rng.choices(string.ascii_lowercase, k=rng.randint(1, 5))) for _ in range(batch_size))
+            for _ in range(count)]
+
+
+def build_frame(framing, text):
+    if framing.startswith("sentence"):
+        payload = json.dumps({"sentence": text}).encode()
+    elif framing == "texts":
+        payload = json.dumps({"texts": [text]}).encode()
+    else:
+        payload = text.encode()
+    eth = mac_to_bytes(DST_MAC) + mac_to_bytes(SRC_MAC) + struct.pack("!H", ETH_TYPE)
+    if framing == "sentence-no-udp":      # tokenizer_2 reads JSON right after the Ethernet header
+        return eth + payload
+    return eth + struct.pack("!HHHH", SRC_PORT, DST_PORT, 8 + len(payload), 0) + payload
+
+
+def build(name, sources, build_dir):
+    try:
+        flags = subprocess.run(["pkg-config", "--cflags", "--libs", "libdpdk"], check=True, capture_output=True,
+                               text=True).stdout.split()
+    except (OSError, subprocess.CalledProcessError):
+        sys.exit("pkg-config cannot find libdpdk")
+    binary = os.path.join(build_dir, name)
+    cmd = ["gcc", "-O3", "-march=native", "-o", binary] + sources + flags + ["-lcjson", "-lm"]
+    ret = subprocess.run(cmd, capture_output=True, text=True)
+    if ret.returncode:
+        print(ret.stderr)
+        return None
+    return binary
+
+
+def eal_args(args, vdev):
+    eal = ["-l", args.lcores, "--no-pci", "--vdev", vdev, "--file-prefix", "nettok_matrix"]
+    return eal + ([] if args.huge else ["--no-huge", "-m", "2048"])
+
+
+def cpu_hz():
+    """Nominal clock of cpu0, for turning CPU time into cycles."""
+    for path in ("/sys/devices/system/cpu/cpu0/cpufreq/base_frequency",
+                 "/sys/devices/system/cpu/cpu0/cpufreq/cpuinfo_max_freq"):
+        try:
+            with open(path) as f:
+                return int(f.read()) * 1000
+        except (OSError, ValueError):
+            pass
+    with open("/proc/cpuinfo") as f:
+        for line in f:
+            if line.startswith("cpu MHz"):
+                return float(line.split(":")[1]) * 1e6
+    return 0
+
+
+def count_frames(path):
+    """Complete records in a pcap that may still be being written."""
+    try:
+        with open(path, "rb") as f:
+            data = f.read()
+    except OSError:
+        return 0
+    n, off = 0, 24
+    while off + 16 <= len(data):
+        caplen, = struct.unpack_from("<I", data, off + 8)
+        if off + 16 + caplen > len(data):
+            break
+        n += 1
+        off += 16 + caplen
+    return n
+
+
+def measure_latency(binary, extra, framing, texts, args):
+    """Round trips in µs, one request in flight, and the requests lost."""
+    server = pcap_replay.Server([binary] + eal_args(args, f"net_tap0,iface={TAP_IFACE}") + ["--"] + extra,
+                                cwd=DPDK_DIR)
+    deadline = time.time() + 30
+    while not os.path.exists(f"/sys/class/net/{TAP_IFACE}"):
+        if time.time() > deadline or not server.running():
+            server.stop()
+            return [], len(texts)
+        time.sleep(0.1)
+    # Keep the kernel's own IPv6 chatter off the port.
+    try:
+        with open(f"/proc/sys/net/ipv6/conf/{TAP_IFACE}/disable_ipv6", "w") as f:
+            f.write("1")
+    except OSError:
+        pass
+    subprocess.run(["ip", "link", "set", "dev", TAP_IFACE, "up"], check=False)
+
+    sock = socket.socket(socket.AF_PACKET, socket.SOCK_RAW, socket.htons(ETH_TYPE))
+    sock.bind((TAP_IFACE, 0))
+
+    def round_trip(frame, timeout):
+        start = time.perf_counter_ns()
+        sock.send(frame)
+        end = time.monotonic() + timeout
+        while time.monotonic() < end:
+            sock.settimeout(max(end - time.monotonic(), 0.001))
+            try:
+                _, addr = sock.recvfrom(65535)
+            except socket.timeout:
+                break
+            if addr[2] != PACKET_OUTGOING:
+                return (time.perf_counter_ns() - start) / 1000
+        return None
+
+    frames = [build_frame(framing, t) for t in texts]
+    # The server is ready once it answers; loading data.json takes a moment.
+    while round_trip(frames[0], 0.5) is None:
+        if time.time() > deadline or not server.running():
+            sock.close()
+            server.stop()
+            return [], len(texts)
+    rtts, lost = [], 0
+    for i in range(args.latency_requests):
+        rtt = round_trip(frames[i % len(frames)], 1.0)
+        if rtt is None:
+            lost += 1
+        else:
+            rtts.append(rtt)
+    sock.close()
+    server.stop()
+    return rtts, lost
+
+
+def measure_throughput(binary, extra, framing, texts, args, workdir):
+    """Responses per second and CPU cycles per response at full rate."""
+    requests = os.path.join(workdir, "requests.pcap")
+    pcap_replay.write_pcap(requests, [build_frame(framing, t) for t in texts])
+    # A queue per lcore: tokenizer_6 and dpdk/tokenizer use that many, the others the first.
+    outs = [os.path.join(workdir, f"responses.{q}.pcap") for q in range(args.nb_lcores)]
+    for out in outs:
+        if os.path.exists(out):
+            os.remove(out)
+    vdev = ",".join(["net_pcap0"] + [f"rx_pcap={requests}"] * args.nb_lcores + [f"tx_pcap={o}" for o in outs] +
+                    ["infinite_rx=1"])
+    server = pcap_replay.Server([binary] + eal_args(args, vdev) + ["--"] + extra, cwd=DPDK_DIR)
+
+    # Measure from the first response, past startup and vocabulary loading.
+    deadline = time.time() + 30
+    while sum(count_frames(o) for o in outs) == 0:
+        if time.time() > deadline or not server.running():
+            server.stop()
+            return 0.0, None
+        time.sleep(0.1)
+    t0, n0, cpu0 = time.monotonic(), sum(count_frames(o) for o in outs), server.cpu_seconds()
+    time.sleep(args.duration)
+    t1, n1, cpu1 = time.monotonic(), sum(count_frames(o) for o in outs), server.cpu_seconds()
+    server.stop()
+    responses = n1 - n0
+    if not responses:
+        return 0.0, None
+    return responses / (t1 - t0), (cpu1 - cpu0) * cpu_hz() / responses
+
+
+def percentile(sorted_values, p):
+    if not sorted_values:
+        return float("nan")
+    return sorted_values[min(len(sorted_values) - 1, int(len(sorted_values) * p / 100))]
+
+
+def git_commit():
+    ret = subprocess.run(["git", "-C", ROOT, "rev-parse", "--short", "HEAD"], capture_output=True, text=True)
+    return ret.stdout.strip() or "unknown"
+
+
+def main():
+    p = argparse.ArgumentParser(description="Build every tokenizer server and compare them on virtual ports")
+    p.add_argument("variants", nargs="*", help="variants to run (default all)")
+    p.add_argument("-l", "--lcores", default="0", help="EAL lcore list (default 0)")
+    p.add_argument("-b", "--batch-size", type=int, default=8, help="words per request (default 8)")
+    p.add_argument("-n", "--requests", type=int, default=256, help="distinct requests (default 256)")
+    p.add_argument("--latency-requests", type=int, default=2000, help="round trips timed (default 2000)")
+    p.add_argument("-d", "--duration", type=float, default=5, help="seconds of full-rate traffic (default 5)")
+    p.add_argument("--seed", type=int, default=1, help="seed for the request words (default 1)")
+    p.add_argument("--build-dir", default=os.path.join(HERE, "build"), help="where binaries go")
+    p.add_argument("--huge", action="store_true", help="use hugepages (default --no-huge)")
+    p.add_argument("--csv", default=CSV_FILE, help="CSV file the results are appended to")
+    args = p.parse_args()
+    args.nb_lcores = 0
+    for part in args.lcores.split(","):
+        lo, _, hi = part.partition("-")
+        args.nb_lcores += int(hi or lo) - int(lo) + 1
+
+    variants = [v for v in VARIANTS if not args.variants or v[0] in args.variants]
+    if not variants:
+        sys.exit(f"Unknown variants; choose from {', '.join(v[0] for v in VARIANTS)}")
+    os.makedirs(args.build_dir, exist_ok=True)
+    texts = random_texts(args.requests, args.batch_size, args.seed)
+    date, commit = datetime.datetime.now().isoformat(timespec="seconds"), git_commit()
+
+    print(f"{'variant':<12} {'req/s':>12} {'p50 us':>9} {'p99 us':>9} {'p999 us':>9} {'cycles/req':>11} {'lost':>5}")
+    for name, sources, framing, extra in variants:
+        binary = build(name, sources, args.build_dir)
+        if not binary:
+            print(f"{name:<12} build failed")
+            continue
+        rtts, lost = measure_latency(binary, extra, framing, texts, args)
+        with tempfile.TemporaryDirectory(prefix="nettok_matrix_") as workdir:
+            rate, cycles = measure_throughput(binary, extra, framing, texts, args, workdir)
+        rtts.sort()
+        row = {"date": date, "commit": commit, "variant": name, "lcores": args.lcores, "batch_size": args.batch_size,
+               "requests_per_s": round(rate), "p50_us": round(percentile(rtts, 50), 1),
+               "p99_us": round(percentile(rtts, 99), 1), "p999_us": round(percentile(rtts, 99.9), 1),
+               "cycles_per_request": round(cycles) if cycles else "", "lost": lost}
+        print(f"{name:<12} {rate:>12,.0f} {row['p50_us']:>9} {row['p99_us']:>9} {row['p999_us']:>9} "
+              f"{row['cycles_per_request']:>11} {lost:>5}")
+        pcap_replay.append_csv_row(args.csv, row)
+
+
+if __name__ == "__main__":
+    main()
@@ -121,8 +121,11 @@ int lcore_main(void *arg) {
             tx_bufs[tx_count++] = resp;
             rte_pktmbuf_free(m);
         }
-        if (tx_count)
-            rte_eth_tx_burst(port_id, qid, tx_bufs, tx_count);
+        if (tx_count) {
+            uint16_t nb_tx = rte_eth_tx_burst(port_id, qid, tx_bufs, tx_count);
+            // Whatever the TX ring had no room for would leak from the pool.
+            if (nb_tx < tx_count) rte_pktmbuf_free_bulk(&tx_bufs[nb_tx], tx_count - nb_tx);
+        }
     }
     return 0;
 }
@@ -138,37 +141,27 @@ int main(int argc, char **argv) {
     port_id = 0; // pick first
     printf("Detected %u DPDK ports\n", nb_ports);
 
-     else {
-            printf("Warning: Failed to get info for port %u
-", i);
-        }
-    } else {
-            printf("Warning: Failed to get info for port %u
-", i);
-        }
-    } else {
-            printf("Warning: Failed to get info for port %u
-", i);
-        }
-    } else {
-            printf("Warning: Failed to get info for port %u
-", i);
+    for (uint16_t i = 0; i < nb_ports; i++) {
+        struct rte_eth_dev_info dev_info;
+        if (rte_eth_dev_info_get(i, &dev_info) == 0) {
+            printf("Port %u: driver %s, %u RX / %u TX queues\n", i, dev_info.driver_name,
+                   dev_info.max_rx_queues, dev_info.max_tx_queues);
+        } else {
+            printf("Warning: Failed to get info for port %u\n", i);
         }
     }
 
     mbuf_pool = rte_pktmbuf_pool_create("MBUF_POOL", NUM_MBUFS, MBUF_CACHE_SIZE, 0, MBUF_SIZE, rte_socket_id());
 
     unsigned nb_queues = rte_lcore_count();
-    struct rte_eth_conf port_conf = {
-        .rxmode = {
-            .mq_mode = RTE_ETH_MQ_RX_RSS
-        },
-        .rx_adv_conf = {
-            .rss_conf = {
-                .rss_hf = RTE_ETH_RSS_UDP
-            }
-        }
-    };
+    struct rte_eth_dev_info port_info;
+    rte_eth_dev_info_get(port_id, &port_info);
+    struct rte_eth_conf port_conf = {0};
+    // Virtual ports (net_tap, net_pcap) hash fewer flow types or none.
+    if (nb_queues > 1) {
+        port_conf.rxmode.mq_mode = RTE_ETH_MQ_RX_RSS;
+        port_conf.rx_adv_conf.rss_conf.rss_hf = RTE_ETH_RSS_UDP & port_info.flow_type_rss_offloads;
+    }
     rte_eth_dev_configure(port_id, nb_queues, nb_queues, &port_conf);
 
     for (unsigned q = 0; q < nb_queues; q++) {
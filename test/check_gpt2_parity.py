@@ -0,0 +1,110 @@
+#!/usr/bin/env python3
+"""Checks the gpt2 engine of dpdk/bpe.c against known GPT-2 encodings.
+
+Builds a small C program around bpe_create_from_json() and bpe_encode(),
+loads vocab/gpt2_vocab.json with vocab/gpt2_merges.txt, and compares its ids
+with those HuggingFace GPT2Tokenizer and tiktoken's gpt2 encoding give for
+the texts below (the strings of tiktoken's own GPT-2 tests among them). The
+runs of zeros go through a dozen merges each, so a merge table out of order
+shows up there first.
+
+    python3 check_gpt2_parity.py [--derived]
+
+--derived leaves out the merges file, to see which cases the vocabulary-only
+merge table gets wrong. Needs gcc and pkg-config with libdpdk and libcjson;
+EAL runs without hugepages or devices.
+"""
+import json
+import os
+import subprocess
+import sys
+import tempfile
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+DPDK_DIR = os.path.join(ROOT, "dpdk")
+VOCAB_DIR = os.path.join(ROOT, "vocab")
+
+CASES = [
+    ("hello world", [31373, 995]),
+    ("Hello world", [15496, 995]),
+    (" Hello world", [18435, 995]),
+    ("Hello, world!", [15496, 11, 995, 0]),
+    ("I don't", [40, 836, 470]),
+    ("0", [15]),
+    ("00", [405]),
+    ("000", [830]),
+    ("0000", [2388]),
+    ("00000", [20483]),
+    ("000000", [10535]),
+    ("0000000", [24598]),
+    ("00000000", [8269]),
+    ("000000000", [10535, 830]),
+    ("0000000000", [8269, 405]),
+    ("00000000000", [8269, 830]),
+    ("000000000000", [8269, 2388]),
+    ("0000000000000", [8269, 20483]),
+    ("00000000000000", [8269, 10535]),
+    ("000000000000000", [8269, 24598]),
+    ("0000000000000000", [25645]),
+    ("00000000000000000", [8269, 10535, 830]),
+]
+
+PROGRAM = r"""
+#include <stdio.h>
+#include <string.h>
+#include <rte_eal.h>
+#include "bpe.h"
+
+// argv: vocab, merges or "-", then one text per line on stdin; prints the
+// ids of each line.
+int main(int argc, char **argv) {
+    char *eal[] = { argv[0], "--no-huge", "--no-pci", "--in-memory", "-l", "0", "--log-level", "1" };
+    if (argc < 3 || rte_eal_init(RTE_DIM(eal), eal) < 0) return 2;
+    struct bpe *bpe = bpe_create_from_json(argv[1], strcmp(argv[2], "-") ? argv[2] : NULL, BPE_PRETOK_GPT2);
+    if (!bpe) return 2;
+    printf("ready\n");
+    static char line[4096];
+    static int ids[4096];
+    while (fgets(line, sizeof(line), stdin)) {
+        size_t len = strcspn(line, "\n");
+        int n = bpe_encode(bpe, line, len, ids, RTE_DIM(ids));
+        for (int i = 0; i < n; i++) printf(i ? " %d" : "%d", ids[i]);
+        printf("\n");
+    }
+    bpe_free(bpe);
+    rte_eal_cleanup();
+    return 0;
+}
+"""
+
+
+def run_encoder(merges):
+    with tempfile.TemporaryDirectory() as tmp:
+        src = os.path.join(tmp, "parity.c")
+        exe = os.path.join(tmp, "parity")
+        with open(src, "w") as f:
+            f.write(PROGRAM)
+        flags = subprocess.run(["pkg-config", "--cflags", "--libs", "libdpdk", "libcjson"], check=True,
+                               capture_output=True, text=True).stdout.split()
+        sources = [os.path.join(DPDK_DIR, f) for f in ("bpe.c", "trie.c", "vocab.c", "wcache.c")]
+        subprocess.run(["gcc", "-O2", "-Wall", "-I", DPDK_DIR, "-o", exe, src, *sources, *flags], check=True)
+        text = "".join(t + "\n" for t, _ in CASES)
+        out = subprocess.run([exe, os.path.join(VOCAB_DIR, "gpt2_vocab.json"), merges], input=text.encode(),
+                             check=True, capture_output=True).stdout.decode()
+    lines = out.split("\n")
+    return [[int(v) for v in line.split()] for line in lines[lines.index("ready") + 1:][:len(CASES)]]
+
+
+def main():
+    merges = "-" if "--derived" in sys.argv[1:] else os.path.join(VOCAB_DIR, "gpt2_merges.txt")
+    wrong = 0
+    for (text, want), got in zip(CASES, run_encoder(merges)):
+        if got != want:
+            print(f"{json.dumps(text)}: got {got}, expected {want}")
+            wrong += 1
+    print(f"{wrong} of {len(CASES)} texts encoded differently from GPT-2")
+    return 1 if wrong else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,116 @@
+#!/usr/bin/env python3
+"""Checks the character classes of dpdk/utf8.h against Python's unicodedata.
+
+Builds a small C program around uc_classify(), uc_is_space(), uc_fold() and
+the control ranges, runs it over every code point, and compares each answer
+with the \\p{L} / \\p{N} / \\s split the GPT-2 and Llama-3 pre-tokenizers
+get from the Unicode database, and with the control test and lowercase +
+strip-accents normalization of HuggingFace's BERT BasicTokenizer.
+Surrogates are skipped; they never come out of utf8_decode() as text.
+
+    python3 check_unicode_tables.py
+
+Needs gcc, and a Python whose unicodedata has the Unicode version that
+vocab/gen_unicode_tables.py generated the tables from.
+"""
+import os
+import re
+import subprocess
+import sys
+import tempfile
+import unicodedata
+
+DPDK_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "dpdk")
+
+PROGRAM = r"""
+#include <stdio.h>
+#include "utf8.h"
+
+int main(void) {
+    static const char classes[] = "LNSO";
+    for (uint32_t cp = 0; cp < 0x110000; cp++) {
+        putchar(classes[uc_classify(cp)]);
+        putchar(uc_is_space(cp) ? 's' : '-');
+        putchar(UC_IN(uc_control_ranges, cp) ? 'c' : '-');
+    }
+    for (uint32_t cp = 0; cp < 0x110000; cp++) {
+        uint32_t out[3];
+        int n = uc_fold(cp, out);
+        if (n == 1 && out[0] == cp) continue;
+        printf("\n%X", cp);
+        for (int i = 0; i < n; i++) printf(" %X", out[i]);
+    }
+    return 0;
+}
+"""
+
+
+def expected_class(cp):
+    cat = unicodedata.category(chr(cp))
+    if cat.startswith("L"):
+        return "L"
+    if cat.startswith("N"):
+        return "N"
+    if is_space(cp):
+        return "S"
+    return "O"
+
+
+def is_space(cp):
+    return cp in (0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x85) or unicodedata.category(chr(cp)).startswith("Z")
+
+
+def is_control(cp):
+    # BasicTokenizer's _is_control
+    return cp not in (0x09, 0x0A, 0x0D) and unicodedata.category(chr(cp)).startswith("C")
+
+
+def expected_fold(cp):
+    # BasicTokenizer lowercases, then _run_strip_accents: NFD and drop Mn
+    s = unicodedata.normalize("NFD", chr(cp).lower())
+    return [ord(c) for c in s if unicodedata.category(c) != "Mn"]
+
+
+def run_classifier():
+    with tempfile.TemporaryDirectory() as tmp:
+        src = os.path.join(tmp, "classify.c")
+        exe = os.path.join(tmp, "classify")
+        with open(src, "w") as f:
+            f.write(PROGRAM)
+        subprocess.run(["gcc", "-O2", "-Wall", "-I", DPDK_DIR, "-o", exe, src], check=True)
+        return subprocess.run([exe], check=True, capture_output=True).stdout.decode()
+
+
+def main():
+    with open(os.path.join(DPDK_DIR, "unicode_tables.h")) as f:
+        version = re.search(r"Unicode ([\d.]+)", f.readline()).group(1)
+    if version != unicodedata.unidata_version:
+        print(f"Tables are Unicode {version}, this Python has {unicodedata.unidata_version}")
+        return 1
+    out = run_classifier()
+    classes, _, fold_lines = out.partition("\n")
+    folds = {}
+    for line in fold_lines.split("\n"):
+        cp, *rest = (int(v, 16) for v in line.split())
+        folds[cp] = rest
+    wrong = 0
+    for cp in range(0x110000):
+        if 0xD800 <= cp <= 0xDFFF:
+            continue
+        got_class, got_space, got_control = classes[3 * cp], classes[3 * cp + 1] == "s", classes[3 * cp + 2] == "c"
+        want_class = expected_class(cp)
+        got_fold, want_fold = folds.get(cp, [cp]), expected_fold(cp)
+        if (got_class != want_class or got_space != is_space(cp) or got_control != is_control(cp)
+                or got_fold != want_fold):
+            if wrong < 20:
+                print(f"U+{cp:04X} {unicodedata.category(chr(cp))}: uc_classify {got_class}, expected {want_class}; "
+                      f"uc_is_space {int(got_space)}, expected {int(is_space(cp))}; "
+                      f"control {int(got_control)}, expected {int(is_control(cp))}; "
+                      f"uc_fold {[hex(c) for c in got_fold]}, expected {[hex(c) for c in want_fold]}")
+            wrong += 1
+    print(f"{wrong} code points classified or folded differently from unicodedata {unicodedata.unidata_version}")
+    return 1 if wrong else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
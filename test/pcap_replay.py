@@ -0,0 +1,274 @@
+#!/usr/bin/env python3
+"""Replays a pcap through a DPDK tokenizer server on one box, with no NIC.
+
+The UDP payloads of the capture (Ethernet or raw IP, IPv4 or IPv6, any port)
+are rewritten as the servers' frames: EtherType 0x88B5 with UDP straight
+after it, to port 67. The server then runs on a net_pcap vdev that replays
+them at maximum rate (infinite_rx) and drops or records the responses, and
+is stopped with SIGINT after --duration seconds.
+
+    sudo ./pcap_replay.py llm_tokenizer_simulation.pcap -l 0-1 -- --mode gpt2 --vocab ../vocab/gpt2.vocab --quiet
+
+Any server variant runs this way. dpdk/tokenizer prints its totals on exit,
+from which Mpps, tokens/s and cycles per packet are taken; for variants that
+do not, pass --out to count the responses they sent instead.
+"""
+import argparse
+import collections
+import csv
+import glob
+import os
+import re
+import shutil
+import signal
+import struct
+import subprocess
+import sys
+import tempfile
+import threading
+import time
+
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "clients"))
+import nettok_proto
+
+ETH_TYPE       = 0x88B5
+DST_PORT       = 67
+SRC_MAC        = "08:c0:eb:a6:de:3c"
+DST_MAC        = "08:c0:eb:99:9c:70"
+SERVER         = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "dpdk", "tokenizer")
+
+LINKTYPE_ETHERNET = 1
+LINKTYPE_RAW      = (101, 228, 229)     # raw IP, raw IPv4, raw IPv6
+TOTALS = re.compile(r"Totals: (?P<seconds>[\d.]+) s on \d+ lcores, (?P<packets_in>\d+) packets in \(\d+ missed\), "
+                    r"(?P<packets_out>\d+) out, (?P<requests>\d+) requests, (?P<tokens>\d+) tokens, (?P<dropped>\d+) dropped")
+RATE = re.compile(r"Rate: (?P<mpps>[\d.]+) Mpps, (?P<mtokens_per_s>[\d.]+) Mtokens/s, (?P<cycles_per_packet>[\d.]+) cycles "
+                  r"per packet, (?P<busy_cycles_per_request>[\d.]+) busy")
+PCAP_MAGIC        = {b"\xd4\xc3\xb2\xa1": "<", b"\xa1\xb2\xc3\xd4": ">",
+                     b"\x4d\x3c\xb2\xa1": "<", b"\xa1\xb2\x3c\x4d": ">"}     # usec and nsec
+
+
+def mac_to_bytes(mac:str) -> bytes:
+    return bytes.fromhex(mac.replace(":", ""))
+
+
+def read_pcap(path):
+    """Returns (linktype, frames) of a classic pcap file."""
+    with open(path, "rb") as f:
+        data = f.read()
+    order = PCAP_MAGIC.get(data[:4])
+    if not order:
+        raise ValueError(f"{path}: not a pcap file")
+    linktype, = struct.unpack_from(order + "I", data, 20)
+    frames, off = [], 24
+    while off + 16 <= len(data):
+        caplen, = struct.unpack_from(order + "I", data, off + 8)
+        frames.append(data[off + 16:off + 16 + caplen])
+        off += 16 + caplen
+    return linktype, frames
+
+
+def write_pcap(path, frames):
+    with open(path, "wb") as f:
+        f.write(struct.pack("<IHHiIII", 0xA1B2C3D4, 2, 4, 0, 0, 65535, LINKTYPE_ETHERNET))
+        for frame in frames:
+            f.write(struct.pack("<IIII", 0, 0, len(frame), len(frame)) + frame)
+
+
+def ip_udp(packet):
+    """Returns (src_port, dst_port, payload) of a UDP over IP packet, else None."""
+    if not packet:
+        return None
+    if packet[0] >> 4 == 4:
+        ihl = (packet[0] & 0xF) * 4
+        if packet[9] != 17:
+            return None
+        udp = packet[ihl:]
+    elif packet[0] >> 4 == 6:
+        if packet[6] != 17:
+            return None
+        udp = packet[40:]
+    else:
+        return None
+    if len(udp) < 8:
+        return None
+    sport, dport, length = struct.unpack_from("!HHH", udp)
+    return sport, dport, udp[8:length]
+
+
+def udp_payload(linktype, frame):
+    """Returns (src_mac, dst_mac, src_port, dst_port, payload), or None for
+    frames that carry no UDP."""
+    if linktype in LINKTYPE_RAW:
+        udp = ip_udp(frame)
+        return udp and (mac_to_bytes(SRC_MAC), mac_to_bytes(DST_MAC)) + udp
+    if linktype != LINKTYPE_ETHERNET or len(frame) < 14:
+        return None
+    dst, src = frame[0:6], frame[6:12]
+    eth_type, off = struct.unpack_from("!H", frame, 12)[0], 14
+    while eth_type in (0x8100, 0x88A8) and len(frame) >= off + 4:
+        eth_type, off = struct.unpack_from("!H", frame, off + 2)[0], off + 4
+    if eth_type == ETH_TYPE:
+        sport, dport, length = struct.unpack_from("!HHH", frame, off)
+        return src, dst, sport, dport, frame[off + 8:off + length]
+    if eth_type in (0x0800, 0x86DD):
+        udp = ip_udp(frame[off:])
+        return udp and (src, dst) + udp
+    return None
+
+
+def convert(pcap, out, port, from_port=None):
+    """Writes the UDP payloads of pcap to out as requests to port; returns
+    how many were written."""
+    linktype, frames = read_pcap(pcap)
+    requests = []
+    for frame in frames:
+        parsed = udp_payload(linktype, frame)
+        if not parsed:
+            continue
+        src, dst, sport, dport, payload = parsed
+        if from_port is not None and dport != from_port:
+            continue
+        udp = struct.pack("!HHHH", sport, port, 8 + len(payload), 0) + payload
+        requests.append(dst + src + struct.pack("!H", ETH_TYPE) + udp)
+    write_pcap(out, requests)
+    return len(requests)
+
+
+def count_responses(paths):
+    """Returns (frames, ids) in the response pcaps."""
+    nb_frames = nb_ids = 0
+    for path in paths:
+        _, frames = read_pcap(path)
+        for frame in frames:
+            try:
+                ids, _, _ = nettok_proto.parse_part(frame[22:])
+            except ValueError:      # older variants answer in other text formats
+                ids = frame[22:].split()
+            nb_frames += 1
+            nb_ids += len(ids)
+    return nb_frames, nb_ids
+
+
+def parse_totals(lines):
+    """Picks the numbers out of dpdk/tokenizer's Totals and Rate lines."""
+    result = {}
+    for line in lines:
+        m = TOTALS.match(line)
+        if m:
+            result.update({k: float(v) if k == "seconds" else int(v) for k, v in m.groupdict().items()})
+        m = RATE.match(line)
+        if m:
+            result.update({k: float(v) for k, v in m.groupdict().items()})
+            result["tokens_per_s"] = result.pop("mtokens_per_s") * 1e6
+    return result
+
+
+class Server:
+    """A server process whose output is drained in the background. Only the
+    tail is kept: variants that log every request print millions of lines."""
+
+    def __init__(self, cmd, cwd=None):
+        self.tail = collections.deque(maxlen=200)
+        self.proc = subprocess.Popen(cmd, cwd=cwd, stdout=subprocess.PIPE, stderr=subprocess.STDOUT, text=True,
+                                     errors="replace")
+        self.reader = threading.Thread(target=lambda: self.tail.extend(l.rstrip("\n") for l in self.proc.stdout))
+        self.reader.start()
+
+    def running(self):
+        return self.proc.poll() is None
+
+    def cpu_seconds(self):
+        """User and system time of all its threads so far."""
+        with open(f"/proc/{self.proc.pid}/stat") as f:
+            fields = f.read().rsplit(")", 1)[1].split()
+        return (int(fields[11]) + int(fields[12])) / os.sysconf("SC_CLK_TCK")
+
+    def stop(self):
+        """Stops it with SIGINT, or kills it after 30 s; returns the tail of its output."""
+        self.proc.send_signal(signal.SIGINT)
+        try:
+            self.proc.wait(timeout=30)
+        except subprocess.TimeoutExpired:
+            self.proc.kill()
+            self.proc.wait()
+        self.reader.join()
+        return list(self.tail)
+
+
+def append_csv_row(path, row):
+    file_exists = os.path.isfile(path)
+    with open(path, mode="a", newline="") as f:
+        writer = csv.DictWriter(f, fieldnames=list(row.keys()))
+        if not file_exists:
+            writer.writeheader()
+        writer.writerow(row)
+
+
+def main():
+    p = argparse.ArgumentParser(description="Replay a pcap through a tokenizer server on a net_pcap vdev",
+                                epilog="Arguments after -- go to the server.")
+    p.add_argument("pcap", help="capture whose UDP payloads are the requests")
+    p.add_argument("-s", "--server", default=SERVER, help="server binary (default dpdk/tokenizer)")
+    p.add_argument("-l", "--lcores", default="0", help="EAL lcore list (default 0)")
+    p.add_argument("-q", "--queues", type=int, default=0,
+                   help="RX queues, each replaying the whole capture (default: one per lcore)")
+    p.add_argument("-d", "--duration", type=float, default=10, help="seconds to replay (default 10)")
+    p.add_argument("-p", "--port", type=int, default=DST_PORT, help="UDP port the requests go to (default 67)")
+    p.add_argument("--from-port", type=int, help="only replay UDP payloads sent to this port in the capture")
+    p.add_argument("-o", "--out", help="record responses to OUT.<queue>.pcap instead of dropping them")
+    p.add_argument("--huge", action="store_true", help="use hugepages (default --no-huge)")
+    p.add_argument("--csv", help="append the results to this CSV file")
+    argv = sys.argv[1:]
+    split = argv.index("--") if "--" in argv else len(argv)
+    args = p.parse_args(argv[:split])
+    args.server_args = argv[split + 1:]
+
+    nb_lcores = 0
+    for part in args.lcores.split(","):
+        lo, _, hi = part.partition("-")
+        nb_lcores += int(hi or lo) - int(lo) + 1
+    queues = args.queues or nb_lcores
+
+    workdir = tempfile.mkdtemp(prefix="nettok_replay_")
+    requests = os.path.join(workdir, "requests.pcap")
+    n = convert(args.pcap, requests, args.port, args.from_port)
+    if not n:
+        sys.exit(f"No UDP payloads in {args.pcap}")
+    print(f"Replaying {n} requests from {args.pcap} on {queues} queues for {args.duration:g} s")
+
+    vdev = ["net_pcap0"] + [f"rx_pcap={requests}"] * queues + ["infinite_rx=1"]
+    if args.out:
+        for old in glob.glob(f"{args.out}.*.pcap"):
+            os.remove(old)
+        vdev += [f"tx_pcap={args.out}.{q}.pcap" for q in range(queues)]
+    cmd = [args.server, "-l", args.lcores, "--no-pci", "--vdev", ",".join(vdev), "--file-prefix", "nettok_replay"]
+    if not args.huge:
+        cmd += ["--no-huge", "-m", "2048"]
+    cmd += ["--"] + args.server_args
+
+    server = Server(cmd)
+    time.sleep(args.duration)
+    tail = server.stop()
+    shutil.rmtree(workdir, ignore_errors=True)
+
+    result = parse_totals(tail)
+    if not result and args.out:
+        # The capture started when the server did, so this includes its startup.
+        frames, ids = count_responses(sorted(glob.glob(f"{args.out}.*.pcap")))
+        result = {"seconds": args.duration, "packets_out": frames, "tokens": ids,
+                  "mpps": frames / args.duration / 1e6, "tokens_per_s": ids / args.duration}
+    if not result:
+        print("\n".join(list(tail)[-20:]))
+        sys.exit("The server printed no totals; pass --out to count its responses")
+
+    print(f"{result['mpps']:.3f} Mpps, {result['tokens_per_s']:,.0f} tokens/s", end="")
+    if "cycles_per_packet" in result:
+        print(f", {result['cycles_per_packet']:.0f} cycles per packet", end="")
+    print()
+    if args.csv:
+        append_csv_row(args.csv, {"server": os.path.basename(args.server), "pcap": os.path.basename(args.pcap),
+                                  "lcores": args.lcores, "args": " ".join(args.server_args), **result})
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,292 @@
+"""Compile a vocabulary into the binary image loaded by the DPDK tokenizer.
+
+The image holds the double-array trie and, for byte-level BPE vocabularies,
+the byte table and an open-addressing merge table, laid out exactly as the
+server uses them (see dpdk/vocab.h). Loading is a single read.
+
+    python compile_vocab.py gpt2 gpt2_vocab.json gpt2.vocab --merges gpt2_merges.txt
+    python compile_vocab.py llama3 llama3_vocab.json llama3.vocab
+    python compile_vocab.py wordpiece bert_vocab.txt bert.vocab
+    python compile_vocab.py char ../dpdk/data.json data.vocab
+"""
+import argparse
+import json
+import struct
+import zlib
+
+MAGIC = b"NTKVOCAB"
+VERSION = 1
+ALIGN = 64
+FLAG_BYTE_LEVEL = 0x1
+HEADER = struct.Struct("<8sIIQIIIIQIIQII256i")
+MERGE_EMPTY = (1 << 64) - 1
+MAX_FAILS = 16
+NONE = -1
+
+
+def byte_decoder():
+    """GPT-2 printable code point -> raw byte."""
+    keep = list(range(ord("!"), ord("~") + 1)) + list(range(0xA1, 0xAD)) + list(range(0xAE, 0x100))
+    table = {b: b for b in keep}
+    n = 0
+    for b in range(256):
+        if b not in table:
+            table[256 + n] = b
+            n += 1
+    return {chr(cp): b for cp, b in table.items()}
+
+
+def decode_token(dec, key):
+    try:
+        return bytes(dec[c] for c in key)
+    except KeyError:
+        return None
+
+
+class Builder:
+    """Double-array builder matching dpdk/trie.c: the child of node s on byte c
+    sits at base[s] + c + 1 and is valid when check equals s."""
+
+    def __init__(self):
+        self.base, self.check, self.ids = [], [], []
+        self.next, self.prev, self.fails = [], [], []
+        self.head = self.tail = NONE
+        self.end = 0
+
+    def reserve(self, need):
+        cap = len(self.base)
+        if need <= cap:
+            return
+        new = max(cap, 1024)
+        while new < need:
+            new *= 2
+        for i in range(cap, new):
+            self.base.append(0)
+            self.check.append(-1)
+            self.ids.append(-1)
+            self.fails.append(0)
+            self.next.append(NONE)
+            self.prev.append(self.tail)
+            if self.tail != NONE:
+                self.next[self.tail] = i
+            else:
+                self.head = i
+            self.tail = i
+
+    def unlink(self, i):
+        p, n = self.prev[i], self.next[i]
+        if p != NONE:
+            self.next[p] = n
+        else:
+            self.head = n
+        if n != NONE:
+            self.prev[n] = p
+        else:
+            self.tail = p
+
+    def use(self, i, parent):
+        self.check[i] = parent
+        self.end = max(self.end, i + 1)
+        if self.fails[i] <= MAX_FAILS:
+            self.unlink(i)
+
+    def find_base(self, labels):
+        f = self.head
+        while True:
+            if f == NONE:
+                old = len(self.base)
+                self.reserve(old * 2)
+                f = old
+            if f > labels[0]:
+                base = f - labels[0]
+                self.reserve(base + 257)
+                check = self.check
+                if all(check[base + l] < 0 for l in labels[1:]):
+                    return base
+                self.fails[f] += 1
+                if self.fails[f] > MAX_FAILS:
+                    self.unlink(f)
+            f = self.next[f]
+
+
+def build_trie(tokens):
+    """tokens: list of (bytes, id). Returns (node bytes, size, nb_keys, max_len)."""
+    toks = sorted(tokens)
+    b = Builder()
+    b.reserve(1024)
+    b.use(0, 0)
+    nb_keys = 0
+    queue = [(0, 0, len(toks), 0)]
+    head = 0
+    while head < len(queue):
+        node, lo, hi, depth = queue[head]
+        head += 1
+        while lo < hi and len(toks[lo][0]) == depth:
+            b.ids[node] = toks[lo][1]
+            nb_keys += 1
+            lo += 1
+        if lo == hi:
+            continue
+        labels, starts = [], []
+        for k in range(lo, hi):
+            label = toks[k][0][depth] + 1
+            if not labels or labels[-1] != label:
+                labels.append(label)
+                starts.append(k)
+        starts.append(hi)
+        base = b.find_base(labels)
+        b.base[node] = base
+        for k, label in enumerate(labels):
+            child = base + label
+            b.use(child, node)
+            queue.append((child, starts[k], starts[k + 1], depth + 1))
+    size = b.end + 257
+    b.reserve(size)
+    nodes = bytearray(size * 12)
+    for i in range(size):
+        struct.pack_into("<iii", nodes, i * 12, b.base[i], b.check[i], b.ids[i])
+    max_len = max((len(t) for t, _ in toks), default=0)
+    return bytes(nodes), size, nb_keys, max_len
+
+
+def merge_slot(key):
+    return ((key * 0x9E3779B97F4A7C15) & MERGE_EMPTY) >> 32
+
+
+def build_merges(pairs):
+    """pairs: list of (key, val) in rank order. Mirrors bpe_create_from_json."""
+    slots = 64
+    while slots < 2 * len(pairs):
+        slots *= 2
+    mask = slots - 1
+    keys = [MERGE_EMPTY] * slots
+    vals = [MERGE_EMPTY] * slots
+    for key, val in pairs:
+        k = merge_slot(key) & mask
+        while keys[k] != MERGE_EMPTY and keys[k] != key:
+            k = (k + 1) & mask
+        if keys[k] == MERGE_EMPTY:
+            keys[k], vals[k] = key, val
+    table = bytearray(slots * 16)
+    for i in range(slots):
+        struct.pack_into("<QQ", table, i * 16, keys[i], vals[i])
+    return bytes(table), slots
+
+
+def load_byte_level(vocab_file, merges_file):
+    dec = byte_decoder()
+    with open(vocab_file, encoding="utf-8") as f:
+        vocab = json.load(f)
+    tokens, byte_ids = [], [-1] * 256
+    for key, tid in vocab.items():
+        t = decode_token(dec, key)
+        if not t:
+            print(f"Warning: Skipping token {key!r} outside the byte alphabet")
+            continue
+        tokens.append((t, tid))
+        if len(t) == 1:
+            byte_ids[t[0]] = tid
+    missing = [b for b in range(256) if byte_ids[b] < 0]
+    if missing:
+        raise SystemExit(f"Error: Vocabulary has no token for byte 0x{missing[0]:02x}")
+    find = {t: tid for t, tid in tokens}
+
+    pairs = []
+    if merges_file:
+        rank = 0
+        with open(merges_file, encoding="utf-8") as f:
+            for line in f.read().splitlines():
+                if not line or line.startswith("#version") or " " not in line:
+                    continue
+                left, right = line.split(" ", 1)
+                l, r = decode_token(dec, left), decode_token(dec, right)
+                if l and r:
+                    a, b, m = find.get(l), find.get(r), find.get(l + r)
+                    if a is not None and b is not None and m is not None:
+                        pairs.append((a << 32 | b, rank << 32 | m))
+                rank += 1
+    else:
+        # Every split of a token into two entries is a merge ranked by the
+        # merged token's id (tiktoken semantics). Exact for Llama-3; GPT-2
+        # needs its merges.txt for parity.
+        for t, tid in tokens:
+            for k in range(1, len(t)):
+                a = find.get(t[:k])
+                if a is None:
+                    continue
+                b = find.get(t[k:])
+                if b is None:
+                    continue
+                pairs.append((a << 32 | b, tid << 32 | tid))
+    return tokens, byte_ids, pairs
+
+
+def load_wordpiece(vocab_file):
+    with open(vocab_file, "rb") as f:
+        lines = f.read().split(b"\n")
+    if lines and lines[-1] == b"":
+        lines.pop()
+    tokens = []
+    for tid, line in enumerate(lines):
+        line = line.rstrip(b"\r")
+        if line:
+            tokens.append((line, tid))
+    return tokens
+
+
+def load_char(vocab_file):
+    with open(vocab_file, encoding="utf-8") as f:
+        vocab = json.load(f)
+    return [(k.encode("utf-8"), v) for k, v in vocab.items() if k]
+
+
+def align(n):
+    return (n + ALIGN - 1) // ALIGN * ALIGN
+
+
+def write_image(path, tokens, byte_ids=None, pairs=None):
+    nodes, trie_size, nb_keys, max_len = build_trie(tokens)
+    flags = 0
+    merges, slots = b"", 0
+    if pairs is not None:
+        flags |= FLAG_BYTE_LEVEL
+        merges, slots = build_merges(pairs)
+    vocab_size = max((tid for _, tid in tokens), default=-1) + 1
+
+    trie_off = align(HEADER.size)
+    merge_off = align(trie_off + len(nodes)) if slots else 0
+    size = (merge_off + len(merges)) if slots else trie_off + len(nodes)
+
+    image = bytearray(size)
+    image[trie_off:trie_off + len(nodes)] = nodes
+    if slots:
+        image[merge_off:merge_off + len(merges)] = merges
+    fields = [MAGIC, VERSION, 0, size, flags, vocab_size, nb_keys, max_len,
+              trie_off, trie_size, len(pairs or []), merge_off, slots, 0]
+    HEADER.pack_into(image, 0, *fields, *(byte_ids or [-1] * 256))
+    struct.pack_into("<I", image, 12, zlib.crc32(image[16:]))
+    with open(path, "wb") as f:
+        f.write(image)
+    print(f"Wrote {path}: {nb_keys} tokens, {trie_size} trie nodes, "
+          f"{len(pairs or [])} merges in {slots} slots, {size} bytes")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("mode", choices=["gpt2", "llama3", "wordpiece", "char"])
+    parser.add_argument("vocab")
+    parser.add_argument("output")
+    parser.add_argument("--merges", help="HuggingFace merges.txt (gpt2/llama3 only)")
+    args = parser.parse_args()
+
+    if args.mode in ("gpt2", "llama3"):
+        tokens, byte_ids, pairs = load_byte_level(args.vocab, args.merges)
+        write_image(args.output, tokens, byte_ids, pairs)
+    elif args.mode == "wordpiece":
+        write_image(args.output, load_wordpiece(args.vocab))
+    else:
+        write_image(args.output, load_char(args.vocab))
+
+
+if __name__ == "__main__":
+    main()
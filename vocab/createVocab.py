@@ -1,4 +1,4 @@
-from transformers import GPT2Tokenizer
+from transformers import AutoTokenizer, BertTokenizer, GPT2Tokenizer
 import json
 
 # Load GPT-2 tokenizer
@@ -11,6 +11,27 @@ vocab = tokenizer.get_vocab()
 with open("gpt2_vocab.json", "w") as f:
     json.dump(vocab, f, indent=2)
 
+# Save merges in HuggingFace merges.txt order for the DPDK BPE engine
+merges = sorted(tokenizer.bpe_ranks.items(), key=lambda kv: kv[1])
+with open("gpt2_merges.txt", "w", encoding="utf-8") as f:
+    f.write("#version: 0.2\n")
+    for (left, right), _ in merges:
+        f.write(f"{left} {right}\n")
+
+# Replace the committed llama3_vocab.json (tiktoken cl100k_base, no BOS) with
+# the full Llama-3 vocabulary and its special tokens; the DPDK llama3 mode
+# reads the id of <|begin_of_text|> from it. The repository is gated.
+llama3 = AutoTokenizer.from_pretrained("meta-llama/Llama-3.2-1B")
+with open("llama3_vocab.json", "w", encoding="utf-8") as f:
+    json.dump(llama3.get_vocab(), f, indent=2)
+
+# Save the uncased BERT WordPiece vocabulary (bert-tiny, ms-marco-MiniLM and
+# paraphrase-MiniLM all share it) for the DPDK wordpiece mode
+bert = BertTokenizer.from_pretrained("prajjwal1/bert-tiny")
+with open("bert_vocab.txt", "w", encoding="utf-8") as f:
+    for token, _ in sorted(bert.vocab.items(), key=lambda kv: kv[1]):
+        f.write(token + "\n")
+
 # Print sample of the vocabulary
 print(json.dumps(dict(list(vocab.items())[:10]), indent=2))  # Print first 10 entries
 
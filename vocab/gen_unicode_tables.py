@@ -0,0 +1,103 @@
+import unicodedata
+
+# Generates dpdk/unicode_tables.h: the \p{L} / \p{N} / \s classes of the
+# GPT-2 and Llama-3 pre-tokenizer regexes, and for the WordPiece (BERT)
+# normalizer punctuation and control ranges plus the lowercase +
+# strip-accents fold of every code point.
+
+# The fold is a two-level table: uc_fold_index maps each block of
+# FOLD_BLOCK code points to its row of uc_fold_blocks, or to 0 when no code
+# point in it changes. Hangul syllables are decomposed in code instead.
+FOLD_SHIFT = 7
+FOLD_BLOCK = 1 << FOLD_SHIFT
+FOLD_MULTI = 0x80000000
+HANGUL = range(0xAC00, 0xD7A4)
+
+
+def ranges(pred, lo=0x80, hi=0x110000):
+    out, start = [], None
+    for cp in range(lo, hi):
+        if pred(cp):
+            if start is None:
+                start = cp
+        elif start is not None:
+            out.append((start, cp - 1))
+            start = None
+    if start is not None:
+        out.append((start, hi - 1))
+    return out
+
+
+def fold(cp):
+    if 0xD800 <= cp <= 0xDFFF or cp in HANGUL:
+        return [cp]
+    s = unicodedata.normalize("NFD", chr(cp).lower())
+    return [ord(c) for c in s if unicodedata.category(c) != "Mn"]
+
+
+def category(cp):
+    return unicodedata.category(chr(cp))
+
+
+def emit_ranges(f, name, rs):
+    f.write(f"static const uint32_t {name}[][2] __attribute__((unused)) = {{\n")
+    for i in range(0, len(rs), 4):
+        f.write("    " + " ".join(f"{{0x{a:05X}, 0x{b:05X}}}," for a, b in rs[i:i + 4]) + "\n")
+    f.write("};\n\n")
+
+
+with open("../dpdk/unicode_tables.h", "w") as f:
+    f.write("// Generated by vocab/gen_unicode_tables.py (Unicode %s). Do not edit.\n" % unicodedata.unidata_version)
+    f.write("#ifndef UNICODE_TABLES_H\n#define UNICODE_TABLES_H\n\n#include <stdint.h>\n\n")
+    emit_ranges(f, "uc_letter_ranges", ranges(lambda c: category(c).startswith("L")))
+    emit_ranges(f, "uc_number_ranges", ranges(lambda c: category(c).startswith("N")))
+    # White_Space: the separators plus NEL; the ASCII ones are tested inline.
+    emit_ranges(f, "uc_space_ranges", ranges(lambda c: category(c).startswith("Z") or c == 0x85))
+    emit_ranges(f, "uc_punct_ranges", ranges(lambda c: category(c).startswith("P")))
+    # BERT's _is_control, which keeps tab, newline and carriage return.
+    emit_ranges(f, "uc_control_ranges",
+                ranges(lambda c: category(c).startswith("C") and c not in (0x09, 0x0A, 0x0D), lo=0))
+
+    folds = [fold(cp) for cp in range(0x110000)]
+    end = max(cp for cp in range(0x110000) if folds[cp] != [cp]) // FOLD_BLOCK * FOLD_BLOCK + FOLD_BLOCK
+    multi, index, blocks = [], [], []
+    for start in range(0, end, FOLD_BLOCK):
+        if all(folds[cp] == [cp] for cp in range(start, start + FOLD_BLOCK)):
+            index.append(0)
+            continue
+        row = []
+        for cp in range(start, start + FOLD_BLOCK):
+            out = folds[cp]
+            if len(out) > 1:
+                assert len(out) <= 3
+                if out not in multi:
+                    multi.append(out)
+                row.append(FOLD_MULTI | multi.index(out))
+            else:
+                row.append(out[0] if out else 0)
+        if row not in blocks:
+            blocks.append(row)
+        index.append(blocks.index(row) + 1)
+    assert len(blocks) < 256
+
+    f.write(f"#define UC_FOLD_SHIFT {FOLD_SHIFT}\n#define UC_FOLD_END 0x{end:X}\n#define UC_FOLD_MULTI 0x{FOLD_MULTI:X}u\n\n")
+    f.write("// lower() + NFD + drop combining marks, by block of 1 << UC_FOLD_SHIFT code\n"
+            "// points; 0 means no code point of the block changes\n")
+    f.write("static const uint8_t uc_fold_index[UC_FOLD_END >> UC_FOLD_SHIFT] __attribute__((unused)) = {\n")
+    for i in range(0, len(index), 24):
+        f.write("    " + " ".join(f"{v}," for v in index[i:i + 24]) + "\n")
+    f.write("};\n\n")
+    f.write("// Row n - 1 is block n: the folded code point, 0 when it is dropped, or\n"
+            "// UC_FOLD_MULTI | i for the several code points of uc_fold_multi[i]\n")
+    f.write(f"static const uint32_t uc_fold_blocks[][1 << UC_FOLD_SHIFT] __attribute__((unused)) = {{\n")
+    for row in blocks:
+        f.write("    {\n")
+        for i in range(0, len(row), 8):
+            f.write("        " + " ".join(f"0x{v:05X}," for v in row[i:i + 8]) + "\n")
+        f.write("    },\n")
+    f.write("};\n\n")
+    f.write("// Zero padded\n")
+    f.write("static const uint32_t uc_fold_multi[][3] __attribute__((unused)) = {\n")
+    for out in multi:
+        f.write("    {" + ", ".join(f"0x{v:05X}" for v in out + [0] * (3 - len(out))) + "},\n")
+    f.write("};\n\n#endif\n")
@@ -0,0 +1,59 @@
+"""Recover the merges.txt of a byte-level BPE vocabulary from its token ids.
+
+GPT-2's token ids are its merge ranks: ids 0-255 are the bytes and id 256 + r
+is the token made by merge r (tiktoken's loader asserts this of encoder.json
+and vocab.bpe). Encoding a token with only the merges ranked before it stops
+at the two pieces merge r joined, so replaying BPE over each token in id
+order gives the merge list back, in HuggingFace merges.txt format.
+
+    python recover_merges.py gpt2_vocab.json gpt2_merges.txt
+"""
+import argparse
+import json
+
+
+def split(ranks, token, max_rank):
+    """BPE over token's characters using only merges ranked below max_rank."""
+    parts = list(token)
+    while len(parts) > 1:
+        best, at = None, None
+        for i in range(len(parts) - 1):
+            r = ranks.get(parts[i] + parts[i + 1])
+            if r is not None and r < max_rank and (best is None or r < best):
+                best, at = r, i
+        if best is None:
+            break
+        parts[at:at + 2] = [parts[at] + parts[at + 1]]
+    return parts
+
+
+def recover(vocab):
+    ranks = {token: id for token, id in vocab.items()}
+    merges = []
+    for token, id in sorted(vocab.items(), key=lambda kv: kv[1]):
+        if len(token) < 2 or (token.startswith("<|") and token.endswith("|>")):
+            continue
+        parts = split(ranks, token, id)
+        if len(parts) != 2:
+            raise ValueError(f"{token!r} (id {id}) is not one merge of earlier tokens: {parts}")
+        merges.append(parts)
+    return merges
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("vocab")
+    parser.add_argument("output")
+    args = parser.parse_args()
+    with open(args.vocab, encoding="utf-8") as f:
+        vocab = json.load(f)
+    merges = recover(vocab)
+    with open(args.output, "w", encoding="utf-8") as f:
+        f.write("#version: 0.2\n")
+        for left, right in merges:
+            f.write(f"{left} {right}\n")
+    print(f"Wrote {len(merges)} merges to {args.output}")
+
+
+if __name__ == "__main__":
+    main()